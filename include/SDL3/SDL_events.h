@@ -64,6 +64,7 @@
 #include <SDL3/SDL_notification.h>
 #include <SDL3/SDL_pen.h>
 #include <SDL3/SDL_power.h>
+#include <SDL3/SDL_properties.h>
 #include <SDL3/SDL_sensor.h>
 #include <SDL3/SDL_scancode.h>
 #include <SDL3/SDL_touch.h>
@@ -1388,6 +1389,81 @@ extern SDL_DECLSPEC void SDLCALL SDL_FlushEvents(Uint32 minType, Uint32 maxType)
  */
 extern SDL_DECLSPEC bool SDLCALL SDL_PollEvent(SDL_Event *event);
 
+/**
+ * An inclusive range of event types, used with SDL_PollEvents().
+ *
+ * \since This struct is available since SDL 3.6.0.
+ *
+ * \sa SDL_PollEvents
+ */
+typedef struct SDL_EventTypeRange
+{
+    Uint32 min_type;    /**< the lowest event type in the range */
+    Uint32 max_type;    /**< the highest event type in the range */
+} SDL_EventTypeRange;
+
+/**
+ * Flags for SDL_PollEvents().
+ *
+ * \since This datatype is available since SDL 3.6.0.
+ *
+ * \sa SDL_PollEvents
+ */
+typedef Uint32 SDL_PollEventsFlags;
+
+#define SDL_POLLEVENTS_COALESCE_MOTION (1u << 0) /**< Collapse runs of motion events from the same device, see SDL_PollEvents(). */
+
+/**
+ * Poll for currently pending events, retrieving many of them at once.
+ *
+ * This pumps the event loop once, like SDL_PollEvent(), and then removes up
+ * to `numevents` events from the front of the queue in a single pass, which
+ * is much cheaper than calling SDL_PollEvent() repeatedly when a lot of
+ * events are pending.
+ *
+ * Only events with a type in one of `ranges` are retrieved, other events are
+ * left in the queue in their original order. If `ranges` is NULL, all events
+ * are retrieved.
+ *
+ * If `flags` includes `SDL_POLLEVENTS_COALESCE_MOTION`, motion events are
+ * merged while they are retrieved:
+ *
+ * - `SDL_EVENT_MOUSE_MOTION` events for the same mouse and window are merged
+ *   into the latest one, with `xrel` and `yrel` holding the sum of the
+ *   relative motion of all of them.
+ * - `SDL_EVENT_PEN_MOTION` events for the same pen and window are merged into
+ *   the latest one.
+ * - `SDL_EVENT_GAMEPAD_AXIS_MOTION` events for the same gamepad axis are
+ *   merged into the latest one.
+ *
+ * Events are only merged across other motion events, never across events of
+ * any other type, including events left in the queue because they are not in
+ * `ranges`, so the relative order of button presses and motion is preserved. The merged event takes the place of the first one in the run.
+ * With coalescing, more than `numevents` events may be removed from the
+ * queue, as long as they can be merged into the events already returned.
+ *
+ * As this function may implicitly call SDL_PumpEvents(), you can only call
+ * this function in the thread that initialized the video subsystem.
+ *
+ * \param events destination buffer for the retrieved events.
+ * \param numevents the maximum number of events to retrieve.
+ * \param ranges an array of event type ranges to retrieve, or NULL to
+ *               retrieve all events.
+ * \param num_ranges the number of elements in `ranges`.
+ * \param flags SDL_PollEventsFlags controlling how events are retrieved, or
+ *              0.
+ * \returns the number of events stored in `events`, or -1 on failure; call
+ *          SDL_GetError() for more information.
+ *
+ * \threadsafety This function should only be called on the main thread.
+ *
+ * \since This function is available since SDL 3.6.0.
+ *
+ * \sa SDL_PeepEvents
+ * \sa SDL_PollEvent
+ */
+extern SDL_DECLSPEC int SDLCALL SDL_PollEvents(SDL_Event *events, int numevents, const SDL_EventTypeRange *ranges, int num_ranges, SDL_PollEventsFlags flags);
+
 /**
  * Wait indefinitely for the next available event.
  *
@@ -1567,7 +1643,9 @@ extern SDL_DECLSPEC bool SDLCALL SDL_GetEventFilter(SDL_EventFilter *filter, voi
  * ignored.
  *
  * **WARNING**: Be very careful of what you do in the event filter function,
- * as it may run in a different thread!
+ * as it may run in a different thread! Events pushed from several threads
+ * at once are dispatched to the watch callbacks concurrently, so a callback
+ * may be running on more than one thread at the same time.
  *
  * If the quit event is generated by a signal (e.g. SIGINT), it will bypass
  * the internal queue and be delivered to the watch callback immediately, and
@@ -1598,6 +1676,13 @@ extern SDL_DECLSPEC bool SDLCALL SDL_AddEventWatch(SDL_EventFilter filter, void
  * This function takes the same input as SDL_AddEventWatch() to identify and
  * delete the corresponding callback.
  *
+ * If the callback is running on other threads, this function waits for them
+ * to return, so once it returns the callback won't be called anymore and
+ * `userdata` can be freed. When called from within an event watch callback,
+ * this doesn't wait and the callback may still be running on other threads,
+ * or further up the stack of the calling thread, until they return. Don't
+ * call this function while holding a lock that the callback takes.
+ *
  * \param filter the function originally passed to SDL_AddEventWatch().
  * \param userdata the pointer originally passed to SDL_AddEventWatch().
  *
@@ -1721,6 +1806,67 @@ extern SDL_DECLSPEC SDL_Window * SDLCALL SDL_GetWindowFromEvent(const SDL_Event
  */
 extern SDL_DECLSPEC int SDLCALL SDL_GetEventDescription(const SDL_Event *event, char *buf, int buflen);
 
+/**
+ * Get statistics about the events that went through the event queue.
+ *
+ * This is meant for diagnostics, to see which events an application gets
+ * flooded with, whether any are lost, and how long they wait in the queue.
+ * The counters start when the event subsystem is initialized.
+ *
+ * The following properties are provided, for the requested event type:
+ *
+ * - `SDL_PROP_EVENT_STATS_PUSHED_NUMBER`: the number of events that were
+ *   added to the queue.
+ * - `SDL_PROP_EVENT_STATS_FILTERED_NUMBER`: the number of events that were
+ *   rejected by the event filter set with SDL_SetEventFilter() in
+ *   SDL_PushEvent(). Event watches can't reject events, so they aren't
+ *   counted here.
+ * - `SDL_PROP_EVENT_STATS_DROPPED_NUMBER`: the number of events that were
+ *   lost because the queue was full.
+ * - `SDL_PROP_EVENT_STATS_POPPED_NUMBER`: the number of events that were
+ *   removed from the queue by SDL_PollEvent(), SDL_WaitEvent(),
+ *   SDL_PeepEvents(), SDL_PollEvents() and the like.
+ * - `SDL_PROP_EVENT_STATS_LATENCY_AVERAGE_NUMBER`: the average time in
+ *   nanoseconds between an event's timestamp and the moment it was removed
+ *   from the queue.
+ * - `SDL_PROP_EVENT_STATS_LATENCY_MAX_NUMBER`: the longest time in
+ *   nanoseconds between an event's timestamp and the moment it was removed
+ *   from the queue.
+ *
+ * These properties are provided for the queue as a whole, whatever the
+ * requested type:
+ *
+ * - `SDL_PROP_EVENT_STATS_QUEUED_NUMBER`: the number of events currently in
+ *   the queue.
+ * - `SDL_PROP_EVENT_STATS_MAX_QUEUED_NUMBER`: the largest number of events
+ *   that were in the queue at the same time.
+ *
+ * Each call returns a new group of properties holding the numbers at the time
+ * of the call, which should be freed with SDL_DestroyProperties() when it is
+ * no longer needed.
+ *
+ * \param type the type of event to report on, or 0 to report on all events
+ *             together.
+ * \returns a valid property ID on success or 0 on failure; call
+ *          SDL_GetError() for more information.
+ *
+ * \threadsafety It is safe to call this function from any thread.
+ *
+ * \since This function is available since SDL 3.6.0.
+ *
+ * \sa SDL_DestroyProperties
+ */
+extern SDL_DECLSPEC SDL_PropertiesID SDLCALL SDL_GetEventStats(Uint32 type);
+
+#define SDL_PROP_EVENT_STATS_PUSHED_NUMBER              "SDL.event.stats.pushed"
+#define SDL_PROP_EVENT_STATS_FILTERED_NUMBER            "SDL.event.stats.filtered"
+#define SDL_PROP_EVENT_STATS_DROPPED_NUMBER             "SDL.event.stats.dropped"
+#define SDL_PROP_EVENT_STATS_POPPED_NUMBER              "SDL.event.stats.popped"
+#define SDL_PROP_EVENT_STATS_LATENCY_AVERAGE_NUMBER     "SDL.event.stats.latency.average"
+#define SDL_PROP_EVENT_STATS_LATENCY_MAX_NUMBER         "SDL.event.stats.latency.max"
+#define SDL_PROP_EVENT_STATS_QUEUED_NUMBER              "SDL.event.stats.queued"
+#define SDL_PROP_EVENT_STATS_MAX_QUEUED_NUMBER          "SDL.event.stats.max_queued"
+
 /* Ends C function definitions when using C++ */
 #ifdef __cplusplus
 }
@@ -695,6 +695,7 @@ extern "C" {
  * - "sve2"
  * - "lsx"
  * - "lasx"
+ * - "pclmul"
  *
  * The items can be prefixed by '+'/'-' to add/remove features.
  *
@@ -2859,6 +2860,29 @@ extern "C" {
  */
 #define SDL_HINT_MAIN_CALLBACK_RATE "SDL_MAIN_CALLBACK_RATE"
 
+/**
+ * A variable controlling whether SDL caches small memory blocks for threads
+ * that allocate and free them often.
+ *
+ * This only affects SDL's built-in allocator, which is used by SDL_malloc()
+ * on platforms where SDL is built without a C runtime library. When enabled,
+ * recently freed small blocks are kept in a set of caches that threads pick
+ * from without taking the allocator's global lock. This can speed up programs
+ * that allocate small blocks from several threads at once, at the cost of
+ * holding on to some memory that is not in use.
+ *
+ * The variable can be set to the following values:
+ *
+ * - "0": Small blocks go straight to the allocator. (default)
+ * - "1": Small blocks are cached.
+ *
+ * This hint can be set anytime. The cached memory is released when the hint
+ * is disabled and when SDL_Quit() is called.
+ *
+ * \since This hint is available since SDL 3.6.0.
+ */
+#define SDL_HINT_MALLOC_THREAD_CACHE "SDL_MALLOC_THREAD_CACHE"
+
 /**
  * A variable controlling whether the mouse is captured while mouse buttons
  * are pressed.
@@ -3070,6 +3094,30 @@ extern "C" {
  */
 #define SDL_HINT_MOUSE_RELATIVE_CURSOR_VISIBLE "SDL_MOUSE_RELATIVE_CURSOR_VISIBLE"
 
+/**
+ * A variable controlling how many raw mouse motion samples SDL keeps for
+ * SDL_GetMouseSamples().
+ *
+ * High rate mice report motion thousands of times a second. SDL combines the
+ * motion reported between two event pumps into a single mouse motion event,
+ * and with this set, also keeps each report as a sample the application can
+ * read. When the buffer is full, new samples are dropped until the
+ * application reads some.
+ *
+ * The variable can be set to the number of samples to keep, which is rounded
+ * up to a power of two.
+ *
+ * The default value is "0", no samples are kept.
+ *
+ * Samples are currently only collected from Linux evdev devices, for example
+ * with the KMSDRM video driver.
+ *
+ * This hint should be set before SDL is initialized.
+ *
+ * \since This hint is available since SDL 3.6.0.
+ */
+#define SDL_HINT_MOUSE_SAMPLE_BUFFER_SIZE "SDL_MOUSE_SAMPLE_BUFFER_SIZE"
+
 /**
  * A variable controlling whether mouse events should generate synthetic touch
  * events.
@@ -3738,6 +3786,26 @@ extern "C" {
  */
 #define SDL_HINT_TIMER_RESOLUTION "SDL_TIMER_RESOLUTION"
 
+/**
+ * A variable controlling how many threads run timer callbacks.
+ *
+ * By default, callbacks of timers added with SDL_AddTimer() and
+ * SDL_AddTimerNS() run one after the other on the timer thread, so a slow
+ * callback delays every other timer. With this set, the timer thread hands
+ * the timers that are due to a pool of threads instead. A given timer still
+ * never runs more than one callback at a time, but callbacks of different
+ * timers may run at the same time, and in any order.
+ *
+ * The variable can be set to the number of threads to use, up to 64.
+ *
+ * The default value is "0", callbacks run on the timer thread.
+ *
+ * This hint should be set before the first timer is added.
+ *
+ * \since This hint is available since SDL 3.6.0.
+ */
+#define SDL_HINT_TIMER_THREADS "SDL_TIMER_THREADS"
+
 /**
  * A variable controlling whether touch events should generate synthetic mouse
  * events.
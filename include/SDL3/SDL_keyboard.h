@@ -158,6 +158,65 @@ extern SDL_DECLSPEC SDL_Window * SDLCALL SDL_GetKeyboardFocus(void);
  */
 extern SDL_DECLSPEC const bool * SDLCALL SDL_GetKeyboardState(int *numkeys);
 
+/**
+ * The keyboard state and its changes, as bitmaps indexed by SDL_Scancode.
+ *
+ * Use SDL_KEYBOARD_SNAPSHOT_TEST() to check the bit for a scancode, or
+ * combine the words directly to process many keys at once.
+ *
+ * \since This struct is available since SDL 3.6.0.
+ *
+ * \sa SDL_GetKeyboardSnapshot
+ */
+typedef struct SDL_KeyboardSnapshot
+{
+    Uint64 down[SDL_SCANCODE_COUNT / 64];       /**< the keys that are currently pressed */
+    Uint64 pressed[SDL_SCANCODE_COUNT / 64];    /**< the keys that were pressed since the previous snapshot */
+    Uint64 released[SDL_SCANCODE_COUNT / 64];   /**< the keys that were released since the previous snapshot */
+} SDL_KeyboardSnapshot;
+
+/**
+ * Check whether the bit for a scancode is set in an SDL_KeyboardSnapshot
+ * bitmap.
+ *
+ * \param bits one of the bitmaps in an SDL_KeyboardSnapshot.
+ * \param scancode the SDL_Scancode to check.
+ * \returns true if the bit is set, false otherwise.
+ *
+ * \threadsafety It is safe to call this macro from any thread.
+ *
+ * \since This macro is available since SDL 3.6.0.
+ */
+#define SDL_KEYBOARD_SNAPSHOT_TEST(bits, scancode) ((((bits)[(scancode) >> 6] >> ((scancode) & 63)) & 1) != 0)
+
+/**
+ * Get the keyboard state along with the keys pressed and released since the
+ * previous call.
+ *
+ * Unlike comparing the array from SDL_GetKeyboardState() with a copy from the
+ * previous frame, a key that was pressed and released again between two calls
+ * shows up in both `pressed` and `released`. The snapshot is taken while
+ * holding the lock that key events use to update it, so it's consistent even
+ * if events are being pumped on another thread.
+ *
+ * Calling this function clears the `pressed` and `released` bitmaps, so it
+ * should only be called from one place.
+ *
+ * Use SDL_PumpEvents() to update the keyboard state.
+ *
+ * \param snapshot a pointer filled in with the keyboard state.
+ * \returns true on success or false on failure; call SDL_GetError() for more
+ *          information.
+ *
+ * \threadsafety It is safe to call this function from any thread.
+ *
+ * \since This function is available since SDL 3.6.0.
+ *
+ * \sa SDL_GetKeyboardState
+ * \sa SDL_KEYBOARD_SNAPSHOT_TEST
+ */
+extern SDL_DECLSPEC bool SDLCALL SDL_GetKeyboardSnapshot(SDL_KeyboardSnapshot *snapshot);
+
 /**
  * Clear the state of the keyboard.
  *
@@ -395,6 +395,47 @@ extern SDL_DECLSPEC SDL_MouseButtonFlags SDLCALL SDL_GetGlobalMouseState(float *
  */
 extern SDL_DECLSPEC SDL_MouseButtonFlags SDLCALL SDL_GetRelativeMouseState(float *x, float *y);
 
+/**
+ * A raw relative motion sample from a mouse.
+ *
+ * \since This struct is available since SDL 3.6.0.
+ *
+ * \sa SDL_GetMouseSamples
+ */
+typedef struct SDL_MouseSample
+{
+    Uint64 timestamp;   /**< In nanoseconds, populated using SDL_GetTicksNS() */
+    SDL_MouseID which;  /**< The mouse instance id */
+    Sint32 dx;          /**< The motion in the X direction, in device units */
+    Sint32 dy;          /**< The motion in the Y direction, in device units */
+} SDL_MouseSample;
+
+/**
+ * Read the raw motion samples reported by relative mice.
+ *
+ * Motion reported by a mouse between two event pumps is sent as a single
+ * SDL_EVENT_MOUSE_MOTION event. If SDL_HINT_MOUSE_SAMPLE_BUFFER_SIZE is set,
+ * SDL also keeps every report as it came from the device, without any speed
+ * scaling, and this function reads them in the order they arrived.
+ *
+ * Samples are added as events are pumped, and can be read on another thread
+ * at the same time. Only one thread should read samples at a time.
+ *
+ * \param samples an array to fill with samples, or NULL to get the number of
+ *                samples waiting.
+ * \param count the number of samples that fit in `samples`.
+ * \returns the number of samples read or waiting, or -1 on failure; call
+ *          SDL_GetError() for more information.
+ *
+ * \threadsafety It is safe to call this function from any thread, as long as
+ *               only one thread reads samples at a time.
+ *
+ * \since This function is available since SDL 3.6.0.
+ *
+ * \sa SDL_HINT_MOUSE_SAMPLE_BUFFER_SIZE
+ */
+extern SDL_DECLSPEC int SDLCALL SDL_GetMouseSamples(SDL_MouseSample *samples, int count);
+
 /**
  * Move the mouse cursor to the given position within the window.
  *
@@ -43,6 +43,18 @@
  *   types.
  *
  * Properties can be removed from a group by using SDL_ClearProperty.
+ *
+ * Code that accesses the same properties over and over can look up the name
+ * of a property once with SDL_GetPropertyAtom, and then use the functions
+ * that take an SDL_PropertyAtom, like SDL_GetNumberPropertyByAtom, which
+ * don't need to hash and compare the name on every call.
+ *
+ * Getting properties from many threads at once is cheap, since readers of a
+ * group don't wait for each other. Setting or clearing a property has to
+ * wait until no other thread is in the middle of getting one from the same
+ * group, so a group that is read constantly from several threads, like the
+ * global properties, can make setters on it wait for a while. Keep values
+ * that change often in a group of their own.
  */
 
 
@@ -65,6 +77,18 @@ extern "C" {
  */
 typedef Uint32 SDL_PropertiesID;
 
+/**
+ * An ID that represents an interned property name.
+ *
+ * An atom is valid in any group of properties, and refers to the same name
+ * until SDL_Quit() is called. A value of 0 is never a valid atom.
+ *
+ * \since This datatype is available since SDL 3.6.0.
+ *
+ * \sa SDL_GetPropertyAtom
+ */
+typedef Uint32 SDL_PropertyAtom;
+
 /**
  * SDL property type
  *
@@ -166,6 +190,11 @@ extern SDL_DECLSPEC bool SDLCALL SDL_CopyProperties(SDL_PropertiesID src, SDL_Pr
  * or want to guarantee that properties being queried aren't freed in another
  * thread.
  *
+ * Getting a property doesn't wait for this lock, so threads reading
+ * properties don't get in each other's way. A thread that wants to see
+ * several properties set atomically by another thread should lock the
+ * properties while it reads them.
+ *
  * \param props the properties to lock.
  * \returns true on success or false on failure; call SDL_GetError() for more
  *          information.
@@ -508,6 +537,315 @@ extern SDL_DECLSPEC bool SDLCALL SDL_GetBooleanProperty(SDL_PropertiesID props,
  */
 extern SDL_DECLSPEC bool SDLCALL SDL_ClearProperty(SDL_PropertiesID props, const char *name);
 
+/**
+ * Get the interned name of a property.
+ *
+ * The first call with a given name stores a copy of the name, and every call
+ * after that returns the same atom for it, in any group of properties. The
+ * atom can then be used to get and set the property without looking up the
+ * name again.
+ *
+ * Names stay interned until SDL_Quit() is called, so this is meant for a
+ * fixed set of names, not for names that are generated on the fly.
+ *
+ * \param name the name of the property.
+ * \returns the atom for the name, or 0 on failure; call SDL_GetError() for
+ *          more information.
+ *
+ * \threadsafety It is safe to call this function from any thread.
+ *
+ * \since This function is available since SDL 3.6.0.
+ *
+ * \sa SDL_GetPropertyAtomName
+ */
+extern SDL_DECLSPEC SDL_PropertyAtom SDLCALL SDL_GetPropertyAtom(const char *name);
+
+/**
+ * Get the property name that an atom stands for.
+ *
+ * \param atom the atom returned by SDL_GetPropertyAtom().
+ * \returns the name of the property, or NULL on failure; call SDL_GetError()
+ *          for more information. This string is valid until SDL_Quit() is
+ *          called.
+ *
+ * \threadsafety It is safe to call this function from any thread.
+ *
+ * \since This function is available since SDL 3.6.0.
+ *
+ * \sa SDL_GetPropertyAtom
+ */
+extern SDL_DECLSPEC const char * SDLCALL SDL_GetPropertyAtomName(SDL_PropertyAtom atom);
+
+/**
+ * Set a pointer property in a group of properties by atom.
+ *
+ * This is the same as SDL_SetPointerProperty(), but it doesn't have to look up
+ * the name of the property.
+ *
+ * Setting a NULL value clears the property.
+ *
+ * \param props the properties to modify.
+ * \param atom the interned name of the property to modify.
+ * \param value the new value of the property.
+ * \returns true on success or false on failure; call SDL_GetError() for more
+ *          information.
+ *
+ * \threadsafety It is safe to call this function from any thread.
+ *
+ * \since This function is available since SDL 3.6.0.
+ *
+ * \sa SDL_GetPointerPropertyByAtom
+ * \sa SDL_GetPropertyAtom
+ * \sa SDL_SetPointerProperty
+ */
+extern SDL_DECLSPEC bool SDLCALL SDL_SetPointerPropertyByAtom(SDL_PropertiesID props, SDL_PropertyAtom atom, void *value);
+
+/**
+ * Set a string property in a group of properties by atom.
+ *
+ * This is the same as SDL_SetStringProperty(), but it doesn't have to look up
+ * the name of the property.
+ *
+ * This function makes a copy of the string; the caller does not have to
+ * preserve the data after this call completes. Setting a NULL value clears
+ * the property.
+ *
+ * \param props the properties to modify.
+ * \param atom the interned name of the property to modify.
+ * \param value the new value of the property.
+ * \returns true on success or false on failure; call SDL_GetError() for more
+ *          information.
+ *
+ * \threadsafety It is safe to call this function from any thread.
+ *
+ * \since This function is available since SDL 3.6.0.
+ *
+ * \sa SDL_GetStringPropertyByAtom
+ * \sa SDL_GetPropertyAtom
+ * \sa SDL_SetStringProperty
+ */
+extern SDL_DECLSPEC bool SDLCALL SDL_SetStringPropertyByAtom(SDL_PropertiesID props, SDL_PropertyAtom atom, const char *value);
+
+/**
+ * Set an integer property in a group of properties by atom.
+ *
+ * This is the same as SDL_SetNumberProperty(), but it doesn't have to look up
+ * the name of the property.
+ *
+ * \param props the properties to modify.
+ * \param atom the interned name of the property to modify.
+ * \param value the new value of the property.
+ * \returns true on success or false on failure; call SDL_GetError() for more
+ *          information.
+ *
+ * \threadsafety It is safe to call this function from any thread.
+ *
+ * \since This function is available since SDL 3.6.0.
+ *
+ * \sa SDL_GetNumberPropertyByAtom
+ * \sa SDL_GetPropertyAtom
+ * \sa SDL_SetNumberProperty
+ */
+extern SDL_DECLSPEC bool SDLCALL SDL_SetNumberPropertyByAtom(SDL_PropertiesID props, SDL_PropertyAtom atom, Sint64 value);
+
+/**
+ * Set a floating point property in a group of properties by atom.
+ *
+ * This is the same as SDL_SetFloatProperty(), but it doesn't have to look up
+ * the name of the property.
+ *
+ * \param props the properties to modify.
+ * \param atom the interned name of the property to modify.
+ * \param value the new value of the property.
+ * \returns true on success or false on failure; call SDL_GetError() for more
+ *          information.
+ *
+ * \threadsafety It is safe to call this function from any thread.
+ *
+ * \since This function is available since SDL 3.6.0.
+ *
+ * \sa SDL_GetFloatPropertyByAtom
+ * \sa SDL_GetPropertyAtom
+ * \sa SDL_SetFloatProperty
+ */
+extern SDL_DECLSPEC bool SDLCALL SDL_SetFloatPropertyByAtom(SDL_PropertiesID props, SDL_PropertyAtom atom, float value);
+
+/**
+ * Set a boolean property in a group of properties by atom.
+ *
+ * This is the same as SDL_SetBooleanProperty(), but it doesn't have to look up
+ * the name of the property.
+ *
+ * \param props the properties to modify.
+ * \param atom the interned name of the property to modify.
+ * \param value the new value of the property.
+ * \returns true on success or false on failure; call SDL_GetError() for more
+ *          information.
+ *
+ * \threadsafety It is safe to call this function from any thread.
+ *
+ * \since This function is available since SDL 3.6.0.
+ *
+ * \sa SDL_GetBooleanPropertyByAtom
+ * \sa SDL_GetPropertyAtom
+ * \sa SDL_SetBooleanProperty
+ */
+extern SDL_DECLSPEC bool SDLCALL SDL_SetBooleanPropertyByAtom(SDL_PropertiesID props, SDL_PropertyAtom atom, bool value);
+
+/**
+ * Get the type of a property in a group of properties by atom.
+ *
+ * \param props the properties to query.
+ * \param atom the interned name of the property to query.
+ * \returns the type of the property, or SDL_PROPERTY_TYPE_INVALID if it is
+ *          not set.
+ *
+ * \threadsafety It is safe to call this function from any thread.
+ *
+ * \since This function is available since SDL 3.6.0.
+ *
+ * \sa SDL_GetPropertyAtom
+ * \sa SDL_GetPropertyType
+ */
+extern SDL_DECLSPEC SDL_PropertyType SDLCALL SDL_GetPropertyTypeByAtom(SDL_PropertiesID props, SDL_PropertyAtom atom);
+
+/**
+ * Get a pointer property from a group of properties by atom.
+ *
+ * This is the same as SDL_GetPointerProperty(), but it doesn't have to look up
+ * the name of the property.
+ *
+ * \param props the properties to query.
+ * \param atom the interned name of the property to query.
+ * \param default_value the default value of the property.
+ * \returns the value of the property, or `default_value` if it is not set or
+ *          not a pointer property.
+ *
+ * \threadsafety It is safe to call this function from any thread, although
+ *               the data returned is not protected and could potentially be
+ *               freed if you call SDL_SetPointerPropertyByAtom() or
+ *               SDL_ClearPropertyByAtom() on these properties from another
+ *               thread. If you need to avoid this, use SDL_LockProperties()
+ *               and SDL_UnlockProperties().
+ *
+ * \since This function is available since SDL 3.6.0.
+ *
+ * \sa SDL_GetPointerProperty
+ * \sa SDL_GetPropertyAtom
+ * \sa SDL_SetPointerPropertyByAtom
+ */
+extern SDL_DECLSPEC void * SDLCALL SDL_GetPointerPropertyByAtom(SDL_PropertiesID props, SDL_PropertyAtom atom, void *default_value);
+
+/**
+ * Get a string property from a group of properties by atom.
+ *
+ * This is the same as SDL_GetStringProperty(), but it doesn't have to look up
+ * the name of the property.
+ *
+ * \param props the properties to query.
+ * \param atom the interned name of the property to query.
+ * \param default_value the default value of the property.
+ * \returns the value of the property, or `default_value` if it is not set or
+ *          not a string property.
+ *
+ * \threadsafety It is safe to call this function from any thread, although
+ *               the data returned is not protected and could potentially be
+ *               freed if you call SDL_SetStringPropertyByAtom() or
+ *               SDL_ClearPropertyByAtom() on these properties from another
+ *               thread. If you need to avoid this, use SDL_LockProperties()
+ *               and SDL_UnlockProperties().
+ *
+ * \since This function is available since SDL 3.6.0.
+ *
+ * \sa SDL_GetStringProperty
+ * \sa SDL_GetPropertyAtom
+ * \sa SDL_SetStringPropertyByAtom
+ */
+extern SDL_DECLSPEC const char * SDLCALL SDL_GetStringPropertyByAtom(SDL_PropertiesID props, SDL_PropertyAtom atom, const char *default_value);
+
+/**
+ * Get a number property from a group of properties by atom.
+ *
+ * This is the same as SDL_GetNumberProperty(), but it doesn't have to look up
+ * the name of the property.
+ *
+ * \param props the properties to query.
+ * \param atom the interned name of the property to query.
+ * \param default_value the default value of the property.
+ * \returns the value of the property, or `default_value` if it is not set or
+ *          not a number property.
+ *
+ * \threadsafety It is safe to call this function from any thread.
+ *
+ * \since This function is available since SDL 3.6.0.
+ *
+ * \sa SDL_GetNumberProperty
+ * \sa SDL_GetPropertyAtom
+ * \sa SDL_SetNumberPropertyByAtom
+ */
+extern SDL_DECLSPEC Sint64 SDLCALL SDL_GetNumberPropertyByAtom(SDL_PropertiesID props, SDL_PropertyAtom atom, Sint64 default_value);
+
+/**
+ * Get a float property from a group of properties by atom.
+ *
+ * This is the same as SDL_GetFloatProperty(), but it doesn't have to look up
+ * the name of the property.
+ *
+ * \param props the properties to query.
+ * \param atom the interned name of the property to query.
+ * \param default_value the default value of the property.
+ * \returns the value of the property, or `default_value` if it is not set or
+ *          not a float property.
+ *
+ * \threadsafety It is safe to call this function from any thread.
+ *
+ * \since This function is available since SDL 3.6.0.
+ *
+ * \sa SDL_GetFloatProperty
+ * \sa SDL_GetPropertyAtom
+ * \sa SDL_SetFloatPropertyByAtom
+ */
+extern SDL_DECLSPEC float SDLCALL SDL_GetFloatPropertyByAtom(SDL_PropertiesID props, SDL_PropertyAtom atom, float default_value);
+
+/**
+ * Get a boolean property from a group of properties by atom.
+ *
+ * This is the same as SDL_GetBooleanProperty(), but it doesn't have to look up
+ * the name of the property.
+ *
+ * \param props the properties to query.
+ * \param atom the interned name of the property to query.
+ * \param default_value the default value of the property.
+ * \returns the value of the property, or `default_value` if it is not set or
+ *          not a boolean property.
+ *
+ * \threadsafety It is safe to call this function from any thread.
+ *
+ * \since This function is available since SDL 3.6.0.
+ *
+ * \sa SDL_GetBooleanProperty
+ * \sa SDL_GetPropertyAtom
+ * \sa SDL_SetBooleanPropertyByAtom
+ */
+extern SDL_DECLSPEC bool SDLCALL SDL_GetBooleanPropertyByAtom(SDL_PropertiesID props, SDL_PropertyAtom atom, bool default_value);
+
+/**
+ * Clear a property from a group of properties by atom.
+ *
+ * \param props the properties to modify.
+ * \param atom the interned name of the property to clear.
+ * \returns true on success or false on failure; call SDL_GetError() for more
+ *          information.
+ *
+ * \threadsafety It is safe to call this function from any thread.
+ *
+ * \since This function is available since SDL 3.6.0.
+ *
+ * \sa SDL_ClearProperty
+ * \sa SDL_GetPropertyAtom
+ */
+extern SDL_DECLSPEC bool SDLCALL SDL_ClearPropertyByAtom(SDL_PropertiesID props, SDL_PropertyAtom atom);
+
 /**
  * Get the current number of items in a group of properties.
  *
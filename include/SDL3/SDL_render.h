@@ -306,6 +306,13 @@ extern SDL_DECLSPEC SDL_Renderer * SDLCALL SDL_CreateRenderer(SDL_Window *window
  * - `SDL_PROP_RENDERER_CREATE_GPU_SHADERS_MSL_BOOLEAN`: the app is able to
  *   provide MSL shaders to SDL_GPURenderState, optional.
  *
+ * With the software renderer (since SDL 3.6.0):
+ *
+ * - `SDL_PROP_RENDERER_CREATE_SOFTWARE_ANTIALIAS_BOOLEAN`: true if lines and
+ *   untextured geometry should be drawn with anti-aliased edges, defaults to
+ *   false. This is much cheaper than rendering at a higher resolution and
+ *   scaling down.
+ *
  * With the metal renderer:
  *
  * - `SDL_PROP_RENDERER_CREATE_METAL_DEVICE_POINTER`: the MTLDevice to use
@@ -355,6 +362,7 @@ extern SDL_DECLSPEC SDL_Renderer * SDLCALL SDL_CreateRendererWithProperties(SDL_
 #define SDL_PROP_RENDERER_CREATE_GPU_SHADERS_SPIRV_BOOLEAN                  "SDL.renderer.create.gpu.shaders_spirv"
 #define SDL_PROP_RENDERER_CREATE_GPU_SHADERS_DXIL_BOOLEAN                   "SDL.renderer.create.gpu.shaders_dxil"
 #define SDL_PROP_RENDERER_CREATE_GPU_SHADERS_MSL_BOOLEAN                    "SDL.renderer.create.gpu.shaders_msl"
+#define SDL_PROP_RENDERER_CREATE_SOFTWARE_ANTIALIAS_BOOLEAN                 "SDL.renderer.create.software.antialias"
 #define SDL_PROP_RENDERER_CREATE_METAL_DEVICE_POINTER                       "SDL.renderer.create.metal.device"
 #define SDL_PROP_RENDERER_CREATE_METAL_COMMAND_QUEUE_POINTER                "SDL.renderer.create.metal.command_queue"
 #define SDL_PROP_RENDERER_CREATE_VULKAN_INSTANCE_POINTER                    "SDL.renderer.create.vulkan.instance"
@@ -2973,6 +2981,157 @@ extern SDL_DECLSPEC bool SDLCALL SDL_SetDefaultTextureScaleMode(SDL_Renderer *re
  */
 extern SDL_DECLSPEC bool SDLCALL SDL_GetDefaultTextureScaleMode(SDL_Renderer *renderer, SDL_ScaleMode *scale_mode);
 
+/**
+ * An atlas that packs many small images into a few shared textures.
+ *
+ * Drawing many images from the same texture lets the renderer batch them
+ * together, which is much faster than switching textures for every image.
+ *
+ * \since This struct is available since SDL 3.6.0.
+ *
+ * \sa SDL_CreateTextureAtlas
+ * \sa SDL_AddTextureAtlasEntry
+ * \sa SDL_GetTextureAtlasEntry
+ * \sa SDL_DestroyTextureAtlas
+ */
+typedef struct SDL_TextureAtlas SDL_TextureAtlas;
+
+/**
+ * A handle to an image stored in a texture atlas.
+ *
+ * The value 0 is an invalid handle.
+ *
+ * \since This datatype is available since SDL 3.6.0.
+ *
+ * \sa SDL_AddTextureAtlasEntry
+ */
+typedef Uint32 SDL_TextureAtlasEntryID;
+
+/**
+ * Create a texture atlas.
+ *
+ * The atlas creates textures of the given size and format as needed while
+ * images are added to it. Each image added to the atlas must fit within a
+ * single texture.
+ *
+ * The atlas textures are owned by the renderer, so the atlas must be
+ * destroyed before the renderer is destroyed.
+ *
+ * \param renderer the rendering context.
+ * \param format one of the enumerated values in SDL_PixelFormat, used for
+ *               all the atlas textures.
+ * \param w the width of each atlas texture in pixels.
+ * \param h the height of each atlas texture in pixels.
+ * \returns the new texture atlas or NULL on failure; call SDL_GetError() for
+ *          more information.
+ *
+ * \threadsafety This function should only be called on the main thread.
+ *
+ * \since This function is available since SDL 3.6.0.
+ *
+ * \sa SDL_AddTextureAtlasEntry
+ * \sa SDL_DestroyTextureAtlas
+ */
+extern SDL_DECLSPEC SDL_TextureAtlas * SDLCALL SDL_CreateTextureAtlas(SDL_Renderer *renderer, SDL_PixelFormat format, int w, int h);
+
+/**
+ * Copy an image into a texture atlas.
+ *
+ * The pixels of the surface are converted to the atlas format and uploaded
+ * to free space in one of the atlas textures, creating a new texture if none
+ * of the existing ones has room. The surface is not referenced after this
+ * call.
+ *
+ * \param atlas the texture atlas to update.
+ * \param surface the image to add to the atlas.
+ * \returns a handle for the new entry or 0 on failure; call SDL_GetError()
+ *          for more information.
+ *
+ * \threadsafety This function should only be called on the main thread.
+ *
+ * \since This function is available since SDL 3.6.0.
+ *
+ * \sa SDL_GetTextureAtlasEntry
+ * \sa SDL_RemoveTextureAtlasEntry
+ */
+extern SDL_DECLSPEC SDL_TextureAtlasEntryID SDLCALL SDL_AddTextureAtlasEntry(SDL_TextureAtlas *atlas, SDL_Surface *surface);
+
+/**
+ * Get the texture and source rectangle of an image in a texture atlas.
+ *
+ * The texture and rectangle can be passed directly to SDL_RenderTexture()
+ * and related functions to draw the image.
+ *
+ * \param atlas the texture atlas to query.
+ * \param entry the handle returned by SDL_AddTextureAtlasEntry().
+ * \param texture a pointer filled in with the texture containing the image,
+ *                may be NULL.
+ * \param srcrect a pointer filled in with the area of the texture containing
+ *                the image, may be NULL.
+ * \returns true on success or false on failure; call SDL_GetError() for more
+ *          information.
+ *
+ * \threadsafety This function should only be called on the main thread.
+ *
+ * \since This function is available since SDL 3.6.0.
+ *
+ * \sa SDL_AddTextureAtlasEntry
+ */
+extern SDL_DECLSPEC bool SDLCALL SDL_GetTextureAtlasEntry(SDL_TextureAtlas *atlas, SDL_TextureAtlasEntryID entry, SDL_Texture **texture, SDL_FRect *srcrect);
+
+/**
+ * Remove an image from a texture atlas.
+ *
+ * The space used by the image becomes available for new entries. The pixels
+ * are left in place, so draw commands that are already queued are not
+ * affected, but the area may be overwritten by the next call to
+ * SDL_AddTextureAtlasEntry().
+ *
+ * \param atlas the texture atlas to update.
+ * \param entry the handle returned by SDL_AddTextureAtlasEntry().
+ * \returns true on success or false on failure; call SDL_GetError() for more
+ *          information.
+ *
+ * \threadsafety This function should only be called on the main thread.
+ *
+ * \since This function is available since SDL 3.6.0.
+ *
+ * \sa SDL_AddTextureAtlasEntry
+ */
+extern SDL_DECLSPEC bool SDLCALL SDL_RemoveTextureAtlasEntry(SDL_TextureAtlas *atlas, SDL_TextureAtlasEntryID entry);
+
+/**
+ * Get how much of a texture atlas is in use.
+ *
+ * \param atlas the texture atlas to query.
+ * \param num_textures a pointer filled in with the number of textures the
+ *                     atlas has created, may be NULL.
+ * \param num_entries a pointer filled in with the number of images in the
+ *                    atlas, may be NULL.
+ * \param occupancy a pointer filled in with the fraction of the texture area
+ *                  covered by images, from 0.0f to 1.0f, may be NULL.
+ * \returns true on success or false on failure; call SDL_GetError() for more
+ *          information.
+ *
+ * \threadsafety This function should only be called on the main thread.
+ *
+ * \since This function is available since SDL 3.6.0.
+ */
+extern SDL_DECLSPEC bool SDLCALL SDL_GetTextureAtlasOccupancy(SDL_TextureAtlas *atlas, int *num_textures, int *num_entries, float *occupancy);
+
+/**
+ * Destroy a texture atlas and all of its textures.
+ *
+ * \param atlas the texture atlas to destroy.
+ *
+ * \threadsafety This function should only be called on the main thread.
+ *
+ * \since This function is available since SDL 3.6.0.
+ *
+ * \sa SDL_CreateTextureAtlas
+ */
+extern SDL_DECLSPEC void SDLCALL SDL_DestroyTextureAtlas(SDL_TextureAtlas *atlas);
+
 /**
  * A structure specifying the parameters of a GPU render state.
  *
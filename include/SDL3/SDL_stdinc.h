@@ -1752,6 +1752,64 @@ extern SDL_DECLSPEC void SDLCALL SDL_aligned_free(void *mem);
  */
 extern SDL_DECLSPEC int SDLCALL SDL_GetNumAllocations(void);
 
+/**
+ * The kinds of memory SDL keeps track of for its own use.
+ *
+ * SDL tags the memory it allocates for some of its internal data, so
+ * applications can see which parts of SDL it belongs to. Memory allocated
+ * for other purposes isn't counted under any tag.
+ *
+ * \since This enum is available since SDL 3.6.0.
+ *
+ * \sa SDL_GetMemoryStats
+ */
+typedef enum SDL_MemoryTag
+{
+    SDL_MEMORY_TAG_AUDIO,       /**< Audio stream queue chunks and tracks */
+    SDL_MEMORY_TAG_RENDER,      /**< Render commands and vertex data queued by 2D renderers */
+    SDL_MEMORY_TAG_SURFACE,     /**< Surface pixels allocated by SDL */
+    SDL_MEMORY_TAG_EVENTS,      /**< Event queue entries and temporary memory for events */
+    SDL_MEMORY_TAG_HASHTABLE,   /**< Hash tables used by properties, hints and other internal lookups */
+    SDL_MEMORY_TAG_COUNT        /**< The number of memory tags, not a valid tag */
+} SDL_MemoryTag;
+
+/**
+ * Statistics about the memory SDL allocated under a tag.
+ *
+ * \since This struct is available since SDL 3.6.0.
+ *
+ * \sa SDL_GetMemoryStats
+ */
+typedef struct SDL_MemoryStats
+{
+    Uint64 live_bytes;          /**< the number of bytes currently allocated */
+    Uint64 live_allocations;    /**< the number of blocks currently allocated */
+    Uint64 total_bytes;         /**< the number of bytes allocated since the program started, including those freed since */
+    Uint64 total_allocations;   /**< the number of blocks allocated since the program started, including those freed since */
+} SDL_MemoryStats;
+
+/**
+ * Get statistics about the memory SDL allocated under a tag.
+ *
+ * The counters are always kept, whatever memory functions are set with
+ * SDL_SetMemoryFunctions(), and count the sizes SDL asked for, not
+ * including any overhead of the allocator.
+ *
+ * To get an allocation rate, call this function periodically and divide the
+ * difference in `total_allocations` or `total_bytes` by the time between the
+ * calls.
+ *
+ * \param tag the tag to report on.
+ * \param stats a pointer filled in with the statistics for the tag.
+ * \returns true on success or false on failure; call SDL_GetError() for more
+ *          information.
+ *
+ * \threadsafety It is safe to call this function from any thread.
+ *
+ * \since This function is available since SDL 3.6.0.
+ */
+extern SDL_DECLSPEC bool SDLCALL SDL_GetMemoryStats(SDL_MemoryTag tag, SDL_MemoryStats *stats);
+
 /**
  * A thread-safe set of environment variables
  *
@@ -2226,6 +2284,90 @@ extern SDL_DECLSPEC void SDLCALL SDL_qsort_r(void *base, size_t nmemb, size_t si
  */
 extern SDL_DECLSPEC void * SDLCALL SDL_bsearch_r(const void *key, const void *base, size_t nmemb, size_t size, SDL_CompareCallback_r compare, void *userdata);
 
+/**
+ * The type of the key that SDL_SortByKey() sorts an array by.
+ *
+ * \since This enum is available since SDL 3.6.0.
+ *
+ * \sa SDL_SortByKey
+ */
+typedef enum SDL_SortKeyType
+{
+    SDL_SORTKEY_UINT32,     /**< Uint32 */
+    SDL_SORTKEY_SINT32,     /**< Sint32 */
+    SDL_SORTKEY_UINT64,     /**< Uint64 */
+    SDL_SORTKEY_SINT64,     /**< Sint64 */
+    SDL_SORTKEY_FLOAT,      /**< float */
+    SDL_SORTKEY_DOUBLE      /**< double */
+} SDL_SortKeyType;
+
+/**
+ * Sort an array in increasing order of a number stored in each element.
+ *
+ * This is a radix sort, which doesn't call a compare function, so it is much
+ * faster than SDL_qsort() for large arrays that are ordered by a plain
+ * number, like sprites ordered by depth.
+ *
+ * Elements with equal keys keep their relative order. Floating point keys
+ * are ordered by value, with -0.0 before 0.0; NaNs with the sign bit set go
+ * first and the other NaNs go last.
+ *
+ * For example:
+ *
+ * ```c
+ * typedef struct {
+ *     SDL_Texture *texture;
+ *     SDL_FRect rect;
+ *     float depth;
+ * } sprite;
+ *
+ * SDL_SortByKey(sprites, num_sprites, sizeof(sprite), offsetof(sprite, depth), SDL_SORTKEY_FLOAT);
+ * ```
+ *
+ * \param base a pointer to the start of the array.
+ * \param nmemb the number of elements in the array.
+ * \param size the size of the elements in the array.
+ * \param key_offset the offset of the key in each element, in bytes. The key
+ *                   doesn't have to be aligned.
+ * \param key_type the type of the key.
+ * \returns true on success or false on failure; call SDL_GetError() for more
+ *          information. The array is unchanged on failure.
+ *
+ * \threadsafety It is safe to call this function from any thread.
+ *
+ * \since This function is available since SDL 3.6.0.
+ *
+ * \sa SDL_qsort
+ */
+extern SDL_DECLSPEC bool SDLCALL SDL_SortByKey(void *base, size_t nmemb, size_t size, size_t key_offset, SDL_SortKeyType key_type);
+
+/**
+ * Sort an array using several threads.
+ *
+ * This sorts the same way as SDL_qsort_r(), but large arrays are split into
+ * runs that are sorted on separate threads and then merged. Small arrays are
+ * sorted on the calling thread, and if threads or the memory to merge into
+ * aren't available, the whole array is sorted on the calling thread.
+ *
+ * Since it is called from several threads at once, `compare` must be safe to
+ * call from any thread.
+ *
+ * \param base a pointer to the start of the array.
+ * \param nmemb the number of elements in the array.
+ * \param size the size of the elements in the array.
+ * \param compare a function used to compare elements in the array.
+ * \param userdata a pointer to pass to the compare function.
+ * \param num_threads the most threads to use, including the calling thread,
+ *                    or 0 to use one per logical CPU core.
+ *
+ * \threadsafety It is safe to call this function from any thread.
+ *
+ * \since This function is available since SDL 3.6.0.
+ *
+ * \sa SDL_qsort_r
+ */
+extern SDL_DECLSPEC void SDLCALL SDL_ParallelSort(void *base, size_t nmemb, size_t size, SDL_CompareCallback_r compare, void *userdata, int num_threads);
+
 /**
  * Compute the absolute value of `x`.
  *
@@ -2602,6 +2744,32 @@ extern SDL_DECLSPEC Uint32 SDLCALL SDL_crc32(Uint32 crc, const void *data, size_
  */
 extern SDL_DECLSPEC Uint32 SDLCALL SDL_murmur3_32(const void *data, size_t len, Uint32 seed);
 
+/**
+ * Calculate a 64-bit MurmurHash3 value for a block of data.
+ *
+ * https://en.wikipedia.org/wiki/MurmurHash
+ *
+ * This is the first half of the 128-bit result of the x64 variant of
+ * MurmurHash3 (MurmurHash3_x64_128), which works on 8 bytes at a time and is
+ * much faster than SDL_murmur3_32() on 64-bit CPUs. For seeds that fit in 32
+ * bits, it gives the same value as the reference implementation.
+ *
+ * As with SDL_murmur3_32(), you can't feed a previous result back in as the
+ * seed to hash data in chunks, and this is not cryptographically secure.
+ *
+ * \param data the data to be hashed.
+ * \param len the size of data, in bytes.
+ * \param seed a value that alters the final hash value.
+ * \returns a Murmur3 64-bit hash value.
+ *
+ * \threadsafety It is safe to call this function from any thread.
+ *
+ * \since This function is available since SDL 3.6.0.
+ *
+ * \sa SDL_murmur3_32
+ */
+extern SDL_DECLSPEC Uint64 SDLCALL SDL_murmur3_64(const void *data, size_t len, Uint64 seed);
+
 /**
  * Copy non-overlapping memory.
  *
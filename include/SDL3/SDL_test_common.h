@@ -157,6 +157,11 @@ typedef struct
     int quit_after_ms_interval;
     SDL_TimerID quit_after_ms_timer;
 
+    /* Event recording and replay */
+    const char *record_events_file;
+    const char *replay_events_file;
+    float replay_speed;
+
     /* Options info */
     SDLTest_ArgumentParser common_argparser;
     SDLTest_ArgumentParser video_argparser;
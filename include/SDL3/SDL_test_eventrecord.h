@@ -0,0 +1,112 @@
+/*
+  Simple DirectMedia Layer
+  Copyright (C) 1997-2026 Sam Lantinga <slouken@libsdl.org>
+
+  This software is provided 'as-is', without any express or implied
+  warranty.  In no event will the authors be held liable for any damages
+  arising from the use of this software.
+
+  Permission is granted to anyone to use this software for any purpose,
+  including commercial applications, and to alter it and redistribute it
+  freely, subject to the following restrictions:
+
+  1. The origin of this software must not be misrepresented; you must not
+     claim that you wrote the original software. If you use this software
+     in a product, an acknowledgment in the product documentation would be
+     appreciated but is not required.
+  2. Altered source versions must be plainly marked as such, and must not be
+     misrepresented as being the original software.
+  3. This notice may not be removed or altered from any source distribution.
+*/
+
+/**
+ *  Event recording and replay functions of SDL test framework.
+ *
+ *  This code is a part of the SDL test library, not the main SDL library.
+ */
+
+/*
+
+ Records the events an application receives to a stream and pushes them
+ back later with their original spacing in time, or faster, so that an
+ input session can be repeated as a benchmark or regression test, for
+ instance under the dummy or offscreen video driver.
+
+ Recordings hold the raw SDL_Event structures, so they can only be replayed
+ with the same SDL version on the same platform. Strings attached to events
+ (text input, drops, clipboard MIME types) are saved with them, user event
+ data pointers are not.
+
+*/
+
+#ifndef SDL_test_eventrecord_h_
+#define SDL_test_eventrecord_h_
+
+#include <SDL3/SDL_stdinc.h>
+#include <SDL3/SDL_iostream.h>
+
+#include <SDL3/SDL_begin_code.h>
+/* Set up for C function definitions, even when using C++ */
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * Start recording the events added to the event queue.
+ *
+ * Only one recording can be in progress at a time. Events are buffered and
+ * written to the stream in chunks, and when the recording is stopped.
+ *
+ * \param dst the stream to write the recording to.
+ * \param closeio true to close the stream when the recording is stopped.
+ *
+ * \returns true on success or false on failure; call SDL_GetError() for more information.
+ */
+bool SDLCALL SDLTest_StartEventRecording(SDL_IOStream *dst, bool closeio);
+
+/**
+ * Stop recording events and write out whatever is left.
+ *
+ * \returns true if the whole recording was written successfully or false on failure; call SDL_GetError() for more information.
+ */
+bool SDLCALL SDLTest_StopEventRecording(void);
+
+/**
+ * Start pushing the events of a recording with SDL_PushEvent().
+ *
+ * Events are pushed from a separate thread, at the same times relative to
+ * the start of the replay as they were relative to the start of the
+ * recording, divided by `speed`. Their timestamps are set to the time they
+ * were scheduled for. Replayed events don't change the state SDL keeps
+ * itself, like the keyboard state or the window size.
+ *
+ * Only one replay can be in progress at a time. Strings attached to the
+ * replayed events stay valid until the replay is stopped.
+ *
+ * \param src the stream to read the recording from.
+ * \param closeio true to close the stream when the replay is stopped.
+ * \param speed how much faster than real time to go, 1.0f for the original timing.
+ *
+ * \returns true on success or false on failure; call SDL_GetError() for more information.
+ */
+bool SDLCALL SDLTest_StartEventReplay(SDL_IOStream *src, bool closeio, float speed);
+
+/**
+ * Check whether all the events of the replay have been pushed.
+ *
+ * \returns true if the replay is finished or isn't running, false otherwise.
+ */
+bool SDLCALL SDLTest_IsEventReplayDone(void);
+
+/**
+ * Stop pushing events and free the replay.
+ */
+void SDLCALL SDLTest_StopEventReplay(void);
+
+/* Ends C function definitions when using C++ */
+#ifdef __cplusplus
+}
+#endif
+#include <SDL3/SDL_close_code.h>
+
+#endif /* SDL_test_eventrecord_h_ */
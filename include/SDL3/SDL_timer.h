@@ -33,9 +33,9 @@
  *
  * This category covers measuring time elapsed (SDL_GetTicks(),
  * SDL_GetPerformanceCounter()), putting a thread to sleep for a certain
- * amount of time (SDL_Delay(), SDL_DelayNS(), SDL_DelayPrecise()), and firing
- * a callback function after a certain amount of time has elapsed
- * (SDL_AddTimer(), etc).
+ * amount of time (SDL_Delay(), SDL_DelayNS(), SDL_DelayPrecise()), pacing a
+ * loop to a fixed period (SDL_CreateFramePacer()), and firing a callback
+ * function after a certain amount of time has elapsed (SDL_AddTimer(), etc).
  *
  * There are also useful macros to convert between time units, like
  * SDL_SECONDS_TO_NS() and such.
@@ -298,6 +298,173 @@ extern SDL_DECLSPEC void SDLCALL SDL_DelayNS(Uint64 ns);
  */
 extern SDL_DECLSPEC void SDLCALL SDL_DelayPrecise(Uint64 ns);
 
+/**
+ * An object that paces a loop to a fixed period.
+ *
+ * \since This struct is available since SDL 3.6.0.
+ *
+ * \sa SDL_CreateFramePacer
+ */
+typedef struct SDL_FramePacer SDL_FramePacer;
+
+/**
+ * Timing statistics collected by a frame pacer.
+ *
+ * \since This struct is available since SDL 3.6.0.
+ *
+ * \sa SDL_GetFramePacerStats
+ */
+typedef struct SDL_FramePacerStats
+{
+    Uint64 frames;              /**< the number of times SDL_WaitFramePacer() was called */
+    Uint64 missed_frames;       /**< the number of frame deadlines that passed before SDL_WaitFramePacer() was called for them */
+    Uint64 average_jitter_ns;   /**< the average time between a frame deadline and SDL_WaitFramePacer() returning for it */
+    Uint64 max_jitter_ns;       /**< the longest time between a frame deadline and SDL_WaitFramePacer() returning for it */
+    Uint64 sleep_overshoot_ns;  /**< how much longer than requested the OS is currently expected to sleep */
+} SDL_FramePacerStats;
+
+/**
+ * Create a frame pacer.
+ *
+ * A frame pacer waits for evenly spaced deadlines, one period apart. Unlike
+ * calling SDL_DelayPrecise() with the time left in a frame, the deadlines
+ * don't drift with the time spent in the loop or with imprecise waits.
+ *
+ * The pacer sleeps for most of the time left before a deadline and spins for
+ * the rest. It measures how much the OS oversleeps as it goes, and stops
+ * sleeping that much earlier, so little time is spent spinning.
+ *
+ * The first deadline is one period after the pacer is created.
+ *
+ * \param period_ns the time between frames, in nanoseconds.
+ * \returns the new frame pacer or NULL on failure; call SDL_GetError() for
+ *          more information.
+ *
+ * \threadsafety It is safe to call this function from any thread.
+ *
+ * \since This function is available since SDL 3.6.0.
+ *
+ * \sa SDL_DestroyFramePacer
+ * \sa SDL_SetFramePacerRefreshRate
+ * \sa SDL_WaitFramePacer
+ */
+extern SDL_DECLSPEC SDL_FramePacer * SDLCALL SDL_CreateFramePacer(Uint64 period_ns);
+
+/**
+ * Change the period of a frame pacer.
+ *
+ * The next deadline is one new period after the last deadline the pacer
+ * waited for.
+ *
+ * \param pacer the frame pacer to change.
+ * \param period_ns the time between frames, in nanoseconds.
+ * \returns true on success or false on failure; call SDL_GetError() for more
+ *          information.
+ *
+ * \threadsafety This function should not be called while another thread is
+ *               using the same frame pacer.
+ *
+ * \since This function is available since SDL 3.6.0.
+ *
+ * \sa SDL_SetFramePacerRefreshRate
+ */
+extern SDL_DECLSPEC bool SDLCALL SDL_SetFramePacerPeriod(SDL_FramePacer *pacer, Uint64 period_ns);
+
+/**
+ * Set the period of a frame pacer to match a display refresh rate.
+ *
+ * The refresh rate is given as a fraction, like the
+ * `refresh_rate_numerator` and `refresh_rate_denominator` fields of
+ * SDL_DisplayMode, so rates like 59.94 Hz (60000 / 1001) are paced exactly,
+ * without rounding the period to a whole number of nanoseconds.
+ *
+ * \param pacer the frame pacer to change.
+ * \param numerator the refresh rate numerator.
+ * \param denominator the refresh rate denominator, or 0 for 1.
+ * \returns true on success or false on failure; call SDL_GetError() for more
+ *          information.
+ *
+ * \threadsafety This function should not be called while another thread is
+ *               using the same frame pacer.
+ *
+ * \since This function is available since SDL 3.6.0.
+ *
+ * \sa SDL_SetFramePacerPeriod
+ */
+extern SDL_DECLSPEC bool SDLCALL SDL_SetFramePacerRefreshRate(SDL_FramePacer *pacer, int numerator, int denominator);
+
+/**
+ * Wait for the next frame deadline.
+ *
+ * If the next deadline hasn't passed yet, this waits for it and returns 1.
+ *
+ * If one or more deadlines have already passed, this returns right away
+ * with the number of deadlines that passed since the previous call, and the
+ * pacer moves on to the deadline after the last of them instead of trying to
+ * catch up. A fixed-step simulation can run that many steps, and a render loop
+ * can ignore the value.
+ *
+ * \param pacer the frame pacer to wait on.
+ * \returns the number of frame periods since the previous call, at least 1,
+ *          or -1 on failure; call SDL_GetError() for more information.
+ *
+ * \threadsafety This function should not be called while another thread is
+ *               using the same frame pacer.
+ *
+ * \since This function is available since SDL 3.6.0.
+ *
+ * \sa SDL_CreateFramePacer
+ * \sa SDL_ResetFramePacer
+ */
+extern SDL_DECLSPEC int SDLCALL SDL_WaitFramePacer(SDL_FramePacer *pacer);
+
+/**
+ * Restart a frame pacer from the current time.
+ *
+ * The next deadline is one period from now, and the statistics are cleared.
+ * This is useful after a loop has been paused, so the time spent paused isn't
+ * counted as missed frames.
+ *
+ * \param pacer the frame pacer to reset.
+ * \returns true on success or false on failure; call SDL_GetError() for more
+ *          information.
+ *
+ * \threadsafety This function should not be called while another thread is
+ *               using the same frame pacer.
+ *
+ * \since This function is available since SDL 3.6.0.
+ */
+extern SDL_DECLSPEC bool SDLCALL SDL_ResetFramePacer(SDL_FramePacer *pacer);
+
+/**
+ * Get the timing statistics of a frame pacer.
+ *
+ * \param pacer the frame pacer to query.
+ * \param stats a pointer filled in with the statistics.
+ * \returns true on success or false on failure; call SDL_GetError() for more
+ *          information.
+ *
+ * \threadsafety This function should not be called while another thread is
+ *               using the same frame pacer.
+ *
+ * \since This function is available since SDL 3.6.0.
+ */
+extern SDL_DECLSPEC bool SDLCALL SDL_GetFramePacerStats(SDL_FramePacer *pacer, SDL_FramePacerStats *stats);
+
+/**
+ * Destroy a frame pacer.
+ *
+ * \param pacer the frame pacer to destroy, may be NULL.
+ *
+ * \threadsafety No other thread should be using the frame pacer when it is
+ *               destroyed.
+ *
+ * \since This function is available since SDL 3.6.0.
+ *
+ * \sa SDL_CreateFramePacer
+ */
+extern SDL_DECLSPEC void SDLCALL SDL_DestroyFramePacer(SDL_FramePacer *pacer);
+
 /**
  * Definition of the timer ID type.
  *
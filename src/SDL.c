@@ -53,6 +53,7 @@
 #include "render/SDL_sysrender.h"
 #include "sensor/SDL_sensor_c.h"
 #include "stdlib/SDL_getenv_c.h"
+#include "stdlib/SDL_malloc_c.h"
 #include "thread/SDL_thread_c.h"
 #include "tray/SDL_tray_utils.h"
 #include "video/SDL_pixels_c.h"
@@ -310,6 +311,7 @@ void SDL_InitMainThread(void)
     SDL_InitTicks();
     SDL_InitFilesystem();
     SDL_CreateEventLock();
+    SDL_InitMallocCache();
 
     if (!done_info) {
         const char *value;
@@ -748,6 +750,7 @@ void SDL_Quit(void)
     SDL_zeroa(SDL_SubsystemRefCount);
 
     SDL_QuitLog();
+    SDL_QuitMallocCache();
     SDL_QuitHints();
     SDL_QuitProperties();
 
@@ -19,37 +19,224 @@
   3. This notice may not be removed or altered from any source distribution.
 */
 #include "SDL_internal.h"
+#include "stdlib/SDL_malloc_c.h"
 
-typedef struct SDL_HashItem
+/* The table is laid out like the "Swiss tables" in Abseil: there is one control
+   byte per slot, kept in its own array, and keys and values are kept in two more
+   parallel arrays. A control byte is either one of the markers below (high bit set)
+   or the low 7 bits of the hash of the key in that slot (high bit clear).
+
+   Lookups probe a whole group of 16 control bytes at once, with SSE2 or NEON when
+   available, and only touch the keys whose control byte matches. A group with an
+   empty slot in it ends the probe sequence, so most misses are decided without
+   looking at a single key. */
+
+#define CTRL_EMPTY    ((Uint8)0x80)   // never used since the last rehash
+#define CTRL_DELETED  ((Uint8)0xFE)   // a tombstone left behind by a removal
+#define CTRL_SENTINEL ((Uint8)0xFF)   // padding past the end of tables smaller than a group
+
+#define GROUP_WIDTH 16u
+
+// Anything larger than this will cause integer overflows
+#define MAX_HASHTABLE_SIZE (0x80000000u / 32u)
+
+#if defined(SDL_SSE2_INTRINSICS) && (defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && (_M_IX86_FP >= 2)))
+#define HASHTABLE_SSE2 1
+#elif defined(SDL_NEON_INTRINSICS) && (defined(__aarch64__) || defined(_M_ARM64))
+#define HASHTABLE_NEON 1
+#endif
+
+// The control bytes, keys and values of a table, allocated as one block
+typedef struct SDL_HashSlots
+{
+    Uint32 capacity;    // number of slots, a power of 2
+    Uint32 group_mask;  // number of groups - 1
+    Uint8 *ctrl;        // SDL_max(capacity, GROUP_WIDTH) control bytes
+    const void **keys;
+    const void **values;
+} SDL_HashSlots;
+
+// Something a lock-free table can't free until no reader can be looking at it
+typedef struct SDL_HashRetired
 {
-    // TODO: Splitting off values into a separate array might be more cache-friendly
+    SDL_HashSlots *slots;   // if not NULL, an old block of slots, otherwise a removed item
+    bool destroy_contents;  // the full slots in the block hold items that were cleared out
     const void *key;
     const void *value;
-    Uint32 hash;
-    Uint32 probe_len : 31;
-    Uint32 live : 1;
-} SDL_HashItem;
+} SDL_HashRetired;
 
-// Must be a power of 2 >= sizeof(SDL_HashItem)
-#define MAX_HASHITEM_SIZEOF 32u
-SDL_COMPILE_TIME_ASSERT(sizeof_SDL_HashItem, sizeof(SDL_HashItem) <= MAX_HASHITEM_SIZEOF);
+/* Readers of a lock-free table announce themselves in one of its counters, picked
+   with SDL_GetThreadStripe(). There are two sets of counters and the table's epoch
+   says which one new readers join. A writer flips the epoch and waits for the other
+   set to drain, which nobody joins anymore, so steady lookups can't keep a writer
+   waiting forever. */
+#define NUM_READER_STRIPES SDL_NUM_THREAD_STRIPES
 
-// Anything larger than this will cause integer overflows
-#define MAX_HASHTABLE_SIZE (0x80000000u / (MAX_HASHITEM_SIZEOF))
+typedef struct SDL_HashReaderStripe
+{
+    SDL_AtomicInt count;
+    char cache_pad[SDL_CACHELINE_SIZE - sizeof(SDL_AtomicInt)];
+} SDL_HashReaderStripe;
 
 struct SDL_HashTable
 {
-    SDL_RWLock *lock;  // NULL if not created threadsafe
-    SDL_HashItem *table;
+    SDL_RWLock *lock;     // NULL if not created threadsafe
+    SDL_HashSlots *slots; // swapped atomically if lockfree
     SDL_HashCallback hash;
     SDL_HashKeyMatchCallback keymatch;
     SDL_HashDestroyCallback destroy;
     void *userdata;
-    Uint32 hash_mask;
-    Uint32 max_probe_len;
+    Uint32 growth_left;   // empty slots we may still fill before a rehash
     Uint32 num_occupied_slots;
+    bool lockfree;        // lookups don't take the lock, see SDL_CreateLockFreeHashTable()
+    SDL_HashRetired *retired;
+    int num_retired;
+    int max_retired;
+    SDL_AtomicU32 epoch;  // picks which half of readers new lock-free readers count themselves in
+    SDL_HashReaderStripe *readers;  // two halves of NUM_READER_STRIPES counters if lockfree
 };
 
+// If this many things are waiting to be freed, a writer waits for the readers to drain
+#define MAX_RETIRED_BEFORE_WAIT 256
+
+/* A GroupMask has one bit set for each slot of a group that matched. On NEON we
+   get four bits per slot out of the comparison, so the slot index is scaled. */
+#ifdef HASHTABLE_NEON
+typedef Uint64 GroupMask;
+#define GROUP_MASK_SHIFT 2
+#else
+typedef Uint32 GroupMask;
+#define GROUP_MASK_SHIFT 0
+#endif
+
+static SDL_INLINE Uint32 lowest_slot(GroupMask mask)
+{
+#if defined(__GNUC__) || defined(__clang__)
+    return (Uint32)((sizeof(mask) > 4) ? __builtin_ctzll(mask) : __builtin_ctz((Uint32)mask)) >> GROUP_MASK_SHIFT;
+#elif defined(_MSC_VER)
+    unsigned long index;
+#ifdef HASHTABLE_NEON
+    _BitScanForward64(&index, mask);
+#else
+    _BitScanForward(&index, mask);
+#endif
+    return (Uint32)index >> GROUP_MASK_SHIFT;
+#else
+    Uint32 index = 0;
+    while (!(mask & 1)) {
+        mask >>= 1;
+        ++index;
+    }
+    return index >> GROUP_MASK_SHIFT;
+#endif
+}
+
+#ifdef HASHTABLE_SSE2
+
+static SDL_INLINE GroupMask group_match(const Uint8 *ctrl, Uint8 h2)
+{
+    const __m128i group = _mm_loadu_si128((const __m128i *)ctrl);
+    return (GroupMask)_mm_movemask_epi8(_mm_cmpeq_epi8(group, _mm_set1_epi8((char)h2)));
+}
+
+static SDL_INLINE GroupMask group_match_empty(const Uint8 *ctrl)
+{
+    return group_match(ctrl, CTRL_EMPTY);
+}
+
+static SDL_INLINE GroupMask group_match_empty_or_deleted(const Uint8 *ctrl)
+{
+    // As signed bytes, both markers are less than CTRL_SENTINEL (-1) and every hash is >= 0.
+    const __m128i group = _mm_loadu_si128((const __m128i *)ctrl);
+    return (GroupMask)_mm_movemask_epi8(_mm_cmpgt_epi8(_mm_set1_epi8((char)CTRL_SENTINEL), group));
+}
+
+static SDL_INLINE GroupMask group_match_full(const Uint8 *ctrl)
+{
+    const __m128i group = _mm_loadu_si128((const __m128i *)ctrl);
+    return (GroupMask)(~_mm_movemask_epi8(group) & 0xFFFF);
+}
+
+#elif defined(HASHTABLE_NEON)
+
+static SDL_INLINE GroupMask neon_mask(uint8x16_t matches)
+{
+    // Narrow each 0x00/0xFF byte to a nibble, then keep one bit per nibble.
+    const uint8x8_t nibbles = vshrn_n_u16(vreinterpretq_u16_u8(matches), 4);
+    return vget_lane_u64(vreinterpret_u64_u8(nibbles), 0) & 0x8888888888888888ull;
+}
+
+static SDL_INLINE GroupMask group_match(const Uint8 *ctrl, Uint8 h2)
+{
+    return neon_mask(vceqq_u8(vld1q_u8(ctrl), vdupq_n_u8(h2)));
+}
+
+static SDL_INLINE GroupMask group_match_empty(const Uint8 *ctrl)
+{
+    return group_match(ctrl, CTRL_EMPTY);
+}
+
+static SDL_INLINE GroupMask group_match_empty_or_deleted(const Uint8 *ctrl)
+{
+    return neon_mask(vcltq_s8(vreinterpretq_s8_u8(vld1q_u8(ctrl)), vdupq_n_s8((int8_t)CTRL_SENTINEL)));
+}
+
+static SDL_INLINE GroupMask group_match_full(const Uint8 *ctrl)
+{
+    return neon_mask(vcgeq_s8(vreinterpretq_s8_u8(vld1q_u8(ctrl)), vdupq_n_s8(0)));
+}
+
+#else
+
+/* Portable version, working on 8 control bytes at a time packed into a Uint64.
+   This is the same bit trickery that Abseil uses when it has no SIMD to work with. */
+
+#define SWAR_LSBS 0x0101010101010101ull
+#define SWAR_MSBS 0x8080808080808080ull
+
+static SDL_INLINE Uint64 swar_load(const Uint8 *ctrl)
+{
+    Uint64 word;
+    SDL_memcpy(&word, ctrl, sizeof(word));
+    return SDL_Swap64LE(word);
+}
+
+// Gather the high bit of each byte into an 8-bit mask
+static SDL_INLINE GroupMask swar_pack(Uint64 bits)
+{
+    return (GroupMask)((((bits & SWAR_MSBS) >> 7) * 0x0102040810204080ull) >> 56);
+}
+
+static SDL_INLINE GroupMask group_match(const Uint8 *ctrl, Uint8 h2)
+{
+    // This can report false positives, but only right after a real match; we compare keys anyhow.
+    const Uint64 lo = swar_load(ctrl) ^ (SWAR_LSBS * h2);
+    const Uint64 hi = swar_load(ctrl + 8) ^ (SWAR_LSBS * h2);
+    return swar_pack((lo - SWAR_LSBS) & ~lo) | (swar_pack((hi - SWAR_LSBS) & ~hi) << 8);
+}
+
+static SDL_INLINE GroupMask group_match_empty(const Uint8 *ctrl)
+{
+    // Empty is the only marker with bit 1 clear
+    const Uint64 lo = swar_load(ctrl);
+    const Uint64 hi = swar_load(ctrl + 8);
+    return swar_pack(lo & ~(lo << 6)) | (swar_pack(hi & ~(hi << 6)) << 8);
+}
+
+static SDL_INLINE GroupMask group_match_empty_or_deleted(const Uint8 *ctrl)
+{
+    // The sentinel is the only marker with bit 0 set
+    const Uint64 lo = swar_load(ctrl);
+    const Uint64 hi = swar_load(ctrl + 8);
+    return swar_pack(lo & ~(lo << 7)) | (swar_pack(hi & ~(hi << 7)) << 8);
+}
+
+static SDL_INLINE GroupMask group_match_full(const Uint8 *ctrl)
+{
+    return ~(swar_pack(swar_load(ctrl)) | (swar_pack(swar_load(ctrl + 8)) << 8)) & 0xFFFF;
+}
+
+#endif // HASHTABLE_SSE2
 
 static Uint32 CalculateHashBucketsFromEstimate(int estimated_capacity)
 {
@@ -57,21 +244,64 @@ static Uint32 CalculateHashBucketsFromEstimate(int estimated_capacity)
         return 4;  // start small, grow as necessary.
     }
 
-    const Uint32 estimated32 = (Uint32) estimated_capacity;
+    // Leave room for the maximum load factor of 7/8
+    const Uint32 estimated32 = (Uint32)SDL_min((Uint64)estimated_capacity * 8 / 7, MAX_HASHTABLE_SIZE);
     Uint32 buckets = ((Uint32) 1) << SDL_MostSignificantBitIndex32(estimated32);
     if (!SDL_HasExactlyOneBitSet32(estimated32)) {
         buckets <<= 1;  // need next power of two up to fit overflow capacity bits.
     }
 
-    return SDL_min(buckets, MAX_HASHTABLE_SIZE);
+    return SDL_min(SDL_max(buckets, 4), MAX_HASHTABLE_SIZE);
 }
 
-SDL_HashTable *SDL_CreateHashTable(int estimated_capacity, bool threadsafe, SDL_HashCallback hash,
+static SDL_INLINE Uint32 max_items(Uint32 capacity)
+{
+    return capacity - (capacity / 8) - ((capacity < 8) ? 1 : 0);
+}
+
+static void reset_ctrl(Uint8 *ctrl, Uint32 capacity)
+{
+    SDL_memset(ctrl, CTRL_EMPTY, capacity);
+    if (capacity < GROUP_WIDTH) {
+        SDL_memset(ctrl + capacity, CTRL_SENTINEL, GROUP_WIDTH - capacity);
+    }
+}
+
+static size_t slots_size(Uint32 capacity)
+{
+    return sizeof(SDL_HashSlots) + SDL_max(capacity, GROUP_WIDTH) + 2 * sizeof(void *) * capacity;
+}
+
+static void free_slots(SDL_HashSlots *slots)
+{
+    if (slots) {
+        SDL_free_tagged(SDL_MEMORY_TAG_HASHTABLE, slots, slots_size(slots->capacity));
+    }
+}
+
+static SDL_HashSlots *alloc_slots(Uint32 capacity)
+{
+    const size_t ctrl_size = SDL_max(capacity, GROUP_WIDTH);
+    SDL_HashSlots *slots = (SDL_HashSlots *)SDL_malloc_tagged(SDL_MEMORY_TAG_HASHTABLE, slots_size(capacity));
+    if (!slots) {
+        return NULL;
+    }
+
+    slots->capacity = capacity;
+    slots->group_mask = (capacity <= GROUP_WIDTH) ? 0 : (capacity / GROUP_WIDTH) - 1;
+    slots->ctrl = (Uint8 *)(slots + 1);
+    slots->keys = (const void **)(slots->ctrl + ctrl_size);
+    slots->values = slots->keys + capacity;
+    reset_ctrl(slots->ctrl, capacity);
+    return slots;
+}
+
+static SDL_HashTable *create_table(int estimated_capacity, bool threadsafe, bool lockfree, SDL_HashCallback hash,
                                    SDL_HashKeyMatchCallback keymatch,
                                    SDL_HashDestroyCallback destroy, void *userdata)
 {
     const Uint32 num_buckets = CalculateHashBucketsFromEstimate(estimated_capacity);
-    SDL_HashTable *table = (SDL_HashTable *)SDL_calloc(1, sizeof(SDL_HashTable));
+    SDL_HashTable *table = (SDL_HashTable *)SDL_calloc_tagged(SDL_MEMORY_TAG_HASHTABLE, 1, sizeof(SDL_HashTable));
     if (!table) {
         return NULL;
     }
@@ -84,13 +314,22 @@ SDL_HashTable *SDL_CreateHashTable(int estimated_capacity, bool threadsafe, SDL_
         }
     }
 
-    table->table = (SDL_HashItem *)SDL_calloc(num_buckets, sizeof(SDL_HashItem));
-    if (!table->table) {
+    if (lockfree) {
+        table->readers = (SDL_HashReaderStripe *)SDL_calloc_tagged(SDL_MEMORY_TAG_HASHTABLE, 2 * NUM_READER_STRIPES, sizeof(SDL_HashReaderStripe));
+        if (!table->readers) {
+            SDL_DestroyHashTable(table);
+            return NULL;
+        }
+    }
+
+    table->slots = alloc_slots(num_buckets);
+    if (!table->slots) {
         SDL_DestroyHashTable(table);
         return NULL;
     }
 
-    table->hash_mask = num_buckets - 1;
+    table->growth_left = max_items(num_buckets);
+    table->lockfree = lockfree;
     table->userdata = userdata;
     table->hash = hash;
     table->keymatch = keymatch;
@@ -98,195 +337,322 @@ SDL_HashTable *SDL_CreateHashTable(int estimated_capacity, bool threadsafe, SDL_
     return table;
 }
 
+SDL_HashTable *SDL_CreateHashTable(int estimated_capacity, bool threadsafe, SDL_HashCallback hash,
+                                   SDL_HashKeyMatchCallback keymatch,
+                                   SDL_HashDestroyCallback destroy, void *userdata)
+{
+    return create_table(estimated_capacity, threadsafe, false, hash, keymatch, destroy, userdata);
+}
+
+SDL_HashTable *SDL_CreateLockFreeHashTable(int estimated_capacity, SDL_HashCallback hash,
+                                           SDL_HashKeyMatchCallback keymatch,
+                                           SDL_HashDestroyCallback destroy, void *userdata)
+{
+    return create_table(estimated_capacity, true, true, hash, keymatch, destroy, userdata);
+}
+
 static SDL_INLINE Uint32 calc_hash(const SDL_HashTable *table, const void *key)
 {
     const Uint32 BitMixer = 0x9E3779B1u;
     return table->hash(table->userdata, key) * BitMixer;
 }
 
-static SDL_INLINE Uint32 get_probe_length(Uint32 zero_idx, Uint32 actual_idx, Uint32 num_buckets)
+// The low bits of the hash pick the first group, the top 7 bits go in the control byte
+#define HASH_GROUP(hash) (hash)
+#define HASH_CTRL(hash) ((Uint8)((hash) >> 25))
+
+static SDL_INLINE SDL_AtomicInt *enter_reader(const SDL_HashTable *ht)
 {
-    // returns the probe sequence length from zero_idx to actual_idx
-    if (actual_idx < zero_idx) {
-        return num_buckets - zero_idx + actual_idx;
+    const Uint32 stripe = SDL_GetThreadStripe();
+    SDL_AtomicU32 *table_epoch = (SDL_AtomicU32 *)&ht->epoch;
+    for (;;) {
+        const Uint32 epoch = SDL_GetAtomicU32(table_epoch);
+        SDL_AtomicInt *count = &ht->readers[(epoch & 1) * NUM_READER_STRIPES + stripe].count;
+        SDL_AddAtomicInt(count, 1);
+        if (SDL_GetAtomicU32(table_epoch) == epoch) {
+            return count;
+        }
+        // A writer flipped the epoch under us and might not see us in this half, try again.
+        SDL_AddAtomicInt(count, -1);
     }
-
-    return actual_idx - zero_idx;
 }
 
-static SDL_HashItem *find_item(const SDL_HashTable *ht, const void *key, Uint32 hash, Uint32 *i, Uint32 *probe_len)
+static SDL_INLINE void leave_reader(SDL_AtomicInt *count)
 {
-    Uint32 hash_mask = ht->hash_mask;
-    Uint32 max_probe_len = ht->max_probe_len;
-
-    SDL_HashItem *table = ht->table;
-
-    while (true) {
-        SDL_HashItem *item = table + *i;
-        Uint32 item_hash = item->hash;
+    SDL_AddAtomicInt(count, -1);
+}
 
-        if (!item->live) {
-            return NULL;
+static bool wait_for_reader_half(SDL_HashTable *ht, Uint32 half, bool wait)
+{
+    SDL_HashReaderStripe *readers = &ht->readers[half * NUM_READER_STRIPES];
+    for (int i = 0; i < NUM_READER_STRIPES; ++i) {
+        // The compare-and-swap is a full barrier, so our earlier stores are visible to the next reader.
+        int spins = 0;
+        while (!SDL_CompareAndSwapAtomicInt(&readers[i].count, 0, 0)) {
+            if (!wait) {
+                return false;
+            }
+            if (++spins < 100) {
+                SDL_CPUPauseInstruction();
+            } else {
+                SDL_Delay(0);  // the reader might need our CPU to finish
+            }
         }
+    }
+    return true;
+}
 
-        if (item_hash == hash && ht->keymatch(ht->userdata, item->key, key)) {
-            return item;
-        }
+// Returns true once no reader that might have seen something unlinked before this call is left
+static bool wait_for_readers(SDL_HashTable *ht, bool wait)
+{
+    const Uint32 epoch = SDL_GetAtomicU32(&ht->epoch);
 
-        Uint32 item_probe_len = item->probe_len;
-        SDL_assert(item_probe_len == get_probe_length(item_hash & hash_mask, (Uint32)(item - table), hash_mask + 1));
+    // Readers left over from before the last flip have to be gone before we reuse their half.
+    if (!wait_for_reader_half(ht, (epoch + 1) & 1, wait)) {
+        return false;
+    }
+    SDL_SetAtomicU32(&ht->epoch, epoch + 1);
+    return wait_for_reader_half(ht, epoch & 1, wait);
+}
 
-        if (*probe_len > item_probe_len) {
-            return NULL;
+static void destroy_slots(SDL_HashTable *ht, SDL_HashSlots *slots)
+{
+    SDL_HashDestroyCallback destroy = ht->destroy;
+    if (destroy) {
+        void *userdata = ht->userdata;
+        for (Uint32 i = 0; i < slots->capacity; ++i) {
+            if (!(slots->ctrl[i] & 0x80)) {
+                slots->ctrl[i] = CTRL_DELETED;
+                destroy(userdata, slots->keys[i], slots->values[i]);
+            }
         }
+    }
+}
 
-        if (++*probe_len > max_probe_len) {
-            return NULL;
+static void free_retired(SDL_HashTable *ht)
+{
+    for (int i = 0; i < ht->num_retired; ++i) {
+        SDL_HashRetired *retired = &ht->retired[i];
+        if (retired->slots) {
+            if (retired->destroy_contents) {
+                destroy_slots(ht, retired->slots);
+            }
+            free_slots(retired->slots);
+        } else {
+            ht->destroy(ht->userdata, retired->key, retired->value);
         }
-
-        *i = (*i + 1) & hash_mask;
     }
+    ht->num_retired = 0;
 }
 
-static SDL_HashItem *find_first_item(const SDL_HashTable *ht, const void *key, Uint32 hash)
+// Frees whatever lock-free readers can't see anymore, called with the write lock held
+static void reclaim_retired(SDL_HashTable *ht)
 {
-    Uint32 i = hash & ht->hash_mask;
-    Uint32 probe_len = 0;
-    return find_item(ht, key, hash, &i, &probe_len);
+    if (ht->num_retired > 0 && wait_for_readers(ht, ht->num_retired >= MAX_RETIRED_BEFORE_WAIT)) {
+        free_retired(ht);
+    }
 }
 
-static SDL_HashItem *insert_item(SDL_HashItem *item_to_insert, SDL_HashItem *table, Uint32 hash_mask, Uint32 *max_probe_len_ptr)
+static void retire(SDL_HashTable *ht, SDL_HashSlots *slots, bool destroy_contents, const void *key, const void *value)
 {
-    const Uint32 num_buckets = hash_mask + 1;
-    Uint32 idx = item_to_insert->hash & hash_mask;
-    SDL_HashItem *target = NULL;
-    SDL_HashItem temp_item;
-
-    while (true) {
-        SDL_HashItem *candidate = table + idx;
-
-        if (!candidate->live) {
-            // Found an empty slot. Put it here and we're done.
-            *candidate = *item_to_insert;
-
-            if (target == NULL) {
-                target = candidate;
-            }
-
-            const Uint32 probe_len = get_probe_length(candidate->hash & hash_mask, idx, num_buckets);
-            candidate->probe_len = probe_len;
-
-            if (*max_probe_len_ptr < probe_len) {
-                *max_probe_len_ptr = probe_len;
+    if (ht->num_retired == ht->max_retired) {
+        const int max_retired = ht->max_retired ? ht->max_retired * 2 : 16;
+        SDL_HashRetired *retired = (SDL_HashRetired *)SDL_realloc(ht->retired, max_retired * sizeof(*retired));
+        if (!retired) {
+            // No room to put it off, wait until it's safe to free everything right now.
+            wait_for_readers(ht, true);
+            free_retired(ht);
+            if (slots) {
+                if (destroy_contents) {
+                    destroy_slots(ht, slots);
+                }
+                free_slots(slots);
+            } else {
+                ht->destroy(ht->userdata, key, value);
             }
-
-            break;
+            return;
         }
+        ht->retired = retired;
+        ht->max_retired = max_retired;
+    }
 
-        const Uint32 candidate_probe_len = candidate->probe_len;
-        SDL_assert(candidate_probe_len == get_probe_length(candidate->hash & hash_mask, idx, num_buckets));
-        const Uint32 new_probe_len = get_probe_length(item_to_insert->hash & hash_mask, idx, num_buckets);
+    SDL_HashRetired *retired = &ht->retired[ht->num_retired++];
+    retired->slots = slots;
+    retired->destroy_contents = destroy_contents;
+    retired->key = key;
+    retired->value = value;
+}
 
-        if (candidate_probe_len < new_probe_len) {
-            // Robin Hood hashing: the item at idx has a better probe length than our item would at this position.
-            // Evict it and put our item in its place, then continue looking for a new spot for the displaced item.
-            // This algorithm significantly reduces clustering in the table, making lookups take very few probes.
+static SDL_INLINE SDL_HashSlots *get_slots(const SDL_HashTable *ht)
+{
+    if (ht->lockfree) {
+        return (SDL_HashSlots *)SDL_GetAtomicPointer((void **)&ht->slots);
+    }
+    return ht->slots;
+}
 
-            temp_item = *candidate;
-            *candidate = *item_to_insert;
+static void set_slots(SDL_HashTable *ht, SDL_HashSlots *slots)
+{
+    if (ht->lockfree) {
+        SDL_SetAtomicPointer((void **)&ht->slots, slots);
+    } else {
+        ht->slots = slots;
+    }
+}
 
-            if (target == NULL) {
-                target = candidate;
+/* Returns the slot holding key, or -1 if it isn't in the table. Lock-free readers
+   may race with a writer filling in a slot, so they need the control bytes to be
+   read before the key and value they guard. */
+static SDL_INLINE Sint32 find_slot(const SDL_HashTable *ht, const SDL_HashSlots *slots, const void *key, Uint32 hash, bool acquire)
+{
+    const Uint8 h2 = HASH_CTRL(hash);
+    const Uint32 group_mask = slots->group_mask;
+    Uint32 group = HASH_GROUP(hash) & group_mask;
+
+    // Triangular probing visits every group once, and the load factor guarantees an empty slot.
+    for (Uint32 stride = 1; stride <= group_mask + 1; ++stride) {
+        const Uint8 *ctrl = slots->ctrl + group * GROUP_WIDTH;
+        GroupMask match = group_match(ctrl, h2);
+        if (acquire && match) {
+            SDL_MemoryBarrierAcquire();
+        }
+        while (match) {
+            const Uint32 slot = group * GROUP_WIDTH + lowest_slot(match);
+            if (ht->keymatch(ht->userdata, slots->keys[slot], key)) {
+                return (Sint32)slot;
             }
+            match &= match - 1;
+        }
 
-            *item_to_insert = temp_item;
-
-            SDL_assert(new_probe_len == get_probe_length(candidate->hash & hash_mask, idx, num_buckets));
-            candidate->probe_len = new_probe_len;
-
-            if (*max_probe_len_ptr < new_probe_len) {
-                *max_probe_len_ptr = new_probe_len;
-            }
+        if (group_match_empty(ctrl)) {
+            return -1;
         }
 
-        idx = (idx + 1) & hash_mask;
+        group = (group + stride) & group_mask;
     }
-
-    return target;
+    return -1;
 }
 
-static void delete_item(SDL_HashTable *ht, SDL_HashItem *item)
+/* Returns the first slot along the probe sequence for hash that can take a new item.
+   Lock-free tables never reuse a tombstone, so a key and value are only ever written
+   once into a given block of slots and readers never see them change under them. */
+static Uint32 find_free_slot(const SDL_HashSlots *slots, Uint32 hash, bool reuse_deleted)
 {
-    const Uint32 hash_mask = ht->hash_mask;
-    SDL_HashItem *table = ht->table;
-
-    if (ht->destroy) {
-        ht->destroy(ht->userdata, item->key, item->value);
+    const Uint32 group_mask = slots->group_mask;
+    Uint32 group = HASH_GROUP(hash) & group_mask;
+
+    for (Uint32 stride = 1; ; ++stride) {
+        const Uint8 *ctrl = slots->ctrl + group * GROUP_WIDTH;
+        const GroupMask match = reuse_deleted ? group_match_empty_or_deleted(ctrl) : group_match_empty(ctrl);
+        if (match) {
+            return group * GROUP_WIDTH + lowest_slot(match);
+        }
+        SDL_assert(stride <= group_mask);
+        group = (group + stride) & group_mask;
     }
+}
+
+static void delete_slot(SDL_HashTable *ht, Uint32 slot)
+{
+    SDL_HashSlots *slots = ht->slots;
 
     SDL_assert(ht->num_occupied_slots > 0);
     ht->num_occupied_slots--;
 
-    Uint32 idx = (Uint32)(item - ht->table);
-
-    while (true) {
-        idx = (idx + 1) & hash_mask;
-        SDL_HashItem *next_item = table + idx;
+    /* A probe only ever moves past a group that had no empty slots in it. If this
+       group still has one, nothing was ever displaced past it and the slot can go
+       straight back to empty; otherwise it has to stay a tombstone until the next
+       rehash. */
+    Uint8 *group_ctrl = slots->ctrl + (slot & ~(GROUP_WIDTH - 1));
+    if (!ht->lockfree && group_match_empty(group_ctrl)) {
+        slots->ctrl[slot] = CTRL_EMPTY;
+        ht->growth_left++;
+    } else {
+        slots->ctrl[slot] = CTRL_DELETED;
+    }
 
-        if (next_item->probe_len < 1) {
-            SDL_zerop(item);
-            return;
+    if (ht->destroy) {
+        if (ht->lockfree) {
+            retire(ht, NULL, false, slots->keys[slot], slots->values[slot]);
+        } else {
+            ht->destroy(ht->userdata, slots->keys[slot], slots->values[slot]);
         }
-
-        *item = *next_item;
-        item->probe_len -= 1;
-        SDL_assert(item->probe_len < ht->max_probe_len);
-        item = next_item;
     }
 }
 
 static bool resize(SDL_HashTable *ht, Uint32 new_size)
 {
-    const Uint32 new_hash_mask = new_size - 1;
-    SDL_HashItem *new_table = SDL_calloc(new_size, sizeof(*new_table));
-
-    if (!new_table) {
+    SDL_HashSlots *new_slots = alloc_slots(new_size);
+    if (!new_slots) {
         return false;
     }
 
-    SDL_HashItem *old_table = ht->table;
-    const Uint32 old_size = ht->hash_mask + 1;
-
-    ht->max_probe_len = 0;
-    ht->hash_mask = new_hash_mask;
-    ht->table = new_table;
-
-    for (Uint32 i = 0; i < old_size; ++i) {
-        SDL_HashItem *item = old_table + i;
-        if (item->live) {
-            insert_item(item, new_table, new_hash_mask, &ht->max_probe_len);
+    SDL_HashSlots *old_slots = ht->slots;
+    for (Uint32 i = 0; i < old_slots->capacity; ++i) {
+        if (!(old_slots->ctrl[i] & 0x80)) {
+            const Uint32 hash = calc_hash(ht, old_slots->keys[i]);
+            const Uint32 slot = find_free_slot(new_slots, hash, false);
+            new_slots->ctrl[slot] = HASH_CTRL(hash);
+            new_slots->keys[slot] = old_slots->keys[i];
+            new_slots->values[slot] = old_slots->values[i];
         }
     }
 
-    SDL_free(old_table);
+    set_slots(ht, new_slots);
+    ht->growth_left = max_items(new_size) - ht->num_occupied_slots;
+
+    if (ht->lockfree) {
+        retire(ht, old_slots, false, NULL, NULL);
+    } else {
+        free_slots(old_slots);
+    }
     return true;
 }
 
 static bool maybe_resize(SDL_HashTable *ht)
 {
-    const Uint32 capacity = ht->hash_mask + 1;
+    if (ht->growth_left > 0) {
+        return true;
+    }
+
+    const Uint32 capacity = ht->slots->capacity;
+
+    // If most of the used up slots are tombstones, rehashing in place gets them back.
+    if (ht->num_occupied_slots <= max_items(capacity) / 2) {
+        return resize(ht, capacity);
+    }
 
     if (capacity >= MAX_HASHTABLE_SIZE) {
         return false;
     }
 
-    const Uint32 max_load_factor = 217; // range: 0-255; 217 is roughly 85%
-    const Uint32 resize_threshold = (Uint32)((max_load_factor * (Uint64)capacity) >> 8);
+    return resize(ht, capacity * 2);
+}
+
+// Puts a new item into a free slot, growing the table first if it needs to
+static bool insert_new(SDL_HashTable *ht, const void *key, const void *value, Uint32 hash)
+{
+    SDL_HashSlots *slots = ht->slots;
+    Uint32 slot = find_free_slot(slots, hash, !ht->lockfree);
 
-    if (ht->num_occupied_slots > resize_threshold) {
-        return resize(ht, capacity * 2);
+    if (slots->ctrl[slot] == CTRL_EMPTY && ht->growth_left == 0) {
+        if (!maybe_resize(ht)) {
+            return false;
+        }
+        slots = ht->slots;
+        slot = find_free_slot(slots, hash, !ht->lockfree);
     }
 
+    if (slots->ctrl[slot] == CTRL_EMPTY) {
+        ht->growth_left--;
+    }
+    slots->keys[slot] = key;
+    slots->values[slot] = value;
+    if (ht->lockfree) {
+        SDL_MemoryBarrierRelease();
+    }
+    slots->ctrl[slot] = HASH_CTRL(hash);
+    ht->num_occupied_slots++;
     return true;
 }
 
@@ -301,35 +667,43 @@ bool SDL_InsertIntoHashTable(SDL_HashTable *table, const void *key, const void *
     SDL_LockRWLockForWriting(table->lock);
 
     const Uint32 hash = calc_hash(table, key);
-    SDL_HashItem *item = find_first_item(table, key, hash);
-    bool do_insert = true;
+    SDL_HashSlots *slots = table->slots;
+    Sint32 existing = find_slot(table, slots, key, hash, false);
 
-    if (item) {
-        if (replace) {
-            delete_item(table, item);
-        } else {
+    if (existing >= 0) {
+        if (!replace) {
             SDL_SetError("key already exists and replace is disabled");
-            do_insert = false;
-        }
-    }
-
-    if (do_insert) {
-        SDL_HashItem new_item;
-        new_item.key = key;
-        new_item.value = value;
-        new_item.hash = hash;
-        new_item.live = true;
-        new_item.probe_len = 0;
-
-        table->num_occupied_slots++;
-
-        if (!maybe_resize(table)) {
-            table->num_occupied_slots--;
+        } else if (table->lockfree) {
+            /* Readers may be looking at the old slot, so the new item goes into a fresh one
+               and the old one is only tombstoned after that. Until then, a lookup finds
+               either of them, both are complete. Make room first, so the old slot can be
+               found again in the slots we end up inserting into. */
+            if (table->growth_left > 0 || maybe_resize(table)) {
+                if (table->slots != slots) {
+                    slots = table->slots;
+                    existing = find_slot(table, slots, key, hash, false);
+                }
+                result = insert_new(table, key, value, hash);
+                SDL_assert(result);
+                delete_slot(table, (Uint32)existing);
+            }
         } else {
-            // This never returns NULL
-            insert_item(&new_item, table->table, table->hash_mask, &table->max_probe_len);
+            // Reuse the slot, the key still hashes to the same place
+            const void *old_key = slots->keys[existing];
+            const void *old_value = slots->values[existing];
+            slots->values[existing] = value;
+            slots->keys[existing] = key;
+            if (table->destroy) {
+                table->destroy(table->userdata, old_key, old_value);
+            }
             result = true;
         }
+    } else {
+        result = insert_new(table, key, value, hash);
+    }
+
+    if (table->lockfree) {
+        reclaim_retired(table);
     }
 
     SDL_UnlockRWLock(table->lock);
@@ -345,14 +719,30 @@ bool SDL_FindInHashTable(const SDL_HashTable *table, const void *key, const void
         return SDL_InvalidParamError("table");
     }
 
-    SDL_LockRWLockForReading(table->lock);
-
     bool result = false;
     const Uint32 hash = calc_hash(table, key);
-    SDL_HashItem *i = find_first_item(table, key, hash);
-    if (i) {
+
+    if (table->lockfree) {
+        SDL_AtomicInt *reader = enter_reader(table);
+        const SDL_HashSlots *slots = get_slots(table);
+        const Sint32 slot = slots ? find_slot(table, slots, key, hash, true) : -1;
+        if (slot >= 0) {
+            if (value) {
+                *value = slots->values[slot];
+            }
+            result = true;
+        }
+        leave_reader(reader);
+        return result;
+    }
+
+    SDL_LockRWLockForReading(table->lock);
+
+    const SDL_HashSlots *slots = table->slots;
+    const Sint32 slot = find_slot(table, slots, key, hash, false);
+    if (slot >= 0) {
         if (value) {
-            *value = i->value;
+            *value = slots->values[slot];
         }
         result = true;
     }
@@ -372,12 +762,16 @@ bool SDL_RemoveFromHashTable(SDL_HashTable *table, const void *key)
 
     bool result = false;
     const Uint32 hash = calc_hash(table, key);
-    SDL_HashItem *item = find_first_item(table, key, hash);
-    if (item) {
-        delete_item(table, item);
+    const Sint32 slot = find_slot(table, table->slots, key, hash, false);
+    if (slot >= 0) {
+        delete_slot(table, (Uint32)slot);
         result = true;
     }
 
+    if (table->lockfree) {
+        reclaim_retired(table);
+    }
+
     SDL_UnlockRWLock(table->lock);
     return result;
 }
@@ -391,17 +785,23 @@ bool SDL_IterateHashTable(const SDL_HashTable *table, SDL_HashTableIterateCallba
         return SDL_InvalidParamError("callback");
     }
 
+    // Lock-free tables take the lock here too, writers never change anything under an iteration.
     SDL_LockRWLockForReading(table->lock);
-    SDL_HashItem *end = table->table + (table->hash_mask + 1);
+    const SDL_HashSlots *slots = table->slots;
+    const Uint32 num_groups = slots->group_mask + 1;
     Uint32 num_iterated = 0;
 
-    for (SDL_HashItem *item = table->table; item < end; item++) {
-        if (item->live) {
-            if (!callback(userdata, table, item->key, item->value)) {
-                break;  // callback requested iteration stop.
+    for (Uint32 group = 0; group < num_groups && num_iterated < table->num_occupied_slots; ++group) {
+        GroupMask full = group_match_full(slots->ctrl + group * GROUP_WIDTH);
+        while (full) {
+            const Uint32 slot = group * GROUP_WIDTH + lowest_slot(full);
+            if (!callback(userdata, table, slots->keys[slot], slots->values[slot])) {
+                group = num_groups;  // callback requested iteration stop.
+                break;
             } else if (++num_iterated >= table->num_occupied_slots) {
                 break;  // we can drop out early because we've seen all the live items.
             }
+            full &= full - 1;
         }
     }
 
@@ -427,28 +827,32 @@ bool SDL_HashTableEmpty(SDL_HashTable *table)
     return SDL_GetNumHashTableItems(table) <= 0;
 }
 
-static void destroy_all(SDL_HashTable *table)
-{
-    SDL_HashDestroyCallback destroy = table->destroy;
-    if (destroy) {
-        void *userdata = table->userdata;
-        SDL_HashItem *end = table->table + (table->hash_mask + 1);
-        for (SDL_HashItem *i = table->table; i < end; ++i) {
-            if (i->live) {
-                i->live = false;
-                destroy(userdata, i->key, i->value);
-            }
-        }
-    }
-}
-
 void SDL_ClearHashTable(SDL_HashTable *table)
 {
     if (table) {
         SDL_LockRWLockForWriting(table->lock);
         {
-            destroy_all(table);
-            SDL_memset(table->table, 0, sizeof(*table->table) * (table->hash_mask + 1));
+            SDL_HashSlots *slots = table->slots;
+
+            if (table->lockfree) {
+                // Readers may still be in the old slots, so start over with a new block.
+                SDL_HashSlots *new_slots = alloc_slots(slots->capacity);
+                set_slots(table, new_slots);
+                if (new_slots) {
+                    retire(table, slots, true, NULL, NULL);
+                    reclaim_retired(table);
+                } else {
+                    // Out of memory: lookups fail until the old block is clean again.
+                    wait_for_readers(table, true);
+                    destroy_slots(table, slots);
+                    reset_ctrl(slots->ctrl, slots->capacity);
+                    set_slots(table, slots);
+                }
+            } else {
+                destroy_slots(table, slots);
+                reset_ctrl(slots->ctrl, slots->capacity);
+            }
+            table->growth_left = max_items(table->slots->capacity);
             table->num_occupied_slots = 0;
         }
         SDL_UnlockRWLock(table->lock);
@@ -458,23 +862,101 @@ void SDL_ClearHashTable(SDL_HashTable *table)
 void SDL_DestroyHashTable(SDL_HashTable *table)
 {
     if (table) {
-        destroy_all(table);
+        free_retired(table);
+        SDL_free(table->retired);
+        if (table->slots) {
+            destroy_slots(table, table->slots);
+            free_slots(table->slots);
+        }
         if (table->lock) {
             SDL_DestroyRWLock(table->lock);
         }
-        SDL_free(table->table);
-        SDL_free(table);
+        if (table->readers) {
+            SDL_free_tagged(SDL_MEMORY_TAG_HASHTABLE, table->readers, 2 * NUM_READER_STRIPES * sizeof(SDL_HashReaderStripe));
+        }
+        SDL_free_tagged(SDL_MEMORY_TAG_HASHTABLE, table, sizeof(*table));
     }
 }
 
-// this is djb's xor hashing function.
-static SDL_INLINE Uint32 hash_string_djbxor(const char *str, size_t len)
+/* String keys are hashed with wyhash (final version 4, public domain, by Wang Yi:
+   https://github.com/wangyi-fudan/wyhash), which reads 4 or 8 bytes at a time and
+   passes SMHasher, so it spreads similar names like "SDL.window.create.x" and
+   "SDL.window.create.y" as well as anything else we could use. */
+
+static SDL_INLINE void wy_mum(Uint64 *a, Uint64 *b)
+{
+#if defined(__SIZEOF_INT128__)
+    const unsigned __int128 r = (unsigned __int128)*a * *b;
+    *a = (Uint64)r;
+    *b = (Uint64)(r >> 64);
+#elif defined(_MSC_VER) && defined(_M_X64)
+    *a = _umul128(*a, *b, b);
+#else
+    const Uint64 ha = *a >> 32, hb = *b >> 32, la = (Uint32)*a, lb = (Uint32)*b;
+    const Uint64 rh = ha * hb, rm0 = ha * lb, rm1 = hb * la, rl = la * lb;
+    const Uint64 t = rl + (rm0 << 32);
+    Uint64 lo = t + (rm1 << 32);
+    Uint64 hi = rh + (rm0 >> 32) + (rm1 >> 32) + (t < rl) + (lo < t);
+    *a = lo;
+    *b = hi;
+#endif
+}
+
+static SDL_INLINE Uint64 wy_mix(Uint64 a, Uint64 b)
+{
+    wy_mum(&a, &b);
+    return a ^ b;
+}
+
+static SDL_INLINE Uint64 wy_read8(const Uint8 *p)
+{
+    Uint64 v;
+    SDL_memcpy(&v, p, sizeof(v));
+    return SDL_Swap64LE(v);
+}
+
+static SDL_INLINE Uint64 wy_read4(const Uint8 *p)
 {
-    Uint32 hash = 5381;
-    while (len--) {
-        hash = ((hash << 5) + hash) ^ *(str++);
+    Uint32 v;
+    SDL_memcpy(&v, p, sizeof(v));
+    return SDL_Swap32LE(v);
+}
+
+static Uint32 hash_string_wyhash(const char *str, size_t len)
+{
+    const Uint64 secret0 = 0x2d358dccaa6c78a5ULL;
+    const Uint64 secret1 = 0x8bb84b93962eacc9ULL;
+    const Uint8 *p = (const Uint8 *)str;
+    Uint64 seed = 0xca813bf4c7abf0a9ULL;  // wy_mix(secret0, secret1), for a seed of 0
+    Uint64 a, b;
+
+    if (len <= 16) {
+        if (len >= 4) {
+            const size_t offset = (len >> 3) << 2;
+            a = (wy_read4(p) << 32) | wy_read4(p + offset);
+            b = (wy_read4(p + len - 4) << 32) | wy_read4(p + len - 4 - offset);
+        } else if (len > 0) {
+            a = ((Uint64)p[0] << 16) | ((Uint64)p[len >> 1] << 8) | p[len - 1];
+            b = 0;
+        } else {
+            a = b = 0;
+        }
+    } else {
+        size_t i = len;
+        while (i > 16) {
+            seed = wy_mix(wy_read8(p) ^ secret1, wy_read8(p + 8) ^ seed);
+            i -= 16;
+            p += 16;
+        }
+        a = wy_read8(p + i - 16);
+        b = wy_read8(p + i - 8);
     }
-    return hash;
+
+    a ^= secret1;
+    b ^= seed;
+    wy_mum(&a, &b);
+    const Uint64 hash = wy_mix(a ^ secret0 ^ len, b ^ secret1);
+    return (Uint32)(hash ^ (hash >> 32));
 }
 
 Uint32 SDL_HashPointer(void *unused, const void *key)
@@ -493,7 +975,7 @@ Uint32 SDL_HashString(void *unused, const void *key)
 {
     (void)unused;
     const char *str = (const char *)key;
-    return hash_string_djbxor(str, SDL_strlen(str));
+    return hash_string_wyhash(str, SDL_strlen(str));
 }
 
 bool SDL_KeyMatchString(void *unused, const void *a, const void *b)
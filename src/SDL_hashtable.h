@@ -60,12 +60,14 @@
  * iterate through all the items in the table (SDL_IterateHashTable).
  *
  * The underlying hash table implementation is always subject to change, but
- * at the time of writing, it uses open addressing and Robin Hood hashing.
- * The technical details are explained [here](https://github.com/libsdl-org/SDL/pull/10897).
+ * at the time of writing, it uses open addressing with a separate array of
+ * control bytes that is probed 16 slots at a time (with SIMD, where
+ * available), in the style of Abseil's "Swiss tables".
  *
  * Hashtables keep an SDL_RWLock internally, so multiple threads can perform
  * hash lookups in parallel, while changes to the table will safely serialize
- * access between threads.
+ * access between threads. Tables created with SDL_CreateLockFreeHashTable()
+ * go further and don't take the lock for lookups at all.
  *
  * SDL provides a layer on top of this hash table implementation that might be
  * more pleasant to use. SDL_PropertiesID maps a string to arbitrary data of
@@ -293,6 +295,47 @@ extern SDL_HashTable * SDL_CreateHashTable(int estimated_capacity,
                                            SDL_HashDestroyCallback destroy,
                                            void *userdata);
 
+/**
+ * Create a new thread-safe hash table whose lookups don't take a lock.
+ *
+ * This works like SDL_CreateHashTable() with `threadsafe` set to true, but
+ * SDL_FindInHashTable() never touches the table's lock, so lookups from
+ * many threads don't fight over a shared cache line and never wait for each
+ * other or for a writer. Changes to the table still serialize on the lock.
+ *
+ * This is meant for tables that are read far more often than they change.
+ * The price is that keys and values handed to the `destroy` callback by
+ * SDL_RemoveFromHashTable(), SDL_InsertIntoHashTable() and
+ * SDL_ClearHashTable() might not be destroyed right away, but a little later,
+ * once no lookup that started before the change can still be looking at
+ * them. Tombstones are only cleaned up when the table rehashes, so tables
+ * with a lot of churn use a little more memory.
+ *
+ * A lookup that races with a change to the same key might see the table as
+ * it was either before or after the change.
+ *
+ * \param estimated_capacity the approximate maximum number of items to be held
+ *                           in the hash table, or 0 for no estimate.
+ * \param hash the function to use to hash keys.
+ * \param keymatch the function to use to compare keys.
+ * \param destroy the function to use to clean up keys and values, may be NULL.
+ * \param userdata a pointer that is passed to the callbacks.
+ * \returns a newly-created hash table, or NULL if there was an error; call
+ *          SDL_GetError() for more information.
+ *
+ * \threadsafety It is safe to call this function from any thread.
+ *
+ * \since This function is available since SDL 3.6.0.
+ *
+ * \sa SDL_CreateHashTable
+ * \sa SDL_DestroyHashTable
+ */
+extern SDL_HashTable * SDL_CreateLockFreeHashTable(int estimated_capacity,
+                                                   SDL_HashCallback hash,
+                                                   SDL_HashKeyMatchCallback keymatch,
+                                                   SDL_HashDestroyCallback destroy,
+                                                   void *userdata);
+
 
 /**
  * Destroy a hash table.
@@ -0,0 +1,122 @@
+/*
+  Simple DirectMedia Layer
+  Copyright (C) 1997-2026 Sam Lantinga <slouken@libsdl.org>
+
+  This software is provided 'as-is', without any express or implied
+  warranty.  In no event will the authors be held liable for any damages
+  arising from the use of this software.
+
+  Permission is granted to anyone to use this software for any purpose,
+  including commercial applications, and to alter it and redistribute it
+  freely, subject to the following restrictions:
+
+  1. The origin of this software must not be misrepresented; you must not
+     claim that you wrote the original software. If you use this software
+     in a product, an acknowledgment in the product documentation would be
+     appreciated but is not required.
+  2. Altered source versions must be plainly marked as such, and must not be
+     misrepresented as being the original software.
+  3. This notice may not be removed or altered from any source distribution.
+*/
+#include "SDL_internal.h"
+
+#include "SDL_objectpool.h"
+#include "stdlib/SDL_malloc_c.h"
+
+#define OBJECT_LINK(pool, object) (*(void **)((Uint8 *)(object) + (pool)->link_offset))
+
+void SDL_InitObjectPool(SDL_ObjectPool *pool, size_t object_size, size_t link_offset, int max_free, SDL_MemoryTag tag)
+{
+    SDL_zerop(pool);
+
+    SDL_assert(link_offset + sizeof(void *) <= object_size);
+    pool->object_size = object_size;
+    pool->link_offset = link_offset;
+    pool->max_free = max_free;
+    pool->tag = tag;
+}
+
+bool SDL_ReserveObjects(SDL_ObjectPool *pool, int count)
+{
+    for (; count > 0; --count) {
+        void *object = SDL_malloc_tagged(pool->tag, pool->object_size);
+        if (!object) {
+            return false;
+        }
+
+        OBJECT_LINK(pool, object) = pool->free_objects;
+        pool->free_objects = object;
+        ++pool->num_free;
+    }
+    return true;
+}
+
+void *SDL_AllocateObject(SDL_ObjectPool *pool)
+{
+    void *object = pool->free_objects;
+
+    if (object) {
+        pool->free_objects = OBJECT_LINK(pool, object);
+        --pool->num_free;
+        ++pool->num_reused;
+    } else {
+        object = SDL_malloc_tagged(pool->tag, pool->object_size);
+        if (!object) {
+            return NULL;
+        }
+    }
+
+    ++pool->num_allocated;
+    if (++pool->num_in_use > pool->max_in_use) {
+        pool->max_in_use = pool->num_in_use;
+    }
+    return object;
+}
+
+void SDL_ReleaseObject(SDL_ObjectPool *pool, void *object)
+{
+    SDL_assert(pool->num_in_use > 0);
+    --pool->num_in_use;
+
+    if (pool->num_free < pool->max_free) {
+        OBJECT_LINK(pool, object) = pool->free_objects;
+        pool->free_objects = object;
+        ++pool->num_free;
+    } else {
+        SDL_free_tagged(pool->tag, object, pool->object_size);
+    }
+}
+
+void SDL_ReleaseObjects(SDL_ObjectPool *pool, void *first, void *last, int count)
+{
+    if (count <= 0) {
+        return;
+    }
+
+    SDL_assert(pool->num_in_use >= count);
+    pool->num_in_use -= count;
+
+    OBJECT_LINK(pool, last) = pool->free_objects;
+    pool->free_objects = first;
+    pool->num_free += count;
+
+    if (pool->num_free > pool->max_free) {
+        SDL_TrimObjectPool(pool, pool->max_free);
+    }
+}
+
+void SDL_TrimObjectPool(SDL_ObjectPool *pool, int max_free)
+{
+    while (pool->num_free > max_free) {
+        void *object = pool->free_objects;
+        pool->free_objects = OBJECT_LINK(pool, object);
+        --pool->num_free;
+        SDL_free_tagged(pool->tag, object, pool->object_size);
+    }
+}
+
+void SDL_QuitObjectPool(SDL_ObjectPool *pool)
+{
+    SDL_assert(pool->num_in_use == 0);
+    SDL_TrimObjectPool(pool, 0);
+}
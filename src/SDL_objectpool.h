@@ -0,0 +1,74 @@
+/*
+  Simple DirectMedia Layer
+  Copyright (C) 1997-2026 Sam Lantinga <slouken@libsdl.org>
+
+  This software is provided 'as-is', without any express or implied
+  warranty.  In no event will the authors be held liable for any damages
+  arising from the use of this software.
+
+  Permission is granted to anyone to use this software for any purpose,
+  including commercial applications, and to alter it and redistribute it
+  freely, subject to the following restrictions:
+
+  1. The origin of this software must not be misrepresented; you must not
+     claim that you wrote the original software. If you use this software
+     in a product, an acknowledgment in the product documentation would be
+     appreciated but is not required.
+  2. Altered source versions must be plainly marked as such, and must not be
+     misrepresented as being the original software.
+  3. This notice may not be removed or altered from any source distribution.
+*/
+
+#ifndef SDL_objectpool_h_
+#define SDL_objectpool_h_
+
+/* A pool of fixed-size objects that keeps freed objects around to be reused.
+
+   Free objects are kept in a list, linked through a pointer that lives in
+   the objects themselves, at `link_offset`. This can be the object's own
+   "next" field, so a list of objects the caller linked together can be given
+   back to the pool in one go with SDL_ReleaseObjects().
+
+   A pool has no lock of its own, the caller is expected to serialize access
+   to it the same way as access to whatever owns the pool.
+
+   The memory for the objects is counted under the pool's memory tag.
+*/
+typedef struct SDL_ObjectPool
+{
+    void *free_objects;     // the first free object, the rest are linked through link_offset
+    size_t object_size;
+    size_t link_offset;
+    SDL_MemoryTag tag;
+    int num_free;
+    int max_free;           // free objects beyond this are given back to SDL_free()
+
+    // Statistics
+    Uint64 num_allocated;   // the number of objects handed out, in total
+    Uint64 num_reused;      // how many of those came from the free list
+    int num_in_use;         // the number of objects handed out and not released yet
+    int max_in_use;         // the largest num_in_use ever was
+} SDL_ObjectPool;
+
+// Set up an empty pool, this doesn't allocate any memory
+extern void SDL_InitObjectPool(SDL_ObjectPool *pool, size_t object_size, size_t link_offset, int max_free, SDL_MemoryTag tag);
+
+// Allocate objects up front, so later allocations don't have to
+extern bool SDL_ReserveObjects(SDL_ObjectPool *pool, int count);
+
+// Get an object from the pool, its contents are undefined
+extern void *SDL_AllocateObject(SDL_ObjectPool *pool);
+
+// Give an object back to the pool
+extern void SDL_ReleaseObject(SDL_ObjectPool *pool, void *object);
+
+// Give back `count` objects that are linked from `first` to `last` through link_offset
+extern void SDL_ReleaseObjects(SDL_ObjectPool *pool, void *first, void *last, int count);
+
+// Free objects until no more than `max_free` are left in the pool
+extern void SDL_TrimObjectPool(SDL_ObjectPool *pool, int max_free);
+
+// Free all the objects in the pool, the objects in use must have been released
+extern void SDL_QuitObjectPool(SDL_ObjectPool *pool);
+
+#endif // SDL_objectpool_h_
@@ -38,24 +38,56 @@ typedef struct
     } value;
 
     char *string_storage;
+    char *name;  // the key in the group's named table, NULL if the property is keyed by atom
 
     SDL_CleanupPropertyCallback cleanup;
     void *userdata;
 } SDL_Property;
 
+/* Writers and SDL_LockProperties() take the mutex, so changes are serialized the same
+   way they always were. Getters only take the read-write lock for reading, and writers
+   only hold it for writing while they swap a property in or out of the table, so reads
+   from many threads don't wait for each other. The flip side is that a writer has to
+   wait for a gap between readers, which a group read nonstop from many threads may
+   rarely have. Getters keep their hold short: a lookup and a copy of the value, plus
+   formatting it the first time a number is read as a string. */
 typedef struct
 {
-    SDL_HashTable *props;
+    SDL_HashTable *props;  // atom -> SDL_Property
+    SDL_HashTable *named;  // name -> SDL_Property, for names that weren't interned when the property was set
     SDL_Mutex *lock;
+    SDL_RWLock *rwlock;
 } SDL_Properties;
 
+typedef struct
+{
+    SDL_PropertyAtom atom;
+    char name[1];
+} SDL_PropertyName;
+
 static SDL_InitState SDL_properties_init;
 static SDL_HashTable *SDL_properties;
 static SDL_AtomicU32 SDL_last_properties_id;
 static SDL_AtomicU32 SDL_global_properties;
 
+// Property names are interned into atoms by SDL_GetPropertyAtom(), and properties with an
+// interned name are keyed by atom. Names are only interned when asked for, since they are kept
+// until SDL_Quit(), and properties set by a name that isn't interned are keyed by the name instead.
+// Atoms are never reused, not even across SDL_Quit(), so a stale atom can't alias a different name.
+static SDL_HashTable *SDL_property_atoms;      // name -> SDL_PropertyName, owns them
+static SDL_HashTable *SDL_property_atom_names; // atom -> SDL_PropertyName
+static SDL_Mutex *SDL_property_atoms_lock;
+static Uint32 SDL_last_property_atom;
+static SDL_AtomicU32 SDL_first_property_atom;
+
+// Most names are string constants passed in over and over, so a small cache indexed by
+// the address of the name skips hashing it. The name still has to be compared, since the
+// same address might hold a different name by now.
+#define SDL_PROPERTY_NAME_CACHE_BITS 8
+static SDL_PropertyName *SDL_property_name_cache[1 << SDL_PROPERTY_NAME_CACHE_BITS];
+
 
-static void SDL_FreePropertyWithCleanup(const void *key, const void *value, void *data, bool cleanup)
+static void SDL_FreePropertyWithCleanup(const void *value, void *data, bool cleanup)
 {
     SDL_Property *property = (SDL_Property *)value;
     if (property) {
@@ -72,33 +104,141 @@ static void SDL_FreePropertyWithCleanup(const void *key, const void *value, void
             break;
         }
         SDL_free(property->string_storage);
+        SDL_free(property->name);
     }
-    SDL_free((void *)key);
     SDL_free((void *)value);
 }
 
-static void SDLCALL SDL_FreeProperty(void *data, const void *key, const void *value)
+static bool SDLCALL FreeOneProperty(void *userdata, const SDL_HashTable *table, const void *key, const void *value)
 {
-    SDL_FreePropertyWithCleanup(key, value, data, true);
+    SDL_FreePropertyWithCleanup(value, NULL, true);
+    return true;  // keep iterating.
 }
 
 static void SDL_FreeProperties(SDL_Properties *properties)
 {
     if (properties) {
-        SDL_DestroyHashTable(properties->props);
+        if (properties->props) {
+            SDL_IterateHashTable(properties->props, FreeOneProperty, NULL);
+            SDL_DestroyHashTable(properties->props);
+        }
+        if (properties->named) {
+            SDL_IterateHashTable(properties->named, FreeOneProperty, NULL);
+            SDL_DestroyHashTable(properties->named);
+        }
+        SDL_DestroyRWLock(properties->rwlock);
         SDL_DestroyMutex(properties->lock);
         SDL_free(properties);
     }
 }
 
+static SDL_PropertyAtom SDL_FindPropertyAtom(const char *name);
+static const char *SDL_FindPropertyAtomName(SDL_PropertyAtom atom);
+
+/* Puts a property in the group (or takes it out if property is NULL), called with the mutex held.
+   The property is keyed by atom if its name is interned, otherwise by name, and a property that
+   was set by name before the name was interned is replaced along with the one keyed by atom. */
+static bool SDL_ReplaceProperty(SDL_Properties *properties, SDL_PropertyAtom atom, const char *name, SDL_Property *property)
+{
+    SDL_Property *old_property = NULL;
+    SDL_Property *old_named_property = NULL;
+    bool result = true;
+
+    if (!atom) {
+        atom = SDL_FindPropertyAtom(name);
+    }
+    if (atom) {
+        // The named table only changes with the mutex held, so it can be checked without the read-write lock
+        if (!SDL_HashTableEmpty(properties->named)) {
+            if (!name) {
+                name = SDL_FindPropertyAtomName(atom);
+            }
+            if (name) {
+                SDL_FindInHashTable(properties->named, name, (const void **)&old_named_property);
+            }
+        }
+    } else if (property) {
+        property->name = SDL_strdup(name);
+        if (!property->name) {
+            SDL_FreePropertyWithCleanup(property, NULL, true);
+            return false;
+        }
+    }
+
+    SDL_HashTable *table = atom ? properties->props : properties->named;
+    const void *key = atom ? (const void *)(uintptr_t)atom : name;
+
+    SDL_LockRWLockForWriting(properties->rwlock);
+    {
+        SDL_FindInHashTable(table, key, (const void **)&old_property);
+        if (property) {
+            if (!SDL_InsertIntoHashTable(table, atom ? key : property->name, property, true)) {
+                old_property = NULL;  // still in the table
+                result = false;
+            }
+        } else if (old_property) {
+            SDL_RemoveFromHashTable(table, key);
+        }
+        if (old_named_property && result) {
+            SDL_RemoveFromHashTable(properties->named, name);
+        } else {
+            old_named_property = NULL;
+        }
+    }
+    SDL_UnlockRWLock(properties->rwlock);
+
+    // Cleanup callbacks run without the read-write lock, so they can still read these properties
+    if (!result) {
+        SDL_FreePropertyWithCleanup(property, NULL, true);
+    }
+    SDL_FreePropertyWithCleanup(old_property, NULL, true);
+    SDL_FreePropertyWithCleanup(old_named_property, NULL, true);
+    return result;
+}
+
+/* Looks up a property by atom, or by name if it was set before the name was interned,
+   called with the read-write lock held for reading. */
+static SDL_Property *SDL_FindProperty(SDL_Properties *properties, SDL_PropertyAtom atom, const char *name)
+{
+    SDL_Property *property = NULL;
+
+    if (atom && SDL_FindInHashTable(properties->props, (const void *)(uintptr_t)atom, (const void **)&property)) {
+        return property;
+    }
+    if (!SDL_HashTableEmpty(properties->named)) {
+        if (!name) {
+            name = SDL_FindPropertyAtomName(atom);
+        }
+        if (name) {
+            SDL_FindInHashTable(properties->named, name, (const void **)&property);
+        }
+    }
+    return property;
+}
+
 bool SDL_InitProperties(void)
 {
     if (!SDL_ShouldInit(&SDL_properties_init)) {
         return true;
     }
 
-    SDL_properties = SDL_CreateHashTable(0, true, SDL_HashID, SDL_KeyMatchID, NULL, NULL);
-    const bool initialized = (SDL_properties != NULL);
+    SDL_properties = SDL_CreateLockFreeHashTable(0, SDL_HashID, SDL_KeyMatchID, NULL, NULL);
+    SDL_property_atoms = SDL_CreateLockFreeHashTable(0, SDL_HashString, SDL_KeyMatchString, SDL_DestroyHashValue, NULL);
+    SDL_property_atom_names = SDL_CreateLockFreeHashTable(0, SDL_HashID, SDL_KeyMatchID, NULL, NULL);
+    SDL_property_atoms_lock = SDL_CreateMutex();
+    SDL_SetAtomicU32(&SDL_first_property_atom, SDL_last_property_atom + 1);
+
+    const bool initialized = (SDL_properties && SDL_property_atoms && SDL_property_atom_names && SDL_property_atoms_lock);
+    if (!initialized) {
+        SDL_DestroyHashTable(SDL_properties);
+        SDL_properties = NULL;
+        SDL_DestroyHashTable(SDL_property_atoms);
+        SDL_property_atoms = NULL;
+        SDL_DestroyHashTable(SDL_property_atom_names);
+        SDL_property_atom_names = NULL;
+        SDL_DestroyMutex(SDL_property_atoms_lock);
+        SDL_property_atoms_lock = NULL;
+    }
     SDL_SetInitialized(&SDL_properties_init, initialized);
     return initialized;
 }
@@ -132,6 +272,14 @@ void SDL_QuitProperties(void)
     SDL_IterateHashTable(properties, FreeOneProperties, NULL);
     SDL_DestroyHashTable(properties);
 
+    SDL_zeroa(SDL_property_name_cache);
+    SDL_DestroyHashTable(SDL_property_atom_names);
+    SDL_property_atom_names = NULL;
+    SDL_DestroyHashTable(SDL_property_atoms);
+    SDL_property_atoms = NULL;
+    SDL_DestroyMutex(SDL_property_atoms_lock);
+    SDL_property_atoms_lock = NULL;
+
     SDL_SetInitialized(&SDL_properties_init, false);
 }
 
@@ -140,6 +288,114 @@ static bool SDL_CheckInitProperties(void)
     return SDL_InitProperties();
 }
 
+static SDL_PropertyAtom SDL_FindPropertyAtom(const char *name)
+{
+    if (!name || !SDL_property_atoms) {
+        return 0;
+    }
+
+    const Uint32 index = ((Uint32)(uintptr_t)name * 0x9E3779B1u) >> (32 - SDL_PROPERTY_NAME_CACHE_BITS);
+    SDL_PropertyName *entry = (SDL_PropertyName *)SDL_GetAtomicPointer((void **)&SDL_property_name_cache[index]);
+    if (entry && SDL_strcmp(entry->name, name) == 0) {
+        return entry->atom;
+    }
+
+    if (!SDL_FindInHashTable(SDL_property_atoms, name, (const void **)&entry)) {
+        return 0;
+    }
+    SDL_SetAtomicPointer((void **)&SDL_property_name_cache[index], entry);
+    return entry->atom;
+}
+
+SDL_PropertyAtom SDL_GetPropertyAtom(const char *name)
+{
+    CHECK_PARAM(!name || !*name) {
+        SDL_InvalidParamError("name");
+        return 0;
+    }
+
+    if (!SDL_CheckInitProperties()) {
+        return 0;
+    }
+
+    SDL_PropertyAtom atom = SDL_FindPropertyAtom(name);
+    if (atom) {
+        return atom;
+    }
+
+    SDL_LockMutex(SDL_property_atoms_lock);
+    {
+        // Somebody else may have interned it while we were waiting for the lock
+        atom = SDL_FindPropertyAtom(name);
+        if (!atom) {
+            const size_t len = SDL_strlen(name);
+            SDL_PropertyName *entry = (SDL_PropertyName *)SDL_malloc(sizeof(*entry) + len);
+            if (entry) {
+                atom = SDL_last_property_atom + 1;
+                if (atom == 0) {
+                    ++atom;
+                }
+                entry->atom = atom;
+                SDL_memcpy(entry->name, name, len + 1);
+
+                // Publish the name before the atom, so any atom that can be found has a name
+                if (!SDL_InsertIntoHashTable(SDL_property_atom_names, (const void *)(uintptr_t)atom, entry, false)) {
+                    SDL_free(entry);
+                    atom = 0;
+                } else if (!SDL_InsertIntoHashTable(SDL_property_atoms, entry->name, entry, false)) {
+                    SDL_RemoveFromHashTable(SDL_property_atom_names, (const void *)(uintptr_t)atom);
+                    SDL_free(entry);
+                    atom = 0;
+                } else {
+                    SDL_last_property_atom = atom;
+                }
+            }
+        }
+    }
+    SDL_UnlockMutex(SDL_property_atoms_lock);
+
+    return atom;
+}
+
+// Interned names are kept until SDL_Quit(), so the name can be used after the lookup
+static const char *SDL_FindPropertyAtomName(SDL_PropertyAtom atom)
+{
+    const SDL_PropertyName *entry = NULL;
+
+    if (!atom || !SDL_property_atom_names || !SDL_FindInHashTable(SDL_property_atom_names, (const void *)(uintptr_t)atom, (const void **)&entry)) {
+        return NULL;
+    }
+    return entry->name;
+}
+
+const char *SDL_GetPropertyAtomName(SDL_PropertyAtom atom)
+{
+    const SDL_PropertyName *entry = NULL;
+
+    CHECK_PARAM(!atom) {
+        SDL_InvalidParamError("atom");
+        return NULL;
+    }
+
+    if (!SDL_FindInHashTable(SDL_property_atom_names, (const void *)(uintptr_t)atom, (const void **)&entry)) {
+        SDL_InvalidParamError("atom");
+        return NULL;
+    }
+    return entry->name;
+}
+
+SDL_PropertyAtom SDL_GetCachedPropertyAtom(SDL_AtomicU32 *cache, const char *name)
+{
+    SDL_PropertyAtom atom = SDL_GetAtomicU32(cache);
+
+    // Atoms from before the last SDL_Quit() are below the first atom of this session
+    if (atom < SDL_GetAtomicU32(&SDL_first_property_atom)) {
+        atom = SDL_GetPropertyAtom(name);
+        SDL_SetAtomicU32(cache, atom);
+    }
+    return atom;
+}
+
 SDL_PropertiesID SDL_GetGlobalProperties(void)
 {
     SDL_PropertiesID props = SDL_GetAtomicU32(&SDL_global_properties);
@@ -177,15 +433,11 @@ SDL_PropertiesID SDL_CreateProperties(void)
     }
 
     properties->lock = SDL_CreateMutex();
-    if (!properties->lock) {
-        SDL_free(properties);
-        return 0;
-    }
-
-    properties->props = SDL_CreateHashTable(0, false, SDL_HashString, SDL_KeyMatchString, SDL_FreeProperty, NULL);
-    if (!properties->props) {
-        SDL_DestroyMutex(properties->lock);
-        SDL_free(properties);
+    properties->rwlock = SDL_CreateRWLock();
+    properties->props = SDL_CreateHashTable(0, false, SDL_HashID, SDL_KeyMatchID, NULL, NULL);
+    properties->named = SDL_CreateHashTable(0, false, SDL_HashString, SDL_KeyMatchString, NULL, NULL);
+    if (!properties->lock || !properties->rwlock || !properties->props || !properties->named) {
+        SDL_FreeProperties(properties);
         return 0;
     }
 
@@ -212,6 +464,7 @@ SDL_PropertiesID SDL_CreateProperties(void)
 typedef struct CopyOnePropertyData
 {
     SDL_Properties *dst_properties;
+    bool named;
     bool result;
 } CopyOnePropertyData;
 
@@ -225,35 +478,31 @@ static bool SDLCALL CopyOneProperty(void *userdata, const SDL_HashTable *table,
 
     CopyOnePropertyData *data = (CopyOnePropertyData *) userdata;
     SDL_Properties *dst_properties = data->dst_properties;
-    const char *src_name = (const char *)key;
     SDL_Property *dst_property;
 
-    char *dst_name = SDL_strdup(src_name);
-    if (!dst_name) {
-        data->result = false;
-        return true; // keep iterating (I guess...?)
-    }
-
     dst_property = (SDL_Property *)SDL_malloc(sizeof(*dst_property));
     if (!dst_property) {
-        SDL_free(dst_name);
         data->result = false;
         return true; // keep iterating (I guess...?)
     }
 
     SDL_copyp(dst_property, src_property);
+    dst_property->string_storage = NULL;
+    dst_property->name = NULL;
     if (src_property->type == SDL_PROPERTY_TYPE_STRING) {
         dst_property->value.string_value = SDL_strdup(src_property->value.string_value);
         if (!dst_property->value.string_value) {
-            SDL_free(dst_name);
             SDL_free(dst_property);
             data->result = false;
             return true; // keep iterating (I guess...?)
         }
     }
 
-    if (!SDL_InsertIntoHashTable(dst_properties->props, dst_name, dst_property, true)) {
-        SDL_FreePropertyWithCleanup(dst_name, dst_property, NULL, false);
+    if (data->named) {
+        if (!SDL_ReplaceProperty(dst_properties, 0, (const char *)key, dst_property)) {
+            data->result = false;
+        }
+    } else if (!SDL_ReplaceProperty(dst_properties, (SDL_PropertyAtom)(uintptr_t)key, NULL, dst_property)) {
         data->result = false;
     }
 
@@ -285,8 +534,10 @@ bool SDL_CopyProperties(SDL_PropertiesID src, SDL_PropertiesID dst)
     SDL_LockMutex(src_properties->lock);
     SDL_LockMutex(dst_properties->lock);
     {
-        CopyOnePropertyData data = { dst_properties, true };
+        CopyOnePropertyData data = { dst_properties, false, true };
         SDL_IterateHashTable(src_properties->props, CopyOneProperty, &data);
+        data.named = true;
+        SDL_IterateHashTable(src_properties->named, CopyOneProperty, &data);
         result = data.result;
     }
     SDL_UnlockMutex(dst_properties->lock);
@@ -328,43 +579,35 @@ void SDL_UnlockProperties(SDL_PropertiesID props)
     SDL_UnlockMutex(properties->lock);
 }
 
-static bool SDL_PrivateSetProperty(SDL_PropertiesID props, const char *name, SDL_Property *property)
+// Sets a property by atom, or by name if atom is 0
+static bool SDL_PrivateSetProperty(SDL_PropertiesID props, SDL_PropertyAtom atom, const char *name, SDL_Property *property)
 {
     SDL_Properties *properties = NULL;
     bool result = true;
 
     CHECK_PARAM(!props) {
-        SDL_FreePropertyWithCleanup(NULL, property, NULL, true);
+        SDL_FreePropertyWithCleanup(property, NULL, true);
         return SDL_InvalidParamError("props");
     }
-    CHECK_PARAM(!name || !*name) {
-        SDL_FreePropertyWithCleanup(NULL, property, NULL, true);
-        return SDL_InvalidParamError("name");
+    CHECK_PARAM(!atom && (!name || !*name)) {
+        SDL_FreePropertyWithCleanup(property, NULL, true);
+        return SDL_InvalidParamError(name ? "name" : "atom");
     }
 
     SDL_FindInHashTable(SDL_properties, (const void *)(uintptr_t)props, (const void **)&properties);
     CHECK_PARAM(!properties) {
-        SDL_FreePropertyWithCleanup(NULL, property, NULL, true);
+        SDL_FreePropertyWithCleanup(property, NULL, true);
         return SDL_InvalidParamError("props");
     }
 
     SDL_LockMutex(properties->lock);
-    {
-        SDL_RemoveFromHashTable(properties->props, name);
-        if (property) {
-            char *key = SDL_strdup(name);
-            if (!key || !SDL_InsertIntoHashTable(properties->props, key, property, false)) {
-                SDL_FreePropertyWithCleanup(key, property, NULL, true);
-                result = false;
-            }
-        }
-    }
+    result = SDL_ReplaceProperty(properties, atom, name, property);
     SDL_UnlockMutex(properties->lock);
 
     return result;
 }
 
-bool SDL_SetPointerPropertyWithCleanup(SDL_PropertiesID props, const char *name, void *value, SDL_CleanupPropertyCallback cleanup, void *userdata)
+static bool SDL_PrivateSetPointerProperty(SDL_PropertiesID props, SDL_PropertyAtom atom, const char *name, void *value, SDL_CleanupPropertyCallback cleanup, void *userdata)
 {
     SDL_Property *property;
 
@@ -372,7 +615,7 @@ bool SDL_SetPointerPropertyWithCleanup(SDL_PropertiesID props, const char *name,
         if (cleanup) {
             cleanup(userdata, value);
         }
-        return SDL_ClearProperty(props, name);
+        return SDL_PrivateSetProperty(props, atom, name, NULL);
     }
 
     property = (SDL_Property *)SDL_calloc(1, sizeof(*property));
@@ -380,31 +623,40 @@ bool SDL_SetPointerPropertyWithCleanup(SDL_PropertiesID props, const char *name,
         if (cleanup) {
             cleanup(userdata, value);
         }
-        SDL_FreePropertyWithCleanup(NULL, property, NULL, false);
         return false;
     }
     property->type = SDL_PROPERTY_TYPE_POINTER;
     property->value.pointer_value = value;
     property->cleanup = cleanup;
     property->userdata = userdata;
-    return SDL_PrivateSetProperty(props, name, property);
+    return SDL_PrivateSetProperty(props, atom, name, property);
 }
 
-bool SDL_SetPointerProperty(SDL_PropertiesID props, const char *name, void *value)
+bool SDL_SetPointerPropertyWithCleanup(SDL_PropertiesID props, const char *name, void *value, SDL_CleanupPropertyCallback cleanup, void *userdata)
 {
-    SDL_Property *property;
+    CHECK_PARAM(!name || !*name) {
+        if (cleanup) {
+            cleanup(userdata, value);
+        }
+        return SDL_InvalidParamError("name");
+    }
+    return SDL_PrivateSetPointerProperty(props, 0, name, value, cleanup, userdata);
+}
 
-    if (!value) {
-        return SDL_ClearProperty(props, name);
+bool SDL_SetPointerPropertyByAtom(SDL_PropertiesID props, SDL_PropertyAtom atom, void *value)
+{
+    CHECK_PARAM(!atom) {
+        return SDL_InvalidParamError("atom");
     }
+    return SDL_PrivateSetPointerProperty(props, atom, NULL, value, NULL, NULL);
+}
 
-    property = (SDL_Property *)SDL_calloc(1, sizeof(*property));
-    if (!property) {
-        return false;
+bool SDL_SetPointerProperty(SDL_PropertiesID props, const char *name, void *value)
+{
+    CHECK_PARAM(!name || !*name) {
+        return SDL_InvalidParamError("name");
     }
-    property->type = SDL_PROPERTY_TYPE_POINTER;
-    property->value.pointer_value = value;
-    return SDL_PrivateSetProperty(props, name, property);
+    return SDL_PrivateSetPointerProperty(props, 0, name, value, NULL, NULL);
 }
 
 static void SDLCALL CleanupFreeableProperty(void *userdata, void *value)
@@ -429,12 +681,12 @@ bool SDL_SetSurfaceProperty(SDL_PropertiesID props, const char *name, SDL_Surfac
     return SDL_SetPointerPropertyWithCleanup(props, name, surface, CleanupSurface, NULL);
 }
 
-bool SDL_SetStringProperty(SDL_PropertiesID props, const char *name, const char *value)
+static bool SDL_PrivateSetStringProperty(SDL_PropertiesID props, SDL_PropertyAtom atom, const char *name, const char *value)
 {
     SDL_Property *property;
 
     if (!value) {
-        return SDL_ClearProperty(props, name);
+        return SDL_PrivateSetProperty(props, atom, name, NULL);
     }
 
     property = (SDL_Property *)SDL_calloc(1, sizeof(*property));
@@ -447,10 +699,26 @@ bool SDL_SetStringProperty(SDL_PropertiesID props, const char *name, const char
         SDL_free(property);
         return false;
     }
-    return SDL_PrivateSetProperty(props, name, property);
+    return SDL_PrivateSetProperty(props, atom, name, property);
 }
 
-bool SDL_SetNumberProperty(SDL_PropertiesID props, const char *name, Sint64 value)
+bool SDL_SetStringPropertyByAtom(SDL_PropertiesID props, SDL_PropertyAtom atom, const char *value)
+{
+    CHECK_PARAM(!atom) {
+        return SDL_InvalidParamError("atom");
+    }
+    return SDL_PrivateSetStringProperty(props, atom, NULL, value);
+}
+
+bool SDL_SetStringProperty(SDL_PropertiesID props, const char *name, const char *value)
+{
+    CHECK_PARAM(!name || !*name) {
+        return SDL_InvalidParamError("name");
+    }
+    return SDL_PrivateSetStringProperty(props, 0, name, value);
+}
+
+static bool SDL_PrivateSetNumberProperty(SDL_PropertiesID props, SDL_PropertyAtom atom, const char *name, Sint64 value)
 {
     SDL_Property *property = (SDL_Property *)SDL_calloc(1, sizeof(*property));
     if (!property) {
@@ -458,10 +726,26 @@ bool SDL_SetNumberProperty(SDL_PropertiesID props, const char *name, Sint64 valu
     }
     property->type = SDL_PROPERTY_TYPE_NUMBER;
     property->value.number_value = value;
-    return SDL_PrivateSetProperty(props, name, property);
+    return SDL_PrivateSetProperty(props, atom, name, property);
 }
 
-bool SDL_SetFloatProperty(SDL_PropertiesID props, const char *name, float value)
+bool SDL_SetNumberPropertyByAtom(SDL_PropertiesID props, SDL_PropertyAtom atom, Sint64 value)
+{
+    CHECK_PARAM(!atom) {
+        return SDL_InvalidParamError("atom");
+    }
+    return SDL_PrivateSetNumberProperty(props, atom, NULL, value);
+}
+
+bool SDL_SetNumberProperty(SDL_PropertiesID props, const char *name, Sint64 value)
+{
+    CHECK_PARAM(!name || !*name) {
+        return SDL_InvalidParamError("name");
+    }
+    return SDL_PrivateSetNumberProperty(props, 0, name, value);
+}
+
+static bool SDL_PrivateSetFloatProperty(SDL_PropertiesID props, SDL_PropertyAtom atom, const char *name, float value)
 {
     SDL_Property *property = (SDL_Property *)SDL_calloc(1, sizeof(*property));
     if (!property) {
@@ -469,10 +753,26 @@ bool SDL_SetFloatProperty(SDL_PropertiesID props, const char *name, float value)
     }
     property->type = SDL_PROPERTY_TYPE_FLOAT;
     property->value.float_value = value;
-    return SDL_PrivateSetProperty(props, name, property);
+    return SDL_PrivateSetProperty(props, atom, name, property);
 }
 
-bool SDL_SetBooleanProperty(SDL_PropertiesID props, const char *name, bool value)
+bool SDL_SetFloatPropertyByAtom(SDL_PropertiesID props, SDL_PropertyAtom atom, float value)
+{
+    CHECK_PARAM(!atom) {
+        return SDL_InvalidParamError("atom");
+    }
+    return SDL_PrivateSetFloatProperty(props, atom, NULL, value);
+}
+
+bool SDL_SetFloatProperty(SDL_PropertiesID props, const char *name, float value)
+{
+    CHECK_PARAM(!name || !*name) {
+        return SDL_InvalidParamError("name");
+    }
+    return SDL_PrivateSetFloatProperty(props, 0, name, value);
+}
+
+static bool SDL_PrivateSetBooleanProperty(SDL_PropertiesID props, SDL_PropertyAtom atom, const char *name, bool value)
 {
     SDL_Property *property = (SDL_Property *)SDL_calloc(1, sizeof(*property));
     if (!property) {
@@ -480,7 +780,23 @@ bool SDL_SetBooleanProperty(SDL_PropertiesID props, const char *name, bool value
     }
     property->type = SDL_PROPERTY_TYPE_BOOLEAN;
     property->value.boolean_value = value ? true : false;
-    return SDL_PrivateSetProperty(props, name, property);
+    return SDL_PrivateSetProperty(props, atom, name, property);
+}
+
+bool SDL_SetBooleanPropertyByAtom(SDL_PropertiesID props, SDL_PropertyAtom atom, bool value)
+{
+    CHECK_PARAM(!atom) {
+        return SDL_InvalidParamError("atom");
+    }
+    return SDL_PrivateSetBooleanProperty(props, atom, NULL, value);
+}
+
+bool SDL_SetBooleanProperty(SDL_PropertiesID props, const char *name, bool value)
+{
+    CHECK_PARAM(!name || !*name) {
+        return SDL_InvalidParamError("name");
+    }
+    return SDL_PrivateSetBooleanProperty(props, 0, name, value);
 }
 
 bool SDL_HasProperty(SDL_PropertiesID props, const char *name)
@@ -488,7 +804,25 @@ bool SDL_HasProperty(SDL_PropertiesID props, const char *name)
     return (SDL_GetPropertyType(props, name) != SDL_PROPERTY_TYPE_INVALID);
 }
 
-SDL_PropertyType SDL_GetPropertyType(SDL_PropertiesID props, const char *name)
+// Several readers can get here at once, so the string is made at most once with a compare-and-swap
+static const char *SDL_GetPropertyStringStorage(SDL_Property *property)
+{
+    char *storage = (char *)SDL_GetAtomicPointer((void **)&property->string_storage);
+    if (!storage) {
+        if (property->type == SDL_PROPERTY_TYPE_NUMBER) {
+            SDL_asprintf(&storage, "%" SDL_PRIs64, property->value.number_value);
+        } else {
+            SDL_asprintf(&storage, "%f", property->value.float_value);
+        }
+        if (storage && !SDL_CompareAndSwapAtomicPointer((void **)&property->string_storage, NULL, storage)) {
+            SDL_free(storage);
+            storage = (char *)SDL_GetAtomicPointer((void **)&property->string_storage);
+        }
+    }
+    return storage;
+}
+
+static SDL_PropertyType SDL_PrivateGetPropertyType(SDL_PropertiesID props, SDL_PropertyAtom atom, const char *name)
 {
     SDL_Properties *properties = NULL;
     SDL_PropertyType type = SDL_PROPERTY_TYPE_INVALID;
@@ -496,7 +830,7 @@ SDL_PropertyType SDL_GetPropertyType(SDL_PropertiesID props, const char *name)
     if (!props) {
         return SDL_PROPERTY_TYPE_INVALID;
     }
-    if (!name || !*name) {
+    if (!atom && !name) {
         return SDL_PROPERTY_TYPE_INVALID;
     }
 
@@ -505,19 +839,30 @@ SDL_PropertyType SDL_GetPropertyType(SDL_PropertiesID props, const char *name)
         return SDL_PROPERTY_TYPE_INVALID;
     }
 
-    SDL_LockMutex(properties->lock);
+    SDL_LockRWLockForReading(properties->rwlock);
     {
-        SDL_Property *property = NULL;
-        if (SDL_FindInHashTable(properties->props, name, (const void **)&property)) {
+        SDL_Property *property = SDL_FindProperty(properties, atom, name);
+        if (property) {
             type = property->type;
         }
     }
-    SDL_UnlockMutex(properties->lock);
+    SDL_UnlockRWLock(properties->rwlock);
 
     return type;
 }
 
-void *SDL_GetPointerProperty(SDL_PropertiesID props, const char *name, void *default_value)
+SDL_PropertyType SDL_GetPropertyTypeByAtom(SDL_PropertiesID props, SDL_PropertyAtom atom)
+{
+    return SDL_PrivateGetPropertyType(props, atom, NULL);
+}
+
+// The getters don't intern names, a property set by a name that isn't interned is found by the name
+SDL_PropertyType SDL_GetPropertyType(SDL_PropertiesID props, const char *name)
+{
+    return SDL_PrivateGetPropertyType(props, SDL_FindPropertyAtom(name), name);
+}
+
+static void *SDL_PrivateGetPointerProperty(SDL_PropertiesID props, SDL_PropertyAtom atom, const char *name, void *default_value)
 {
     SDL_Properties *properties = NULL;
     void *value = default_value;
@@ -525,7 +870,7 @@ void *SDL_GetPointerProperty(SDL_PropertiesID props, const char *name, void *def
     if (!props) {
         return value;
     }
-    if (!name || !*name) {
+    if (!atom && !name) {
         return value;
     }
 
@@ -537,21 +882,31 @@ void *SDL_GetPointerProperty(SDL_PropertiesID props, const char *name, void *def
     // Note that taking the lock here only guarantees that we won't read the
     // hashtable while it's being modified. The value itself can easily be
     // freed from another thread after it is returned here.
-    SDL_LockMutex(properties->lock);
+    SDL_LockRWLockForReading(properties->rwlock);
     {
-        SDL_Property *property = NULL;
-        if (SDL_FindInHashTable(properties->props, name, (const void **)&property)) {
+        SDL_Property *property = SDL_FindProperty(properties, atom, name);
+        if (property) {
             if (property->type == SDL_PROPERTY_TYPE_POINTER) {
                 value = property->value.pointer_value;
             }
         }
     }
-    SDL_UnlockMutex(properties->lock);
+    SDL_UnlockRWLock(properties->rwlock);
 
     return value;
 }
 
-const char *SDL_GetStringProperty(SDL_PropertiesID props, const char *name, const char *default_value)
+void *SDL_GetPointerPropertyByAtom(SDL_PropertiesID props, SDL_PropertyAtom atom, void *default_value)
+{
+    return SDL_PrivateGetPointerProperty(props, atom, NULL, default_value);
+}
+
+void *SDL_GetPointerProperty(SDL_PropertiesID props, const char *name, void *default_value)
+{
+    return SDL_PrivateGetPointerProperty(props, SDL_FindPropertyAtom(name), name, default_value);
+}
+
+static const char *SDL_PrivateGetStringProperty(SDL_PropertiesID props, SDL_PropertyAtom atom, const char *name, const char *default_value)
 {
     SDL_Properties *properties = NULL;
     const char *value = default_value;
@@ -559,7 +914,7 @@ const char *SDL_GetStringProperty(SDL_PropertiesID props, const char *name, cons
     if (!props) {
         return value;
     }
-    if (!name || !*name) {
+    if (!atom && !name) {
         return value;
     }
 
@@ -568,34 +923,23 @@ const char *SDL_GetStringProperty(SDL_PropertiesID props, const char *name, cons
         return value;
     }
 
-    SDL_LockMutex(properties->lock);
+    SDL_LockRWLockForReading(properties->rwlock);
     {
-        SDL_Property *property = NULL;
-        if (SDL_FindInHashTable(properties->props, name, (const void **)&property)) {
+        SDL_Property *property = SDL_FindProperty(properties, atom, name);
+        if (property) {
             switch (property->type) {
             case SDL_PROPERTY_TYPE_STRING:
                 value = property->value.string_value;
                 break;
             case SDL_PROPERTY_TYPE_NUMBER:
-                if (property->string_storage) {
-                    value = property->string_storage;
-                } else {
-                    SDL_asprintf(&property->string_storage, "%" SDL_PRIs64, property->value.number_value);
-                    if (property->string_storage) {
-                        value = property->string_storage;
-                    }
-                }
-                break;
             case SDL_PROPERTY_TYPE_FLOAT:
-                if (property->string_storage) {
-                    value = property->string_storage;
-                } else {
-                    SDL_asprintf(&property->string_storage, "%f", property->value.float_value);
-                    if (property->string_storage) {
-                        value = property->string_storage;
-                    }
+            {
+                const char *storage = SDL_GetPropertyStringStorage(property);
+                if (storage) {
+                    value = storage;
                 }
                 break;
+            }
             case SDL_PROPERTY_TYPE_BOOLEAN:
                 value = property->value.boolean_value ? "true" : "false";
                 break;
@@ -604,12 +948,22 @@ const char *SDL_GetStringProperty(SDL_PropertiesID props, const char *name, cons
             }
         }
     }
-    SDL_UnlockMutex(properties->lock);
+    SDL_UnlockRWLock(properties->rwlock);
 
     return value;
 }
 
-Sint64 SDL_GetNumberProperty(SDL_PropertiesID props, const char *name, Sint64 default_value)
+const char *SDL_GetStringPropertyByAtom(SDL_PropertiesID props, SDL_PropertyAtom atom, const char *default_value)
+{
+    return SDL_PrivateGetStringProperty(props, atom, NULL, default_value);
+}
+
+const char *SDL_GetStringProperty(SDL_PropertiesID props, const char *name, const char *default_value)
+{
+    return SDL_PrivateGetStringProperty(props, SDL_FindPropertyAtom(name), name, default_value);
+}
+
+static Sint64 SDL_PrivateGetNumberProperty(SDL_PropertiesID props, SDL_PropertyAtom atom, const char *name, Sint64 default_value)
 {
     SDL_Properties *properties = NULL;
     Sint64 value = default_value;
@@ -617,7 +971,7 @@ Sint64 SDL_GetNumberProperty(SDL_PropertiesID props, const char *name, Sint64 de
     if (!props) {
         return value;
     }
-    if (!name || !*name) {
+    if (!atom && !name) {
         return value;
     }
 
@@ -626,10 +980,10 @@ Sint64 SDL_GetNumberProperty(SDL_PropertiesID props, const char *name, Sint64 de
         return value;
     }
 
-    SDL_LockMutex(properties->lock);
+    SDL_LockRWLockForReading(properties->rwlock);
     {
-        SDL_Property *property = NULL;
-        if (SDL_FindInHashTable(properties->props, name, (const void **)&property)) {
+        SDL_Property *property = SDL_FindProperty(properties, atom, name);
+        if (property) {
             switch (property->type) {
             case SDL_PROPERTY_TYPE_STRING:
                 value = (Sint64)SDL_strtoll(property->value.string_value, NULL, 0);
@@ -648,12 +1002,22 @@ Sint64 SDL_GetNumberProperty(SDL_PropertiesID props, const char *name, Sint64 de
             }
         }
     }
-    SDL_UnlockMutex(properties->lock);
+    SDL_UnlockRWLock(properties->rwlock);
 
     return value;
 }
 
-float SDL_GetFloatProperty(SDL_PropertiesID props, const char *name, float default_value)
+Sint64 SDL_GetNumberPropertyByAtom(SDL_PropertiesID props, SDL_PropertyAtom atom, Sint64 default_value)
+{
+    return SDL_PrivateGetNumberProperty(props, atom, NULL, default_value);
+}
+
+Sint64 SDL_GetNumberProperty(SDL_PropertiesID props, const char *name, Sint64 default_value)
+{
+    return SDL_PrivateGetNumberProperty(props, SDL_FindPropertyAtom(name), name, default_value);
+}
+
+static float SDL_PrivateGetFloatProperty(SDL_PropertiesID props, SDL_PropertyAtom atom, const char *name, float default_value)
 {
     SDL_Properties *properties = NULL;
     float value = default_value;
@@ -661,7 +1025,7 @@ float SDL_GetFloatProperty(SDL_PropertiesID props, const char *name, float defau
     if (!props) {
         return value;
     }
-    if (!name || !*name) {
+    if (!atom && !name) {
         return value;
     }
 
@@ -670,10 +1034,10 @@ float SDL_GetFloatProperty(SDL_PropertiesID props, const char *name, float defau
         return value;
     }
 
-    SDL_LockMutex(properties->lock);
+    SDL_LockRWLockForReading(properties->rwlock);
     {
-        SDL_Property *property = NULL;
-        if (SDL_FindInHashTable(properties->props, name, (const void **)&property)) {
+        SDL_Property *property = SDL_FindProperty(properties, atom, name);
+        if (property) {
             switch (property->type) {
             case SDL_PROPERTY_TYPE_STRING:
                 value = (float)SDL_atof(property->value.string_value);
@@ -692,12 +1056,22 @@ float SDL_GetFloatProperty(SDL_PropertiesID props, const char *name, float defau
             }
         }
     }
-    SDL_UnlockMutex(properties->lock);
+    SDL_UnlockRWLock(properties->rwlock);
 
     return value;
 }
 
-bool SDL_GetBooleanProperty(SDL_PropertiesID props, const char *name, bool default_value)
+float SDL_GetFloatPropertyByAtom(SDL_PropertiesID props, SDL_PropertyAtom atom, float default_value)
+{
+    return SDL_PrivateGetFloatProperty(props, atom, NULL, default_value);
+}
+
+float SDL_GetFloatProperty(SDL_PropertiesID props, const char *name, float default_value)
+{
+    return SDL_PrivateGetFloatProperty(props, SDL_FindPropertyAtom(name), name, default_value);
+}
+
+static bool SDL_PrivateGetBooleanProperty(SDL_PropertiesID props, SDL_PropertyAtom atom, const char *name, bool default_value)
 {
     SDL_Properties *properties = NULL;
     bool value = default_value ? true : false;
@@ -705,7 +1079,7 @@ bool SDL_GetBooleanProperty(SDL_PropertiesID props, const char *name, bool defau
     if (!props) {
         return value;
     }
-    if (!name || !*name) {
+    if (!atom && !name) {
         return value;
     }
 
@@ -714,10 +1088,10 @@ bool SDL_GetBooleanProperty(SDL_PropertiesID props, const char *name, bool defau
         return value;
     }
 
-    SDL_LockMutex(properties->lock);
+    SDL_LockRWLockForReading(properties->rwlock);
     {
-        SDL_Property *property = NULL;
-        if (SDL_FindInHashTable(properties->props, name, (const void **)&property)) {
+        SDL_Property *property = SDL_FindProperty(properties, atom, name);
+        if (property) {
             switch (property->type) {
             case SDL_PROPERTY_TYPE_STRING:
                 value = SDL_GetStringBoolean(property->value.string_value, default_value);
@@ -736,14 +1110,39 @@ bool SDL_GetBooleanProperty(SDL_PropertiesID props, const char *name, bool defau
             }
         }
     }
-    SDL_UnlockMutex(properties->lock);
+    SDL_UnlockRWLock(properties->rwlock);
 
     return value;
 }
 
+bool SDL_GetBooleanPropertyByAtom(SDL_PropertiesID props, SDL_PropertyAtom atom, bool default_value)
+{
+    return SDL_PrivateGetBooleanProperty(props, atom, NULL, default_value);
+}
+
+bool SDL_GetBooleanProperty(SDL_PropertiesID props, const char *name, bool default_value)
+{
+    return SDL_PrivateGetBooleanProperty(props, SDL_FindPropertyAtom(name), name, default_value);
+}
+
+bool SDL_ClearPropertyByAtom(SDL_PropertiesID props, SDL_PropertyAtom atom)
+{
+    CHECK_PARAM(!atom) {
+        return SDL_InvalidParamError("atom");
+    }
+    return SDL_PrivateSetProperty(props, atom, NULL, NULL);
+}
+
 bool SDL_ClearProperty(SDL_PropertiesID props, const char *name)
 {
-    return SDL_PrivateSetProperty(props, name, NULL);
+    CHECK_PARAM(!props) {
+        return SDL_InvalidParamError("props");
+    }
+    CHECK_PARAM(!name || !*name) {
+        return SDL_InvalidParamError("name");
+    }
+
+    return SDL_PrivateSetProperty(props, 0, name, NULL);
 }
 
 int SDL_GetNumProperties(SDL_PropertiesID props)
@@ -758,9 +1157,9 @@ int SDL_GetNumProperties(SDL_PropertiesID props)
         return 0;
     }
 
-    SDL_LockMutex(properties->lock);
-    const int retval = SDL_GetNumHashTableItems(properties->props);
-    SDL_UnlockMutex(properties->lock);
+    SDL_LockRWLockForReading(properties->rwlock);
+    const int retval = SDL_GetNumHashTableItems(properties->props) + SDL_GetNumHashTableItems(properties->named);
+    SDL_UnlockRWLock(properties->rwlock);
     return retval;
 }
 
@@ -774,6 +1173,18 @@ typedef struct EnumerateOnePropertyData
 
 
 static bool SDLCALL EnumerateOneProperty(void *userdata, const SDL_HashTable *table, const void *key, const void *value)
+{
+    (void) table;
+    (void) value;
+    const EnumerateOnePropertyData *data = (const EnumerateOnePropertyData *) userdata;
+    const SDL_PropertyName *entry = NULL;
+    if (SDL_FindInHashTable(SDL_property_atom_names, key, (const void **)&entry)) {
+        data->callback(data->userdata, data->props, entry->name);
+    }
+    return true;  // keep iterating.
+}
+
+static bool SDLCALL EnumerateOneNamedProperty(void *userdata, const SDL_HashTable *table, const void *key, const void *value)
 {
     (void) table;
     (void) value;
@@ -802,6 +1213,7 @@ bool SDL_EnumerateProperties(SDL_PropertiesID props, SDL_EnumeratePropertiesCall
     {
         EnumerateOnePropertyData data = { callback, userdata, props };
         SDL_IterateHashTable(properties->props, EnumerateOneProperty, &data);
+        SDL_IterateHashTable(properties->named, EnumerateOneNamedProperty, &data);
     }
     SDL_UnlockMutex(properties->lock);
 
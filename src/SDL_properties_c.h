@@ -23,4 +23,6 @@ extern bool SDL_InitProperties(void);
 extern bool SDL_SetFreeableProperty(SDL_PropertiesID props, const char *name, void *value);
 extern bool SDL_SetSurfaceProperty(SDL_PropertiesID props, const char *name, SDL_Surface *surface);
 extern bool SDL_DumpProperties(SDL_PropertiesID props);
+// Returns the atom for a name, interning it once and caching it in `cache` until SDL_Quit()
+extern SDL_PropertyAtom SDL_GetCachedPropertyAtom(SDL_AtomicU32 *cache, const char *name);
 extern void SDL_QuitProperties(void);
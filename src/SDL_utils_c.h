@@ -89,6 +89,20 @@ SDL_FORCE_INLINE bool SDL_ObjectValid(void *object, SDL_ObjectType type)
     return SDL_FindObject(object, type);
 }
 
+/* Per-thread counters and caches are split into stripes that a thread picks by
+   the address of its stack. Every thread has its own stack, so this is a cheaper
+   way to tell threads apart than the thread ID, and unlike thread local storage
+   it never allocates, so the allocator can use it too. Stripes should be padded
+   to a cache line, so threads on different cores rarely touch the same one. */
+#define SDL_THREAD_STRIPE_BITS 4
+#define SDL_NUM_THREAD_STRIPES (1 << SDL_THREAD_STRIPE_BITS)
+
+SDL_FORCE_INLINE Uint32 SDL_GetThreadStripe(void)
+{
+    const uintptr_t stack = (uintptr_t)&stack >> 16;
+    return ((Uint32)stack * 0x9E3779B1u) >> (32 - SDL_THREAD_STRIPE_BITS);
+}
+
 extern const char *SDL_GetPersistentString(const char *string);
 
 extern char *SDL_CreateDeviceName(Uint16 vendor, Uint16 product, const char *vendor_name, const char *product_name, const char *default_name);
@@ -22,16 +22,7 @@
 
 #include "SDL_audioqueue.h"
 #include "SDL_sysaudio.h"
-
-typedef struct SDL_MemoryPool SDL_MemoryPool;
-
-struct SDL_MemoryPool
-{
-    void *free_blocks;
-    size_t block_size;
-    size_t num_free;
-    size_t max_free;
-};
+#include "../SDL_objectpool.h"
 
 struct SDL_AudioTrack
 {
@@ -60,90 +51,16 @@ struct SDL_AudioQueue
     size_t history_length;
     size_t history_capacity;
 
-    SDL_MemoryPool track_pool;
-    SDL_MemoryPool chunk_pool;
+    SDL_ObjectPool track_pool;
+    SDL_ObjectPool chunk_pool;
 };
 
-// Allocate a new block, avoiding checking for ones already in the pool
-static void *AllocNewMemoryPoolBlock(const SDL_MemoryPool *pool)
-{
-    return SDL_malloc(pool->block_size);
-}
-
-// Allocate a new block, first checking if there are any in the pool
-static void *AllocMemoryPoolBlock(SDL_MemoryPool *pool)
-{
-    if (pool->num_free == 0) {
-        return AllocNewMemoryPoolBlock(pool);
-    }
-
-    void *block = pool->free_blocks;
-    pool->free_blocks = *(void **)block;
-    --pool->num_free;
-    return block;
-}
-
-// Free a block, or add it to the pool if there's room
-static void FreeMemoryPoolBlock(SDL_MemoryPool *pool, void *block)
-{
-    if (pool->num_free < pool->max_free) {
-        *(void **)block = pool->free_blocks;
-        pool->free_blocks = block;
-        ++pool->num_free;
-    } else {
-        SDL_free(block);
-    }
-}
-
-// Destroy a pool and all of its blocks
-static void DestroyMemoryPool(SDL_MemoryPool *pool)
-{
-    void *block = pool->free_blocks;
-    pool->free_blocks = NULL;
-    pool->num_free = 0;
-
-    while (block) {
-        void *next = *(void **)block;
-        SDL_free(block);
-        block = next;
-    }
-}
-
-// Keeping a list of free chunks reduces memory allocations,
-// But also increases the amount of work to perform when freeing the track.
-static void InitMemoryPool(SDL_MemoryPool *pool, size_t block_size, size_t max_free)
-{
-    SDL_zerop(pool);
-
-    SDL_assert(block_size >= sizeof(void *));
-    pool->block_size = block_size;
-    pool->max_free = max_free;
-}
-
-// Allocates a number of blocks and adds them to the pool
-static bool ReserveMemoryPoolBlocks(SDL_MemoryPool *pool, size_t num_blocks)
-{
-    for (; num_blocks; --num_blocks) {
-        void *block = AllocNewMemoryPoolBlock(pool);
-
-        if (block == NULL) {
-            return false;
-        }
-
-        *(void **)block = pool->free_blocks;
-        pool->free_blocks = block;
-        ++pool->num_free;
-    }
-
-    return true;
-}
-
 void SDL_DestroyAudioQueue(SDL_AudioQueue *queue)
 {
     SDL_ClearAudioQueue(queue);
 
-    DestroyMemoryPool(&queue->track_pool);
-    DestroyMemoryPool(&queue->chunk_pool);
+    SDL_QuitObjectPool(&queue->track_pool);
+    SDL_QuitObjectPool(&queue->chunk_pool);
     SDL_aligned_free(queue->history_buffer);
 
     SDL_free(queue);
@@ -157,10 +74,12 @@ SDL_AudioQueue *SDL_CreateAudioQueue(size_t chunk_size)
         return NULL;
     }
 
-    InitMemoryPool(&queue->track_pool, sizeof(SDL_AudioTrack), 8);
-    InitMemoryPool(&queue->chunk_pool, chunk_size, 4);
+    // Keeping a list of free chunks reduces memory allocations,
+    // But also increases the amount of work to perform when freeing the track.
+    SDL_InitObjectPool(&queue->track_pool, sizeof(SDL_AudioTrack), offsetof(SDL_AudioTrack, next), 8, SDL_MEMORY_TAG_AUDIO);
+    SDL_InitObjectPool(&queue->chunk_pool, chunk_size, 0, 4, SDL_MEMORY_TAG_AUDIO);
 
-    if (!ReserveMemoryPoolBlocks(&queue->track_pool, 2)) {
+    if (!SDL_ReserveObjects(&queue->track_pool, 2)) {
         SDL_DestroyAudioQueue(queue);
         return NULL;
     }
@@ -172,7 +91,7 @@ static void DestroyAudioTrack(SDL_AudioQueue *queue, SDL_AudioTrack *track)
 {
     track->callback(track->userdata, track->data, (int)track->capacity);
 
-    FreeMemoryPoolBlock(&queue->track_pool, track);
+    SDL_ReleaseObject(&queue->track_pool, track);
 }
 
 void SDL_ClearAudioQueue(SDL_AudioQueue *queue)
@@ -233,7 +152,7 @@ SDL_AudioTrack *SDL_CreateAudioTrack(
     Uint8 *data, size_t len, size_t capacity,
     SDL_ReleaseAudioBufferCallback callback, void *userdata)
 {
-    SDL_AudioTrack *track = (SDL_AudioTrack *)AllocMemoryPoolBlock(&queue->track_pool);
+    SDL_AudioTrack *track = (SDL_AudioTrack *)SDL_AllocateObject(&queue->track_pool);
 
     if (!track) {
         return NULL;
@@ -263,24 +182,24 @@ static void SDLCALL FreeChunkedAudioBuffer(void *userdata, const void *buf, int
 {
     SDL_AudioQueue *queue = (SDL_AudioQueue *)userdata;
 
-    FreeMemoryPoolBlock(&queue->chunk_pool, (void *)buf);
+    SDL_ReleaseObject(&queue->chunk_pool, (void *)buf);
 }
 
 static SDL_AudioTrack *CreateChunkedAudioTrack(SDL_AudioQueue *queue, const SDL_AudioSpec *spec, const int *chmap)
 {
-    Uint8 *chunk = (Uint8 *)AllocMemoryPoolBlock(&queue->chunk_pool);
+    Uint8 *chunk = (Uint8 *)SDL_AllocateObject(&queue->chunk_pool);
 
     if (!chunk) {
         return NULL;
     }
 
-    size_t capacity = queue->chunk_pool.block_size;
+    size_t capacity = queue->chunk_pool.object_size;
     capacity -= capacity % SDL_AUDIO_FRAMESIZE(*spec);
 
     SDL_AudioTrack *track = SDL_CreateAudioTrack(queue, spec, chmap, chunk, 0, capacity, FreeChunkedAudioBuffer, queue);
 
     if (!track) {
-        FreeMemoryPoolBlock(&queue->chunk_pool, chunk);
+        SDL_ReleaseObject(&queue->chunk_pool, chunk);
         return NULL;
     }
 
@@ -117,6 +117,11 @@ typedef struct SDL_evdevlist_item
     int min_x, max_x, range_x;
     int min_y, max_y, range_y;
 
+    // Motion reported since the last mouse motion event was sent
+    bool motion_pending;
+    int motion_x, motion_y;
+    Uint64 motion_timestamp;
+
     struct SDL_evdevlist_item *next;
 } SDL_evdevlist_item;
 
@@ -309,9 +314,42 @@ int SDL_EVDEV_GetDeviceCount(int device_class)
     return count;
 }
 
+/* High rate mice report motion thousands of times a second, so the motion
+   reported by each device is combined into a single event, sent once there is
+   nothing left to read or before any other event from the device. */
+static void SDL_EVDEV_flush_mouse_motion(SDL_evdevlist_item *item, SDL_Mouse *mouse)
+{
+    if (!item->motion_pending) {
+        return;
+    }
+    item->motion_pending = false;
+
+    if (item->relative_mouse) {
+        SDL_SendMouseMotion(item->motion_timestamp, mouse->focus, (SDL_MouseID)item->fd, item->relative_mouse, (float)item->motion_x, (float)item->motion_y);
+        item->motion_x = item->motion_y = 0;
+    } else if (item->range_x > 0 && item->range_y > 0) {
+        int screen_w = 0, screen_h = 0;
+        const SDL_DisplayMode *mode = NULL;
+
+        if (mouse->focus) {
+            mode = SDL_GetCurrentDisplayMode(SDL_GetDisplayForWindow(mouse->focus));
+        }
+        if (!mode) {
+            mode = SDL_GetCurrentDisplayMode(SDL_GetPrimaryDisplay());
+        }
+        if (mode) {
+            screen_w = mode->w;
+            screen_h = mode->h;
+        }
+        SDL_SendMouseMotion(item->motion_timestamp, mouse->focus, (SDL_MouseID)item->fd, item->relative_mouse,
+            (float)(item->mouse_x - item->min_x) * screen_w / item->range_x,
+            (float)(item->mouse_y - item->min_y) * screen_h / item->range_y);
+    }
+}
+
 void SDL_EVDEV_Poll(void)
 {
-    struct input_event events[32];
+    struct input_event events[256];
     int i, j, len;
     SDL_evdevlist_item *item;
     SDL_Scancode scancode;
@@ -347,6 +385,8 @@ void SDL_EVDEV_Poll(void)
 
                 switch (event->type) {
                 case EV_KEY:
+                    SDL_EVDEV_flush_mouse_motion(item, mouse);
+
                     if (event->code >= BTN_MOUSE && event->code < BTN_MOUSE + SDL_arraysize(EVDEV_MouseButtons)) {
                         Uint64 timestamp = SDL_EVDEV_GetEventTimestamp(event);
                         mouse_button = event->code - BTN_MOUSE;
@@ -488,35 +528,26 @@ void SDL_EVDEV_Poll(void)
                 case EV_SYN:
                     switch (event->code) {
                     case SYN_REPORT:
-                        // Send mouse axis changes together to ensure consistency and reduce event processing overhead
+                        // Collect mouse axis changes, to be sent together to ensure consistency and reduce event processing overhead
                         if (item->relative_mouse) {
                             if (item->mouse_x != 0 || item->mouse_y != 0) {
                                 Uint64 timestamp = SDL_EVDEV_GetEventTimestamp(event);
-                                SDL_SendMouseMotion(timestamp, mouse->focus, (SDL_MouseID)item->fd, item->relative_mouse, (float)item->mouse_x, (float)item->mouse_y);
+                                SDL_SendMouseSample(timestamp, (SDL_MouseID)item->fd, item->mouse_x, item->mouse_y);
+                                item->motion_x += item->mouse_x;
+                                item->motion_y += item->mouse_y;
+                                item->motion_timestamp = timestamp;
+                                item->motion_pending = true;
                                 item->mouse_x = item->mouse_y = 0;
                             }
                         } else if (item->range_x > 0 && item->range_y > 0) {
-                            int screen_w = 0, screen_h = 0;
-                            const SDL_DisplayMode *mode = NULL;
-
-                            if (mouse->focus) {
-                                mode = SDL_GetCurrentDisplayMode(SDL_GetDisplayForWindow(mouse->focus));
-                            }
-                            if (!mode) {
-                                mode = SDL_GetCurrentDisplayMode(SDL_GetPrimaryDisplay());
-                            }
-                            if (mode) {
-                                screen_w = mode->w;
-                                screen_h = mode->h;
-                            }
-                            SDL_SendMouseMotion(SDL_EVDEV_GetEventTimestamp(event), mouse->focus, (SDL_MouseID)item->fd, item->relative_mouse,
-                                (float)(item->mouse_x - item->min_x) * screen_w / item->range_x,
-                                (float)(item->mouse_y - item->min_y) * screen_h / item->range_y);
+                            item->motion_timestamp = SDL_EVDEV_GetEventTimestamp(event);
+                            item->motion_pending = true;
                         }
 
                         if (item->mouse_wheel != 0 || item->mouse_hwheel != 0) {
                             Uint64 timestamp = SDL_EVDEV_GetEventTimestamp(event);
                             const float denom = (item->high_res_hwheel ? 120.0f : 1.0f);
+                            SDL_EVDEV_flush_mouse_motion(item, mouse);
                             SDL_SendMouseWheel(timestamp,
                                                mouse->focus, (SDL_MouseID)item->fd,
                                                item->mouse_hwheel / denom,
@@ -529,6 +560,8 @@ void SDL_EVDEV_Poll(void)
                             break;
                         }
 
+                        SDL_EVDEV_flush_mouse_motion(item, mouse);
+
                         for (j = 0; j < item->touchscreen_data->max_slots; j++) {
                             norm_x = (float)(item->touchscreen_data->slots[j].x - item->touchscreen_data->min_x) /
                                      (float)item->touchscreen_data->range_x;
@@ -570,6 +603,7 @@ void SDL_EVDEV_Poll(void)
                         }
                         break;
                     case SYN_DROPPED:
+                        SDL_EVDEV_flush_mouse_motion(item, mouse);
                         if (item->is_touchscreen) {
                             item->out_of_sync = true;
                         }
@@ -582,6 +616,8 @@ void SDL_EVDEV_Poll(void)
                 }
             }
         }
+
+        SDL_EVDEV_flush_mouse_motion(item, mouse);
     }
 }
 
@@ -110,6 +110,7 @@
 #define CPU_HAS_LSX      (1 << 12)
 #define CPU_HAS_LASX     (1 << 13)
 #define CPU_HAS_SVE2     (1 << 14)
+#define CPU_HAS_PCLMUL   (1 << 15)
 
 #define CPU_CFG2      0x2
 #define CPU_CFG2_LSX  (1 << 6)
@@ -587,6 +588,11 @@ static int CPU_readCPUCFG(void)
 #else
 #define CPU_haveAVX() (0)
 #endif
+#ifdef __PCLMUL__
+#define CPU_havePCLMUL() (1)
+#else
+#define CPU_havePCLMUL() (0)
+#endif
 #else
 #define CPU_haveMMX()   (CPU_CPUIDFeatures[3] & 0x00800000)
 #define CPU_haveSSE()   (CPU_CPUIDFeatures[3] & 0x02000000)
@@ -595,6 +601,7 @@ static int CPU_readCPUCFG(void)
 #define CPU_haveSSE41() (CPU_CPUIDFeatures[2] & 0x00080000)
 #define CPU_haveSSE42() (CPU_CPUIDFeatures[2] & 0x00100000)
 #define CPU_haveAVX()   (CPU_OSSavesYMM && (CPU_CPUIDFeatures[2] & 0x10000000))
+#define CPU_havePCLMUL() (CPU_CPUIDFeatures[2] & 0x00000002)
 #endif
 
 #ifdef __e2k__
@@ -984,6 +991,8 @@ static Uint32 SDLCALL SDL_CPUFeatureMaskFromHint(void)
                 spot_mask = CPU_HAS_LASX;
             } else if (ref_string_equals("sve2", spot, end)) {
                 spot_mask = CPU_HAS_SVE2;
+            } else if (ref_string_equals("pclmul", spot, end)) {
+                spot_mask = CPU_HAS_PCLMUL;
             } else {
                 // Ignore unknown/incorrect cpu feature(s)
                 continue;
@@ -1064,6 +1073,9 @@ static Uint32 SDL_GetCPUFeatures(void)
             SDL_CPUFeatures |= CPU_HAS_SVE2;
             SDL_SIMDAlignment = SDL_max(SDL_SIMDAlignment, 16);
         }
+        if (CPU_havePCLMUL()) {
+            SDL_CPUFeatures |= CPU_HAS_PCLMUL;
+        }
         SDL_CPUFeatures &= SDL_CPUFeatureMaskFromHint();
     }
     return SDL_CPUFeatures;
@@ -1135,6 +1147,11 @@ bool SDL_HasNEON(void)
     return CPU_FEATURE_AVAILABLE(CPU_HAS_NEON);
 }
 
+bool SDL_HasPCLMUL(void)
+{
+    return CPU_FEATURE_AVAILABLE(CPU_HAS_PCLMUL);
+}
+
 bool SDL_HasLSX(void)
 {
     return CPU_FEATURE_AVAILABLE(CPU_HAS_LSX);
@@ -24,4 +24,7 @@
 
 extern void SDL_QuitCPUInfo(void);
 
+// Carry-less multiplication, used for CRC32 folding on x86
+extern bool SDL_HasPCLMUL(void);
+
 #endif // SDL_cpuinfo_c_h_
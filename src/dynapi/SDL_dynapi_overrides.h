@@ -1329,3 +1329,38 @@
 #define SDL_GetDeviceFormFactorName SDL_GetDeviceFormFactorName_REAL
 #define SDL_IsUbuntuTouch SDL_IsUbuntuTouch_REAL
 #define SDL_GetNumProperties SDL_GetNumProperties_REAL
+#define SDL_CreateTextureAtlas SDL_CreateTextureAtlas_REAL
+#define SDL_AddTextureAtlasEntry SDL_AddTextureAtlasEntry_REAL
+#define SDL_GetTextureAtlasEntry SDL_GetTextureAtlasEntry_REAL
+#define SDL_RemoveTextureAtlasEntry SDL_RemoveTextureAtlasEntry_REAL
+#define SDL_GetTextureAtlasOccupancy SDL_GetTextureAtlasOccupancy_REAL
+#define SDL_DestroyTextureAtlas SDL_DestroyTextureAtlas_REAL
+#define SDL_PollEvents SDL_PollEvents_REAL
+#define SDL_GetEventStats SDL_GetEventStats_REAL
+#define SDL_CreateFramePacer SDL_CreateFramePacer_REAL
+#define SDL_SetFramePacerPeriod SDL_SetFramePacerPeriod_REAL
+#define SDL_SetFramePacerRefreshRate SDL_SetFramePacerRefreshRate_REAL
+#define SDL_WaitFramePacer SDL_WaitFramePacer_REAL
+#define SDL_ResetFramePacer SDL_ResetFramePacer_REAL
+#define SDL_GetFramePacerStats SDL_GetFramePacerStats_REAL
+#define SDL_DestroyFramePacer SDL_DestroyFramePacer_REAL
+#define SDL_GetMouseSamples SDL_GetMouseSamples_REAL
+#define SDL_GetKeyboardSnapshot SDL_GetKeyboardSnapshot_REAL
+#define SDL_murmur3_64 SDL_murmur3_64_REAL
+#define SDL_GetPropertyAtom SDL_GetPropertyAtom_REAL
+#define SDL_GetPropertyAtomName SDL_GetPropertyAtomName_REAL
+#define SDL_SetPointerPropertyByAtom SDL_SetPointerPropertyByAtom_REAL
+#define SDL_SetStringPropertyByAtom SDL_SetStringPropertyByAtom_REAL
+#define SDL_SetNumberPropertyByAtom SDL_SetNumberPropertyByAtom_REAL
+#define SDL_SetFloatPropertyByAtom SDL_SetFloatPropertyByAtom_REAL
+#define SDL_SetBooleanPropertyByAtom SDL_SetBooleanPropertyByAtom_REAL
+#define SDL_GetPropertyTypeByAtom SDL_GetPropertyTypeByAtom_REAL
+#define SDL_GetPointerPropertyByAtom SDL_GetPointerPropertyByAtom_REAL
+#define SDL_GetStringPropertyByAtom SDL_GetStringPropertyByAtom_REAL
+#define SDL_GetNumberPropertyByAtom SDL_GetNumberPropertyByAtom_REAL
+#define SDL_GetFloatPropertyByAtom SDL_GetFloatPropertyByAtom_REAL
+#define SDL_GetBooleanPropertyByAtom SDL_GetBooleanPropertyByAtom_REAL
+#define SDL_ClearPropertyByAtom SDL_ClearPropertyByAtom_REAL
+#define SDL_GetMemoryStats SDL_GetMemoryStats_REAL
+#define SDL_SortByKey SDL_SortByKey_REAL
+#define SDL_ParallelSort SDL_ParallelSort_REAL
@@ -1337,3 +1337,38 @@ SDL_DYNAPI_PROC(SDL_FormFactor,SDL_GetDeviceFormFactor,(void),(),return)
 SDL_DYNAPI_PROC(const char*,SDL_GetDeviceFormFactorName,(SDL_FormFactor a),(a),return)
 SDL_DYNAPI_PROC(bool,SDL_IsUbuntuTouch,(void),(),return)
 SDL_DYNAPI_PROC(int,SDL_GetNumProperties,(SDL_PropertiesID a),(a),return)
+SDL_DYNAPI_PROC(SDL_TextureAtlas*,SDL_CreateTextureAtlas,(SDL_Renderer *a,SDL_PixelFormat b,int c,int d),(a,b,c,d),return)
+SDL_DYNAPI_PROC(SDL_TextureAtlasEntryID,SDL_AddTextureAtlasEntry,(SDL_TextureAtlas *a,SDL_Surface *b),(a,b),return)
+SDL_DYNAPI_PROC(bool,SDL_GetTextureAtlasEntry,(SDL_TextureAtlas *a,SDL_TextureAtlasEntryID b,SDL_Texture **c,SDL_FRect *d),(a,b,c,d),return)
+SDL_DYNAPI_PROC(bool,SDL_RemoveTextureAtlasEntry,(SDL_TextureAtlas *a,SDL_TextureAtlasEntryID b),(a,b),return)
+SDL_DYNAPI_PROC(bool,SDL_GetTextureAtlasOccupancy,(SDL_TextureAtlas *a,int *b,int *c,float *d),(a,b,c,d),return)
+SDL_DYNAPI_PROC(void,SDL_DestroyTextureAtlas,(SDL_TextureAtlas *a),(a),)
+SDL_DYNAPI_PROC(int,SDL_PollEvents,(SDL_Event *a,int b,const SDL_EventTypeRange *c,int d,SDL_PollEventsFlags e),(a,b,c,d,e),return)
+SDL_DYNAPI_PROC(SDL_PropertiesID,SDL_GetEventStats,(Uint32 a),(a),return)
+SDL_DYNAPI_PROC(SDL_FramePacer*,SDL_CreateFramePacer,(Uint64 a),(a),return)
+SDL_DYNAPI_PROC(bool,SDL_SetFramePacerPeriod,(SDL_FramePacer *a,Uint64 b),(a,b),return)
+SDL_DYNAPI_PROC(bool,SDL_SetFramePacerRefreshRate,(SDL_FramePacer *a,int b,int c),(a,b,c),return)
+SDL_DYNAPI_PROC(int,SDL_WaitFramePacer,(SDL_FramePacer *a),(a),return)
+SDL_DYNAPI_PROC(bool,SDL_ResetFramePacer,(SDL_FramePacer *a),(a),return)
+SDL_DYNAPI_PROC(bool,SDL_GetFramePacerStats,(SDL_FramePacer *a,SDL_FramePacerStats *b),(a,b),return)
+SDL_DYNAPI_PROC(void,SDL_DestroyFramePacer,(SDL_FramePacer *a),(a),)
+SDL_DYNAPI_PROC(int,SDL_GetMouseSamples,(SDL_MouseSample *a,int b),(a,b),return)
+SDL_DYNAPI_PROC(bool,SDL_GetKeyboardSnapshot,(SDL_KeyboardSnapshot *a),(a),return)
+SDL_DYNAPI_PROC(Uint64,SDL_murmur3_64,(const void *a,size_t b,Uint64 c),(a,b,c),return)
+SDL_DYNAPI_PROC(SDL_PropertyAtom,SDL_GetPropertyAtom,(const char *a),(a),return)
+SDL_DYNAPI_PROC(const char*,SDL_GetPropertyAtomName,(SDL_PropertyAtom a),(a),return)
+SDL_DYNAPI_PROC(bool,SDL_SetPointerPropertyByAtom,(SDL_PropertiesID a,SDL_PropertyAtom b,void *c),(a,b,c),return)
+SDL_DYNAPI_PROC(bool,SDL_SetStringPropertyByAtom,(SDL_PropertiesID a,SDL_PropertyAtom b,const char *c),(a,b,c),return)
+SDL_DYNAPI_PROC(bool,SDL_SetNumberPropertyByAtom,(SDL_PropertiesID a,SDL_PropertyAtom b,Sint64 c),(a,b,c),return)
+SDL_DYNAPI_PROC(bool,SDL_SetFloatPropertyByAtom,(SDL_PropertiesID a,SDL_PropertyAtom b,float c),(a,b,c),return)
+SDL_DYNAPI_PROC(bool,SDL_SetBooleanPropertyByAtom,(SDL_PropertiesID a,SDL_PropertyAtom b,bool c),(a,b,c),return)
+SDL_DYNAPI_PROC(SDL_PropertyType,SDL_GetPropertyTypeByAtom,(SDL_PropertiesID a,SDL_PropertyAtom b),(a,b),return)
+SDL_DYNAPI_PROC(void*,SDL_GetPointerPropertyByAtom,(SDL_PropertiesID a,SDL_PropertyAtom b,void *c),(a,b,c),return)
+SDL_DYNAPI_PROC(const char*,SDL_GetStringPropertyByAtom,(SDL_PropertiesID a,SDL_PropertyAtom b,const char *c),(a,b,c),return)
+SDL_DYNAPI_PROC(Sint64,SDL_GetNumberPropertyByAtom,(SDL_PropertiesID a,SDL_PropertyAtom b,Sint64 c),(a,b,c),return)
+SDL_DYNAPI_PROC(float,SDL_GetFloatPropertyByAtom,(SDL_PropertiesID a,SDL_PropertyAtom b,float c),(a,b,c),return)
+SDL_DYNAPI_PROC(bool,SDL_GetBooleanPropertyByAtom,(SDL_PropertiesID a,SDL_PropertyAtom b,bool c),(a,b,c),return)
+SDL_DYNAPI_PROC(bool,SDL_ClearPropertyByAtom,(SDL_PropertiesID a,SDL_PropertyAtom b),(a,b),return)
+SDL_DYNAPI_PROC(bool,SDL_GetMemoryStats,(SDL_MemoryTag a,SDL_MemoryStats *b),(a,b),return)
+SDL_DYNAPI_PROC(bool,SDL_SortByKey,(void *a,size_t b,size_t c,size_t d,SDL_SortKeyType e),(a,b,c,d,e),return)
+SDL_DYNAPI_PROC(void,SDL_ParallelSort,(void *a,size_t b,size_t c,SDL_CompareCallback_r d,void *e,int f),(a,b,c,d,e,f),)
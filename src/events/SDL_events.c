@@ -26,6 +26,8 @@
 #include "SDL_eventwatch_c.h"
 #include "SDL_windowevents_c.h"
 #include "../SDL_hints_c.h"
+#include "../SDL_objectpool.h"
+#include "../stdlib/SDL_malloc_c.h"
 #include "../audio/SDL_audio_c.h"
 #include "../camera/SDL_camera_c.h"
 #include "../timer/SDL_timer_c.h"
@@ -126,9 +128,49 @@ typedef struct
 static SDL_DisabledEventBlock *SDL_disabled_events[256];
 static SDL_AtomicInt SDL_userevents;
 
+/* Counters reported by SDL_GetEventStats(), in blocks of 256 event types allocated on
+ * first use. Everything but 'filtered' is only updated with the queue locked.
+ */
+typedef struct
+{
+    Uint64 pushed;
+    Uint64 dropped;
+    Uint64 popped;
+    Uint64 latency_count; // popped events that had a timestamp
+    Uint64 latency_total;
+    Uint64 latency_max;
+    SDL_AtomicInt filtered;
+} SDL_EventTypeStats;
+
+typedef struct
+{
+    SDL_EventTypeStats types[256];
+} SDL_EventStatsBlock;
+
+static SDL_EventStatsBlock *SDL_event_stats[256]; // accessed atomically
+
+/* Small temporary allocations are carved out of per-thread arenas, with their tracking
+ * entry right in front of the memory, instead of two separate heap blocks each. An arena
+ * is reference counted: each allocation holds a reference, wherever its event went, and
+ * the thread allocating from it holds one more. Once every allocation has been freed, the
+ * thread starts over at the beginning of the arena, otherwise it moves on to a new one
+ * when it fills up and the old one goes away with its last allocation.
+ */
+#define SDL_TEMPORARY_MEMORY_ARENA_SIZE 4096
+#define SDL_TEMPORARY_MEMORY_ARENA_MAX  1024 // larger allocations get their own heap block
+#define SDL_TEMPORARY_MEMORY_ALIGN(x)   (((x) + 15) & ~(size_t)15)
+
+typedef struct SDL_TemporaryMemoryArena
+{
+    SDL_AtomicInt refcount;
+    size_t used;
+} SDL_TemporaryMemoryArena;
+
 typedef struct SDL_TemporaryMemory
 {
     void *memory;
+    SDL_TemporaryMemoryArena *arena; // NULL if the memory is a heap block of its own
+    size_t size;
     struct SDL_TemporaryMemory *prev;
     struct SDL_TemporaryMemory *next;
 } SDL_TemporaryMemory;
@@ -137,6 +179,7 @@ typedef struct SDL_TemporaryMemoryState
 {
     SDL_TemporaryMemory *head;
     SDL_TemporaryMemory *tail;
+    SDL_TemporaryMemoryArena *arena;
 } SDL_TemporaryMemoryState;
 
 static SDL_TLSID SDL_temporary_memory;
@@ -152,13 +195,46 @@ typedef struct SDL_EventEntry
 static struct
 {
     SDL_Mutex *lock;
-    bool active;
-    SDL_AtomicInt count;
+    SDL_AtomicInt active;
+    SDL_AtomicInt count; // the number of events in the list, not counting the ring
+    SDL_AtomicInt producers; // the number of threads pushing into the ring right now
     int max_events_seen;
     SDL_EventEntry *head;
     SDL_EventEntry *tail;
-    SDL_EventEntry *free;
-} SDL_EventQ = { NULL, false, { 0 }, 0, NULL, NULL, NULL };
+    SDL_ObjectPool free;
+} SDL_EventQ = { NULL, { 0 }, { 0 }, { 0 }, 0, NULL, NULL, { 0 } };
+
+/* New events are pushed into a bounded lock-free ring, so threads posting events don't
+ * contend on the queue lock. Whoever holds the queue lock is the single consumer, it
+ * takes events straight from the ring when possible and moves them into the list above
+ * for the operations that scan or remove events in the middle of the queue.
+ *
+ * Events in the list are always older than the ones in the ring.
+ */
+#define SDL_EVENT_RING_SIZE 256 // must be a power of 2
+#define SDL_EVENT_RING_MASK (SDL_EVENT_RING_SIZE - 1)
+
+// How many times to spin waiting for another thread before yielding to it
+#define SDL_EVENT_RING_SPINS 64
+
+typedef struct SDL_EventRingSlot
+{
+    SDL_AtomicInt sequence;
+    SDL_EventEntry entry;
+} SDL_EventRingSlot;
+
+static struct
+{
+    SDL_EventRingSlot slots[SDL_EVENT_RING_SIZE];
+
+    char cache_pad1[SDL_CACHELINE_SIZE];
+
+    SDL_AtomicInt enqueue_pos;
+
+    char cache_pad2[SDL_CACHELINE_SIZE - sizeof(SDL_AtomicInt)];
+
+    unsigned dequeue_pos; // only used with the queue locked
+} SDL_EventRing;
 
 
 SDL_Mutex *SDL_event_lock = NULL; // This needs to support recursive locks
@@ -178,11 +254,21 @@ void SDL_DestroyEventLock(void)
     }
 }
 
+static void SDL_ReleaseTemporaryMemoryArena(SDL_TemporaryMemoryArena *arena)
+{
+    if (SDL_AtomicDecRef(&arena->refcount)) {
+        SDL_free_tagged(SDL_MEMORY_TAG_EVENTS, arena, SDL_TEMPORARY_MEMORY_ARENA_SIZE);
+    }
+}
+
 static void SDL_CleanupTemporaryMemory(void *data)
 {
     SDL_TemporaryMemoryState *state = (SDL_TemporaryMemoryState *)data;
 
     SDL_FreeTemporaryMemory();
+    if (state->arena) {
+        SDL_ReleaseTemporaryMemoryArena(state->arena);
+    }
     SDL_free(state);
 }
 
@@ -257,12 +343,59 @@ static void SDL_UnlinkTemporaryMemoryEntry(SDL_TemporaryMemoryState *state, SDL_
 
 static void SDL_FreeTemporaryMemoryEntry(SDL_TemporaryMemoryState *state, SDL_TemporaryMemory *entry, bool free_data)
 {
+    if (entry->arena) {
+        // The entry and its memory live in the arena, they go away with it
+        SDL_ReleaseTemporaryMemoryArena(entry->arena);
+        return;
+    }
+
     if (free_data) {
         SDL_free(entry->memory);
     }
     SDL_free(entry);
 }
 
+static SDL_TemporaryMemory *SDL_AllocateTemporaryMemoryFromArena(SDL_TemporaryMemoryState *state, size_t size)
+{
+    const size_t header = SDL_TEMPORARY_MEMORY_ALIGN(sizeof(SDL_TemporaryMemoryArena));
+    const size_t needed = SDL_TEMPORARY_MEMORY_ALIGN(sizeof(SDL_TemporaryMemory)) + SDL_TEMPORARY_MEMORY_ALIGN(size);
+    SDL_TemporaryMemoryArena *arena = state->arena;
+    SDL_TemporaryMemory *entry;
+
+    if (size > SDL_TEMPORARY_MEMORY_ARENA_MAX) {
+        return NULL;
+    }
+
+    if (arena && SDL_GetAtomicInt(&arena->refcount) == 1) {
+        // Everything allocated from it has been freed, reuse it from the start
+        arena->used = header;
+    }
+
+    if (!arena || arena->used + needed > SDL_TEMPORARY_MEMORY_ARENA_SIZE) {
+        if (arena) {
+            state->arena = NULL;
+            SDL_ReleaseTemporaryMemoryArena(arena);
+        }
+
+        arena = (SDL_TemporaryMemoryArena *)SDL_malloc_tagged(SDL_MEMORY_TAG_EVENTS, SDL_TEMPORARY_MEMORY_ARENA_SIZE);
+        if (!arena) {
+            return NULL;
+        }
+        SDL_SetAtomicInt(&arena->refcount, 1);
+        arena->used = header;
+        state->arena = arena;
+    }
+
+    entry = (SDL_TemporaryMemory *)((Uint8 *)arena + arena->used);
+    entry->memory = (Uint8 *)entry + SDL_TEMPORARY_MEMORY_ALIGN(sizeof(SDL_TemporaryMemory));
+    entry->arena = arena;
+    entry->size = size;
+    arena->used += needed;
+    SDL_AtomicIncRef(&arena->refcount);
+
+    return entry;
+}
+
 static void SDL_LinkTemporaryMemoryToEvent(SDL_EventEntry *event, const void *mem)
 {
     SDL_TemporaryMemoryState *state;
@@ -369,6 +502,8 @@ static void *SDL_FreeLater(void *memory)
     }
 
     entry->memory = memory;
+    entry->arena = NULL;
+    entry->size = 0;
 
     SDL_LinkTemporaryMemoryEntry(state, entry);
 
@@ -377,13 +512,29 @@ static void *SDL_FreeLater(void *memory)
 
 void *SDL_AllocateTemporaryMemory(size_t size)
 {
+    SDL_TemporaryMemoryState *state;
+    SDL_TemporaryMemory *entry;
+
+    state = SDL_GetTemporaryMemoryState(true);
+    if (state) {
+        entry = SDL_AllocateTemporaryMemoryFromArena(state, size);
+        if (entry) {
+            SDL_LinkTemporaryMemoryEntry(state, entry);
+            return entry->memory;
+        }
+    }
     return SDL_FreeLater(SDL_malloc(size));
 }
 
 const char *SDL_CreateTemporaryString(const char *string)
 {
     if (string) {
-        return (const char *)SDL_FreeLater(SDL_strdup(string));
+        const size_t len = SDL_strlen(string) + 1;
+        char *copy = (char *)SDL_AllocateTemporaryMemory(len);
+        if (copy) {
+            SDL_memcpy(copy, string, len);
+        }
+        return copy;
     }
     return NULL;
 }
@@ -396,9 +547,19 @@ void *SDL_ClaimTemporaryMemory(const void *mem)
     if (state && mem) {
         SDL_TemporaryMemory *entry = SDL_GetTemporaryMemoryEntry(state, mem);
         if (entry) {
+            void *result = (void *)mem;
+
+            if (entry->arena) {
+                // The caller owns the result and frees it with SDL_free(), so it needs a heap block
+                result = SDL_malloc(entry->size);
+                if (!result) {
+                    return NULL;
+                }
+                SDL_memcpy(result, mem, entry->size);
+            }
             SDL_UnlinkTemporaryMemoryEntry(state, entry);
             SDL_FreeTemporaryMemoryEntry(state, entry, false);
-            return (void *)mem;
+            return result;
         }
     }
     return NULL;
@@ -982,16 +1143,271 @@ static void SDL_LogEvent(const SDL_Event *event)
     }
 }
 
+static SDL_EventTypeStats *SDL_GetEventTypeStats(Uint32 type)
+{
+    const Uint8 hi = ((type >> 8) & 0xff);
+    SDL_EventStatsBlock *block;
+
+    if (type == SDL_EVENT_POLL_SENTINEL) {
+        // This one is internal, it's not reported
+        return NULL;
+    }
+
+    block = (SDL_EventStatsBlock *)SDL_GetAtomicPointer((void **)&SDL_event_stats[hi]);
+    if (!block) {
+        // Filtered events are counted without the queue lock, so another thread may get here first
+        block = (SDL_EventStatsBlock *)SDL_calloc_tagged(SDL_MEMORY_TAG_EVENTS, 1, sizeof(*block));
+        if (!block) {
+            return NULL;
+        }
+        if (!SDL_CompareAndSwapAtomicPointer((void **)&SDL_event_stats[hi], NULL, block)) {
+            SDL_free_tagged(SDL_MEMORY_TAG_EVENTS, block, sizeof(*block));
+            block = (SDL_EventStatsBlock *)SDL_GetAtomicPointer((void **)&SDL_event_stats[hi]);
+        }
+    }
+    return &block->types[type & 0xff];
+}
+
+// Called with the queue locked
+static void SDL_CountEventPushed(const SDL_Event *event)
+{
+    SDL_EventTypeStats *stats = SDL_GetEventTypeStats(event->type);
+    if (stats) {
+        ++stats->pushed;
+    }
+}
+
+// Called with the queue locked
+static void SDL_CountEventDropped(const SDL_Event *event)
+{
+    SDL_EventTypeStats *stats = SDL_GetEventTypeStats(event->type);
+    if (stats) {
+        ++stats->dropped;
+    }
+}
+
+/* Called with the queue locked, 'now' is 0 until the first event of a batch needs it,
+ * so retrieving a batch of events only checks the time once.
+ */
+static void SDL_CountEventPopped(const SDL_Event *event, Uint64 *now)
+{
+    SDL_EventTypeStats *stats = SDL_GetEventTypeStats(event->type);
+    if (stats) {
+        ++stats->popped;
+        if (event->common.timestamp) {
+            Uint64 latency;
+
+            if (!*now) {
+                *now = SDL_GetTicksNS();
+            }
+            latency = (*now > event->common.timestamp) ? (*now - event->common.timestamp) : 0;
+            ++stats->latency_count;
+            stats->latency_total += latency;
+            if (latency > stats->latency_max) {
+                stats->latency_max = latency;
+            }
+        }
+    }
+}
+
+static void SDL_QuitEventStats(void)
+{
+    int i;
+
+    for (i = 0; i < SDL_arraysize(SDL_event_stats); ++i) {
+        SDL_EventStatsBlock *block = (SDL_EventStatsBlock *)SDL_SetAtomicPointer((void **)&SDL_event_stats[i], NULL);
+        if (block) {
+            SDL_free_tagged(SDL_MEMORY_TAG_EVENTS, block, sizeof(*block));
+        }
+    }
+}
+
+// Fill in a queue entry for an event, this runs on the thread posting the event
+static void SDL_PrepareEventEntry(SDL_EventEntry *entry, const SDL_Event *event)
+{
+    if (SDL_EventLoggingVerbosity > 0) {
+        SDL_LogEvent(event);
+    }
+
+    SDL_copyp(&entry->event, event);
+    if (event->type == SDL_EVENT_POLL_SENTINEL) {
+        SDL_AddAtomicInt(&SDL_sentinel_pending, 1);
+    }
+    entry->memory = NULL;
+    SDL_TransferTemporaryMemoryToEvent(entry);
+}
+
+// Append an entry to the end of the list -- called with the queue locked
+static void SDL_LinkEvent(SDL_EventEntry *entry)
+{
+    const int count = SDL_AddAtomicInt(&SDL_EventQ.count, 1) + 1 +
+                      (int)((unsigned)SDL_GetAtomicInt(&SDL_EventRing.enqueue_pos) - SDL_EventRing.dequeue_pos);
+
+    if (SDL_EventQ.tail) {
+        SDL_EventQ.tail->next = entry;
+        entry->prev = SDL_EventQ.tail;
+        SDL_EventQ.tail = entry;
+        entry->next = NULL;
+    } else {
+        SDL_assert(!SDL_EventQ.head);
+        SDL_EventQ.head = entry;
+        SDL_EventQ.tail = entry;
+        entry->prev = NULL;
+        entry->next = NULL;
+    }
+
+    if (count > SDL_EventQ.max_events_seen) {
+        SDL_EventQ.max_events_seen = count;
+    }
+    SDL_CountEventPushed(&entry->event);
+
+    ++SDL_last_event_id;
+}
+
+static void SDL_InitEventRing(void)
+{
+    int i;
+
+    for (i = 0; i < SDL_EVENT_RING_SIZE; ++i) {
+        SDL_SetAtomicInt(&SDL_EventRing.slots[i].sequence, i);
+    }
+    SDL_SetAtomicInt(&SDL_EventRing.enqueue_pos, 0);
+    SDL_EventRing.dequeue_pos = 0;
+}
+
+// Add an event to the ring without locking, returns false if the ring is full
+static bool SDL_PushEventRing(const SDL_Event *event)
+{
+    SDL_EventRingSlot *slot;
+    unsigned queue_pos;
+    unsigned slot_seq;
+    int delta;
+
+    // The list is nearly full, let the slow path sort it out
+    if (SDL_GetAtomicInt(&SDL_EventQ.count) >= SDL_MAX_QUEUED_EVENTS - SDL_EVENT_RING_SIZE) {
+        return false;
+    }
+
+    queue_pos = (unsigned)SDL_GetAtomicInt(&SDL_EventRing.enqueue_pos);
+    for (;;) {
+        slot = &SDL_EventRing.slots[queue_pos & SDL_EVENT_RING_MASK];
+        slot_seq = (unsigned)SDL_GetAtomicInt(&slot->sequence);
+
+        delta = (int)(slot_seq - queue_pos);
+        if (delta == 0) {
+            // The slot and the queue position match, try to claim the slot
+            if (SDL_CompareAndSwapAtomicInt(&SDL_EventRing.enqueue_pos, (int)queue_pos, (int)(queue_pos + 1))) {
+                break;
+            }
+        } else if (delta < 0) {
+            // The slot still holds an event from the previous lap, the ring is full
+            return false;
+        } else {
+            // Another thread took this slot, get the new queue position
+            queue_pos = (unsigned)SDL_GetAtomicInt(&SDL_EventRing.enqueue_pos);
+        }
+    }
+
+    SDL_PrepareEventEntry(&slot->entry, event);
+    SDL_SetAtomicInt(&slot->sequence, (int)(queue_pos + 1));
+    return true;
+}
+
+// Get the oldest event in the ring, if it has been published -- called with the queue locked
+static SDL_EventEntry *SDL_PeekEventRing(void)
+{
+    const unsigned queue_pos = SDL_EventRing.dequeue_pos;
+    SDL_EventRingSlot *slot = &SDL_EventRing.slots[queue_pos & SDL_EVENT_RING_MASK];
+
+    if ((unsigned)SDL_GetAtomicInt(&slot->sequence) == queue_pos + 1) {
+        return &slot->entry;
+    }
+    return NULL;
+}
+
+// Give the oldest slot in the ring back to the producers -- called with the queue locked
+static void SDL_PopEventRing(void)
+{
+    const unsigned queue_pos = SDL_EventRing.dequeue_pos;
+    SDL_EventRingSlot *slot = &SDL_EventRing.slots[queue_pos & SDL_EVENT_RING_MASK];
+
+    SDL_SetAtomicInt(&slot->sequence, (int)(queue_pos + SDL_EVENT_RING_SIZE));
+    SDL_EventRing.dequeue_pos = queue_pos + 1;
+}
+
+/* Wait a little for another thread to make progress. This spins briefly and then yields,
+ * so a producer that was preempted in the middle of filling a slot gets to run again,
+ * even if it's on the same core.
+ */
+static void SDL_EventRingBackoff(int *spins)
+{
+    if (*spins < SDL_EVENT_RING_SPINS) {
+        ++*spins;
+        SDL_CPUPauseInstruction();
+    } else {
+        SDL_Delay(0);
+    }
+}
+
+/* Move the events in the ring to the end of the list -- called with the queue locked
+ * If 'wait' is true, this also waits for slots that were claimed but not filled yet,
+ * so that an event added to the list afterwards is newer than everything in the ring.
+ */
+static void SDL_DrainEventRing(bool wait)
+{
+    const unsigned end = (unsigned)SDL_GetAtomicInt(&SDL_EventRing.enqueue_pos);
+    int spins = 0;
+
+    for (;;) {
+        SDL_EventEntry *slot_entry = SDL_PeekEventRing();
+        SDL_EventEntry *entry;
+
+        if (!slot_entry) {
+            if (wait && (int)(end - SDL_EventRing.dequeue_pos) > 0) {
+                SDL_EventRingBackoff(&spins);
+                continue;
+            }
+            break;
+        }
+
+        entry = (SDL_EventEntry *)SDL_AllocateObject(&SDL_EventQ.free);
+        if (entry == NULL) {
+            // Leave the rest in the ring, it'll be picked up later
+            break;
+        }
+
+        SDL_copyp(&entry->event, &slot_entry->event);
+        entry->memory = slot_entry->memory;
+        SDL_PopEventRing();
+        SDL_LinkEvent(entry);
+    }
+}
+
 void SDL_StopEventLoop(void)
 {
     const char *report = SDL_GetHint("SDL_EVENT_QUEUE_STATISTICS");
     int i;
     SDL_EventEntry *entry;
     SDL_Mutex *lock = SDL_EventQ.lock;
+    int spins = 0;
+
+    // This waits for watchers that are running, do it before locking the queue they may use
+    SDL_QuitEventWatchList(&SDL_event_watchers);
+    SDL_QuitWindowEventWatch();
 
     SDL_LockMutex(lock);
 
-    SDL_EventQ.active = false;
+    SDL_SetAtomicInt(&SDL_EventQ.active, 0);
+
+    /* Threads that saw the queue active before this may still be pushing into the ring,
+     * wait for them so that nothing is left behind in the ring after it's cleaned out.
+     */
+    while (SDL_GetAtomicInt(&SDL_EventQ.producers) > 0) {
+        SDL_EventRingBackoff(&spins);
+    }
+
+    // Anything still in the ring gets cleaned out with the rest of the queue
+    SDL_DrainEventRing(true);
 
     if (report && SDL_atoi(report)) {
         SDL_Log("SDL EVENT QUEUE: Maximum events in-flight: %d",
@@ -1002,20 +1418,15 @@ void SDL_StopEventLoop(void)
     for (entry = SDL_EventQ.head; entry;) {
         SDL_EventEntry *next = entry->next;
         SDL_TransferTemporaryMemoryFromEvent(entry);
-        SDL_free(entry);
-        entry = next;
-    }
-    for (entry = SDL_EventQ.free; entry;) {
-        SDL_EventEntry *next = entry->next;
-        SDL_free(entry);
+        SDL_ReleaseObject(&SDL_EventQ.free, entry);
         entry = next;
     }
+    SDL_QuitObjectPool(&SDL_EventQ.free);
 
     SDL_SetAtomicInt(&SDL_EventQ.count, 0);
     SDL_EventQ.max_events_seen = 0;
     SDL_EventQ.head = NULL;
     SDL_EventQ.tail = NULL;
-    SDL_EventQ.free = NULL;
     SDL_SetAtomicInt(&SDL_sentinel_pending, 0);
 
     // Clear disabled event state
@@ -1024,8 +1435,7 @@ void SDL_StopEventLoop(void)
         SDL_disabled_events[i] = NULL;
     }
 
-    SDL_QuitEventWatchList(&SDL_event_watchers);
-    SDL_QuitWindowEventWatch();
+    SDL_QuitEventStats();
 
     SDL_EventQ.lock = NULL;
 
@@ -1060,7 +1470,12 @@ bool SDL_StartEventLoop(void)
 
     SDL_InitWindowEventWatch();
 
-    SDL_EventQ.active = true;
+    if (!SDL_GetAtomicInt(&SDL_EventQ.active)) {
+        // Removed entries are kept for new events, up to as many as the queue can hold
+        SDL_InitObjectPool(&SDL_EventQ.free, sizeof(SDL_EventEntry), offsetof(SDL_EventEntry, next), SDL_MAX_QUEUED_EVENTS, SDL_MEMORY_TAG_EVENTS);
+        SDL_InitEventRing();
+        SDL_SetAtomicInt(&SDL_EventQ.active, 1);
+    }
 
 #ifndef SDL_THREADS_DISABLED
     SDL_UnlockMutex(SDL_EventQ.lock);
@@ -1073,53 +1488,24 @@ static int SDL_AddEvent(SDL_Event *event)
 {
     SDL_EventEntry *entry;
     const int initial_count = SDL_GetAtomicInt(&SDL_EventQ.count);
-    int final_count;
 
     if (initial_count >= SDL_MAX_QUEUED_EVENTS) {
+        SDL_CountEventDropped(event);
         SDL_SetError("Event queue is full (%d events)", initial_count);
         return 0;
     }
 
-    if (SDL_EventQ.free == NULL) {
-        entry = (SDL_EventEntry *)SDL_malloc(sizeof(*entry));
-        if (entry == NULL) {
-            return 0;
-        }
-    } else {
-        entry = SDL_EventQ.free;
-        SDL_EventQ.free = entry->next;
-    }
-
-    if (SDL_EventLoggingVerbosity > 0) {
-        SDL_LogEvent(event);
-    }
-
-    SDL_copyp(&entry->event, event);
-    if (event->type == SDL_EVENT_POLL_SENTINEL) {
-        SDL_AddAtomicInt(&SDL_sentinel_pending, 1);
-    }
-    entry->memory = NULL;
-    SDL_TransferTemporaryMemoryToEvent(entry);
-
-    if (SDL_EventQ.tail) {
-        SDL_EventQ.tail->next = entry;
-        entry->prev = SDL_EventQ.tail;
-        SDL_EventQ.tail = entry;
-        entry->next = NULL;
-    } else {
-        SDL_assert(!SDL_EventQ.head);
-        SDL_EventQ.head = entry;
-        SDL_EventQ.tail = entry;
-        entry->prev = NULL;
-        entry->next = NULL;
+    entry = (SDL_EventEntry *)SDL_AllocateObject(&SDL_EventQ.free);
+    if (entry == NULL) {
+        SDL_CountEventDropped(event);
+        return 0;
     }
 
-    final_count = SDL_AddAtomicInt(&SDL_EventQ.count, 1) + 1;
-    if (final_count > SDL_EventQ.max_events_seen) {
-        SDL_EventQ.max_events_seen = final_count;
-    }
+    // Everything that made it into the ring so far is older than this event
+    SDL_DrainEventRing(true);
 
-    ++SDL_last_event_id;
+    SDL_PrepareEventEntry(entry, event);
+    SDL_LinkEvent(entry);
 
     return 1;
 }
@@ -1149,8 +1535,7 @@ static void SDL_CutEvent(SDL_EventEntry *entry)
         SDL_AddAtomicInt(&SDL_sentinel_pending, -1);
     }
 
-    entry->next = SDL_EventQ.free;
-    SDL_EventQ.free = entry;
+    SDL_ReleaseObject(&SDL_EventQ.free, entry);
     SDL_assert(SDL_GetAtomicInt(&SDL_EventQ.count) > 0);
     SDL_AddAtomicInt(&SDL_EventQ.count, -1);
 }
@@ -1178,14 +1563,61 @@ static int SDL_PeepEventsInternal(SDL_Event *events, int numevents, SDL_EventAct
                                   Uint32 minType, Uint32 maxType, bool include_sentinel)
 {
     int i, used, sentinels_expected = 0;
+    Uint64 now = 0;
 
-    // Lock the event queue
     used = 0;
 
+    if (action == SDL_ADDEVENT) {
+        CHECK_PARAM(!events) {
+            SDL_InvalidParamError("events");
+            return -1;
+        }
+
+        /* Don't add after we've quit
+         * SDL_StopEventLoop() clears 'active' and then waits for 'producers' to drop to zero,
+         * so either it sees us here or we see that the queue isn't active anymore.
+         */
+        SDL_AddAtomicInt(&SDL_EventQ.producers, 1);
+        if (!SDL_GetAtomicInt(&SDL_EventQ.active)) {
+            SDL_AddAtomicInt(&SDL_EventQ.producers, -1);
+            return -1;
+        }
+
+        for (i = 0; i < numevents; ++i) {
+            if (!SDL_PushEventRing(&events[i])) {
+                break;
+            }
+            ++used;
+        }
+        SDL_AddAtomicInt(&SDL_EventQ.producers, -1);
+
+        if (i < numevents) {
+            // The ring is full, fall back to adding to the list
+            SDL_LockMutex(SDL_EventQ.lock);
+            {
+                if (SDL_GetAtomicInt(&SDL_EventQ.active)) {
+                    for (; i < numevents; ++i) {
+                        used += SDL_AddEvent(&events[i]);
+                    }
+                }
+            }
+            SDL_UnlockMutex(SDL_EventQ.lock);
+        }
+
+        if (used > 0) {
+            SDL_SendWakeupEvent();
+        }
+        return used;
+    }
+
+    // Lock the event queue
     SDL_LockMutex(SDL_EventQ.lock);
     {
+        SDL_EventEntry *entry, *next;
+        Uint32 type;
+
         // Don't look after we've quit
-        if (!SDL_EventQ.active) {
+        if (!SDL_GetAtomicInt(&SDL_EventQ.active)) {
             // We get a few spurious events at shutdown, so don't warn then
             if (action == SDL_GETEVENT) {
                 SDL_SetError("The event system has been shut down");
@@ -1193,18 +1625,25 @@ static int SDL_PeepEventsInternal(SDL_Event *events, int numevents, SDL_EventAct
             SDL_UnlockMutex(SDL_EventQ.lock);
             return -1;
         }
-        if (action == SDL_ADDEVENT) {
-            CHECK_PARAM(!events) {
-                SDL_UnlockMutex(SDL_EventQ.lock);
-                SDL_InvalidParamError("events");
-                return -1;
-            }
-            for (i = 0; i < numevents; ++i) {
-                used += SDL_AddEvent(&events[i]);
+
+        // Take events straight from the ring while there's nothing older in the list
+        if (action == SDL_GETEVENT && events && !SDL_EventQ.head) {
+            while (used < numevents && (entry = SDL_PeekEventRing()) != NULL) {
+                type = entry->event.type;
+                if (type < minType || type > maxType || type == SDL_EVENT_POLL_SENTINEL) {
+                    break;
+                }
+                SDL_copyp(&events[used], &entry->event);
+                SDL_TransferTemporaryMemoryFromEvent(entry);
+                SDL_PopEventRing();
+                SDL_CountEventPushed(&events[used]);
+                SDL_CountEventPopped(&events[used], &now);
+                ++used;
             }
-        } else {
-            SDL_EventEntry *entry, *next;
-            Uint32 type;
+        }
+
+        if (events == NULL || used < numevents) {
+            SDL_DrainEventRing(false);
 
             for (entry = SDL_EventQ.head; entry && (events == NULL || used < numevents); entry = next) {
                 next = entry->next;
@@ -1214,6 +1653,7 @@ static int SDL_PeepEventsInternal(SDL_Event *events, int numevents, SDL_EventAct
                         SDL_copyp(&events[used], &entry->event);
 
                         if (action == SDL_GETEVENT) {
+                            SDL_CountEventPopped(&entry->event, &now);
                             SDL_CutEvent(entry);
                         }
                     }
@@ -1238,10 +1678,6 @@ static int SDL_PeepEventsInternal(SDL_Event *events, int numevents, SDL_EventAct
     }
     SDL_UnlockMutex(SDL_EventQ.lock);
 
-    if (used > 0 && action == SDL_ADDEVENT) {
-        SDL_SendWakeupEvent();
-    }
-
     return used;
 }
 int SDL_PeepEvents(SDL_Event *events, int numevents, SDL_EventAction action,
@@ -1261,7 +1697,8 @@ bool SDL_HasEvents(Uint32 minType, Uint32 maxType)
 
     SDL_LockMutex(SDL_EventQ.lock);
     {
-        if (SDL_EventQ.active) {
+        if (SDL_GetAtomicInt(&SDL_EventQ.active)) {
+            SDL_DrainEventRing(false);
             for (SDL_EventEntry *entry = SDL_EventQ.head; entry; entry = entry->next) {
                 const Uint32 type = entry->event.type;
                 if (minType <= type && type <= maxType) {
@@ -1298,10 +1735,11 @@ void SDL_FlushEvents(Uint32 minType, Uint32 maxType)
     SDL_LockMutex(SDL_EventQ.lock);
     {
         // Don't look after we've quit
-        if (!SDL_EventQ.active) {
+        if (!SDL_GetAtomicInt(&SDL_EventQ.active)) {
             SDL_UnlockMutex(SDL_EventQ.lock);
             return;
         }
+        SDL_DrainEventRing(false);
         for (entry = SDL_EventQ.head; entry; entry = next) {
             next = entry->next;
             type = entry->event.type;
@@ -1313,6 +1751,68 @@ void SDL_FlushEvents(Uint32 minType, Uint32 maxType)
     SDL_UnlockMutex(SDL_EventQ.lock);
 }
 
+SDL_PropertiesID SDL_GetEventStats(Uint32 type)
+{
+    Uint64 pushed = 0, dropped = 0, popped = 0, latency_count = 0, latency_total = 0, latency_max = 0;
+    Sint64 filtered = 0;
+    int queued, max_queued;
+    SDL_PropertiesID props;
+    int hi, lo;
+
+    SDL_LockMutex(SDL_EventQ.lock);
+    {
+        if (!SDL_GetAtomicInt(&SDL_EventQ.active)) {
+            SDL_UnlockMutex(SDL_EventQ.lock);
+            SDL_SetError("The event system has been shut down");
+            return 0;
+        }
+
+        // Events that made it into the ring haven't been counted yet
+        SDL_DrainEventRing(false);
+
+        for (hi = 0; hi < SDL_arraysize(SDL_event_stats); ++hi) {
+            const SDL_EventStatsBlock *block = (const SDL_EventStatsBlock *)SDL_GetAtomicPointer((void **)&SDL_event_stats[hi]);
+            if (!block) {
+                continue;
+            }
+            for (lo = 0; lo < SDL_arraysize(block->types); ++lo) {
+                const SDL_EventTypeStats *stats = &block->types[lo];
+                if (type != 0 && (Uint32)((hi << 8) | lo) != type) {
+                    continue;
+                }
+                pushed += stats->pushed;
+                dropped += stats->dropped;
+                popped += stats->popped;
+                latency_count += stats->latency_count;
+                latency_total += stats->latency_total;
+                latency_max = SDL_max(latency_max, stats->latency_max);
+                filtered += SDL_GetAtomicInt((SDL_AtomicInt *)&stats->filtered);
+            }
+        }
+
+        queued = SDL_GetAtomicInt(&SDL_EventQ.count) +
+                 (int)((unsigned)SDL_GetAtomicInt(&SDL_EventRing.enqueue_pos) - SDL_EventRing.dequeue_pos);
+        max_queued = SDL_EventQ.max_events_seen;
+    }
+    SDL_UnlockMutex(SDL_EventQ.lock);
+
+    // Every call gets its own group, so callers on different threads don't see each other's numbers
+    props = SDL_CreateProperties();
+    if (!props) {
+        return 0;
+    }
+    SDL_SetNumberProperty(props, SDL_PROP_EVENT_STATS_PUSHED_NUMBER, (Sint64)pushed);
+    SDL_SetNumberProperty(props, SDL_PROP_EVENT_STATS_FILTERED_NUMBER, filtered);
+    SDL_SetNumberProperty(props, SDL_PROP_EVENT_STATS_DROPPED_NUMBER, (Sint64)dropped);
+    SDL_SetNumberProperty(props, SDL_PROP_EVENT_STATS_POPPED_NUMBER, (Sint64)popped);
+    SDL_SetNumberProperty(props, SDL_PROP_EVENT_STATS_LATENCY_AVERAGE_NUMBER, latency_count ? (Sint64)(latency_total / latency_count) : 0);
+    SDL_SetNumberProperty(props, SDL_PROP_EVENT_STATS_LATENCY_MAX_NUMBER, (Sint64)latency_max);
+    SDL_SetNumberProperty(props, SDL_PROP_EVENT_STATS_QUEUED_NUMBER, queued);
+    SDL_SetNumberProperty(props, SDL_PROP_EVENT_STATS_MAX_QUEUED_NUMBER, max_queued);
+
+    return props;
+}
+
 typedef enum
 {
     SDL_MAIN_CALLBACK_WAITING,
@@ -1581,6 +2081,150 @@ bool SDL_PollEvent(SDL_Event *event)
     return SDL_WaitEventTimeoutNS(event, 0);
 }
 
+static bool SDL_EventTypeInRanges(Uint32 type, const SDL_EventTypeRange *ranges, int num_ranges)
+{
+    int i;
+
+    if (!ranges) {
+        return true;
+    }
+    for (i = 0; i < num_ranges; ++i) {
+        if (ranges[i].min_type <= type && type <= ranges[i].max_type) {
+            return true;
+        }
+    }
+    return false;
+}
+
+/* Compare a motion event that was already retrieved with a newer one.
+ * Returns 1 if the newer one can be merged into it, 0 if it's unrelated motion that
+ * can be looked past, and -1 if it's anything else and we need to stop looking.
+ */
+static int SDL_CompareMotionEvents(const SDL_Event *event, const SDL_Event *newer)
+{
+    switch (event->type) {
+    case SDL_EVENT_MOUSE_MOTION:
+        if (newer->type != SDL_EVENT_MOUSE_MOTION || newer->motion.which != event->motion.which) {
+            return 0;
+        }
+        // The same mouse moving in another window isn't something we can look past
+        return (newer->motion.windowID == event->motion.windowID) ? 1 : -1;
+    case SDL_EVENT_PEN_MOTION:
+        if (newer->type != SDL_EVENT_PEN_MOTION || newer->pmotion.which != event->pmotion.which) {
+            return 0;
+        }
+        return (newer->pmotion.windowID == event->pmotion.windowID) ? 1 : -1;
+    case SDL_EVENT_GAMEPAD_AXIS_MOTION:
+        if (newer->type != SDL_EVENT_GAMEPAD_AXIS_MOTION || newer->gaxis.which != event->gaxis.which) {
+            return 0;
+        }
+        return (newer->gaxis.axis == event->gaxis.axis) ? 1 : 0;
+    default:
+        return -1;
+    }
+}
+
+// Try to merge a motion event into one of the events already retrieved
+static bool SDL_CoalesceMotionEvent(SDL_Event *events, int numevents, const SDL_Event *event)
+{
+    int i;
+
+    switch (event->type) {
+    case SDL_EVENT_MOUSE_MOTION:
+    case SDL_EVENT_PEN_MOTION:
+    case SDL_EVENT_GAMEPAD_AXIS_MOTION:
+        break;
+    default:
+        return false;
+    }
+
+    for (i = numevents - 1; i >= 0; --i) {
+        const int result = SDL_CompareMotionEvents(&events[i], event);
+        if (result > 0) {
+            if (event->type == SDL_EVENT_MOUSE_MOTION) {
+                const float xrel = events[i].motion.xrel + event->motion.xrel;
+                const float yrel = events[i].motion.yrel + event->motion.yrel;
+                SDL_copyp(&events[i], event);
+                events[i].motion.xrel = xrel;
+                events[i].motion.yrel = yrel;
+            } else {
+                SDL_copyp(&events[i], event);
+            }
+            return true;
+        }
+        if (result < 0) {
+            break;
+        }
+    }
+    return false;
+}
+
+int SDL_PollEvents(SDL_Event *events, int numevents, const SDL_EventTypeRange *ranges, int num_ranges, SDL_PollEventsFlags flags)
+{
+    const bool coalesce = ((flags & SDL_POLLEVENTS_COALESCE_MOTION) != 0);
+    SDL_EventEntry *entry, *next;
+    Uint64 now = 0;
+    int used = 0;
+    int coalesce_start = 0;
+
+    CHECK_PARAM(!events) {
+        SDL_InvalidParamError("events");
+        return -1;
+    }
+    CHECK_PARAM(numevents < 0) {
+        SDL_InvalidParamError("numevents");
+        return -1;
+    }
+    CHECK_PARAM(ranges && num_ranges < 0) {
+        SDL_InvalidParamError("num_ranges");
+        return -1;
+    }
+
+    SDL_PumpEventsInternal(false);
+
+    SDL_LockMutex(SDL_EventQ.lock);
+    {
+        // Don't look after we've quit
+        if (!SDL_GetAtomicInt(&SDL_EventQ.active)) {
+            SDL_UnlockMutex(SDL_EventQ.lock);
+            SDL_SetError("The event system has been shut down");
+            return -1;
+        }
+
+        SDL_DrainEventRing(false);
+
+        for (entry = SDL_EventQ.head; entry; entry = next) {
+            const Uint32 type = entry->event.type;
+
+            next = entry->next;
+            if (type == SDL_EVENT_POLL_SENTINEL) {
+                // The sentinel belongs to an SDL_PollEvent() cycle, leave it for that
+                continue;
+            }
+            if (!SDL_EventTypeInRanges(type, ranges, num_ranges)) {
+                // Events left in the queue end any run of motion returned before them
+                coalesce_start = used;
+                continue;
+            }
+            if (coalesce && SDL_CoalesceMotionEvent(&events[coalesce_start], used - coalesce_start, &entry->event)) {
+                SDL_CountEventPopped(&entry->event, &now);
+                SDL_CutEvent(entry);
+                continue;
+            }
+            if (used == numevents) {
+                break;
+            }
+            SDL_copyp(&events[used], &entry->event);
+            SDL_CountEventPopped(&entry->event, &now);
+            SDL_CutEvent(entry);
+            ++used;
+        }
+    }
+    SDL_UnlockMutex(SDL_EventQ.lock);
+
+    return used;
+}
+
 #ifndef SDL_PLATFORM_ANDROID
 
 static Sint64 SDL_events_get_polling_interval(void)
@@ -1835,6 +2479,10 @@ bool SDL_PushEvent(SDL_Event *event)
     }
 
     if (!SDL_CallEventWatchers(event)) {
+        SDL_EventTypeStats *stats = SDL_GetEventTypeStats(event->type);
+        if (stats) {
+            SDL_AtomicIncRef(&stats->filtered);
+        }
         SDL_ClearError();
         return false;
     }
@@ -1852,12 +2500,11 @@ void SDL_SetEventFilter(SDL_EventFilter filter, void *userdata)
     SDL_LockMutex(SDL_event_lock);
     {
         // Set filter and discard pending events
-        SDL_event_watchers.filter.callback = filter;
-        SDL_event_watchers.filter.userdata = userdata;
-        if (filter) {
+        if (SDL_SetEventWatchListFilter(&SDL_event_watchers, filter, userdata) && filter) {
             // Cut all events not accepted by the filter
             SDL_LockMutex(SDL_EventQ.lock);
             {
+                SDL_DrainEventRing(false);
                 for (event = SDL_EventQ.head; event; event = next) {
                     next = event->next;
                     if (!filter(userdata, &event->event)) {
@@ -1905,6 +2552,7 @@ void SDL_FilterEvents(SDL_EventFilter filter, void *userdata)
     SDL_LockMutex(SDL_EventQ.lock);
     {
         SDL_EventEntry *entry, *next;
+        SDL_DrainEventRing(false);
         for (entry = SDL_EventQ.head; entry; entry = next) {
             next = entry->next;
             if (!filter(userdata, &entry->event)) {
@@ -24,6 +24,129 @@
 #include "SDL_events_c.h"
 
 
+/* Dispatch doesn't take any lock: it counts itself in list->readers and uses whatever
+ * snapshot is published at that time. Add and remove build a new snapshot and swap it
+ * in while holding SDL_event_lock, so writers are serialized against each other. The
+ * snapshot that was replaced goes on the retired list and is freed by the next writer
+ * or the last reader to leave that sees no dispatch in progress. Because a reader
+ * always increments list->readers before loading the snapshot, any dispatch that
+ * starts after the swap sees the new snapshot and can't hold on to a retired one.
+ *
+ * Each dispatch also counts itself in the readers of the snapshot it uses, and checks
+ * that the snapshot is still the published one after that. Removing a watcher flags it
+ * in the published snapshot and in every retired one, since dispatches that started
+ * earlier may still be in any of them, and then waits for the readers of all of those.
+ * Once it returns, the callback won't be called anymore, except by a dispatch of the
+ * same list further up the stack of the calling thread.
+ */
+
+static int SDL_GetEventWatchDepth(SDL_EventWatchList *list)
+{
+    return (int)(intptr_t)SDL_GetTLS(&list->depth);
+}
+
+static void SDL_SetEventWatchDepth(SDL_EventWatchList *list, int depth)
+{
+    SDL_SetTLS(&list->depth, (void *)(intptr_t)depth, NULL);
+}
+
+// Flags a watcher as removed in a snapshot, returns true if it was there
+static bool SDL_FlagEventWatcherRemoved(SDL_EventWatchSnapshot *snapshot, SDL_EventFilter filter, void *userdata)
+{
+    int i;
+
+    for (i = 0; i < snapshot->count; ++i) {
+        SDL_EventWatcher *watcher = &snapshot->watchers[i];
+
+        if (watcher->callback == filter && watcher->userdata == userdata && !SDL_GetAtomicInt(&watcher->removed)) {
+            SDL_SetAtomicInt(&watcher->removed, 1);
+            return true;
+        }
+    }
+    return false;
+}
+
+// Must be called without SDL_event_lock held, the callbacks we're waiting for may need it
+static void SDL_WaitForEventWatchReaders(SDL_AtomicInt *readers)
+{
+    while (SDL_GetAtomicInt(readers) > 0) {
+        SDL_Delay(1);
+    }
+}
+
+// Must be called with SDL_event_lock held
+static void SDL_ReclaimEventWatchSnapshots(SDL_EventWatchList *list)
+{
+    SDL_EventWatchSnapshot *snapshot, *next;
+
+    if (SDL_GetAtomicInt(&list->readers) != 0) {
+        return;
+    }
+
+    snapshot = (SDL_EventWatchSnapshot *)SDL_GetAtomicPointer((void **)&list->retired);
+    SDL_SetAtomicPointer((void **)&list->retired, NULL);
+    for (; snapshot; snapshot = next) {
+        next = snapshot->next_retired;
+        SDL_free(snapshot);
+    }
+}
+
+// Must be called with SDL_event_lock held
+static void SDL_PublishEventWatchSnapshot(SDL_EventWatchList *list, SDL_EventWatchSnapshot *snapshot)
+{
+    SDL_EventWatchSnapshot *old = (SDL_EventWatchSnapshot *)SDL_GetAtomicPointer((void **)&list->snapshot);
+
+    SDL_SetAtomicPointer((void **)&list->snapshot, snapshot);
+    if (old) {
+        old->next_retired = (SDL_EventWatchSnapshot *)SDL_GetAtomicPointer((void **)&list->retired);
+        SDL_SetAtomicPointer((void **)&list->retired, old);
+    }
+    SDL_ReclaimEventWatchSnapshots(list);
+}
+
+/* Builds a copy of the current snapshot, leaving out removed watchers and making room
+ * for 'extra' more at the end. Must be called with SDL_event_lock held.
+ */
+static bool SDL_CopyEventWatchSnapshot(SDL_EventWatchList *list, int extra, SDL_EventWatchSnapshot **result)
+{
+    SDL_EventWatchSnapshot *old = (SDL_EventWatchSnapshot *)SDL_GetAtomicPointer((void **)&list->snapshot);
+    SDL_EventWatchSnapshot *snapshot;
+    int i, count = extra;
+
+    if (old) {
+        for (i = 0; i < old->count; ++i) {
+            if (!SDL_GetAtomicInt(&old->watchers[i].removed)) {
+                ++count;
+            }
+        }
+    }
+
+    if (!list->filter.callback && count == 0) {
+        // Nothing to dispatch, readers can skip the list entirely
+        *result = NULL;
+        return true;
+    }
+
+    snapshot = (SDL_EventWatchSnapshot *)SDL_malloc(sizeof(*snapshot) + count * sizeof(SDL_EventWatcher));
+    if (!snapshot) {
+        return false;
+    }
+    snapshot->filter = list->filter;
+    snapshot->watchers = (SDL_EventWatcher *)(snapshot + 1);
+    snapshot->count = 0;
+    SDL_SetAtomicInt(&snapshot->readers, 0);
+    snapshot->next_retired = NULL;
+    if (old) {
+        for (i = 0; i < old->count; ++i) {
+            if (!SDL_GetAtomicInt(&old->watchers[i].removed)) {
+                snapshot->watchers[snapshot->count++] = old->watchers[i];
+            }
+        }
+    }
+    *result = snapshot;
+    return true;
+}
+
 bool SDL_InitEventWatchList(SDL_EventWatchList *list)
 {
     return true;
@@ -31,55 +154,77 @@ bool SDL_InitEventWatchList(SDL_EventWatchList *list)
 
 void SDL_QuitEventWatchList(SDL_EventWatchList *list)
 {
-    if (list->watchers) {
-        SDL_free(list->watchers);
-        list->watchers = NULL;
-        list->count = 0;
+    SDL_LockMutex(SDL_event_lock);
+    {
+        SDL_PublishEventWatchSnapshot(list, NULL);
+        SDL_zero(list->filter);
+    }
+    SDL_UnlockMutex(SDL_event_lock);
+
+    /* Dispatches in progress may still be using the old snapshots. If we're in one of
+       them, the last reader to leave frees them instead. */
+    if (SDL_GetEventWatchDepth(list) == 0) {
+        SDL_WaitForEventWatchReaders(&list->readers);
+
+        SDL_LockMutex(SDL_event_lock);
+        SDL_ReclaimEventWatchSnapshots(list);
+        SDL_UnlockMutex(SDL_event_lock);
     }
-    SDL_zero(list->filter);
 }
 
 bool SDL_DispatchEventWatchList(SDL_EventWatchList *list, SDL_Event *event)
 {
-    SDL_EventWatcher *filter = &list->filter;
+    SDL_EventWatchSnapshot *snapshot;
+    bool result = true;
 
-    if (!filter->callback && list->count == 0) {
+    if (!SDL_GetAtomicPointer((void **)&list->snapshot)) {
         return true;
     }
 
-    SDL_LockMutex(SDL_event_lock);
-    {
-        // Make sure we only dispatch the current watcher list
-        int i, count = list->count;
+    SDL_AtomicIncRef(&list->readers);
+    for (;;) {
+        snapshot = (SDL_EventWatchSnapshot *)SDL_GetAtomicPointer((void **)&list->snapshot);
+        if (!snapshot) {
+            break;
+        }
+        SDL_AtomicIncRef(&snapshot->readers);
+        if (snapshot == SDL_GetAtomicPointer((void **)&list->snapshot)) {
+            break;
+        }
+        // It was replaced in the meantime, a writer may have already checked for readers
+        SDL_AtomicDecRef(&snapshot->readers);
+    }
+    if (snapshot) {
+        SDL_EventWatcher *filter = &snapshot->filter;
+        const int depth = SDL_GetEventWatchDepth(list);
 
+        SDL_SetEventWatchDepth(list, depth + 1);
         if (filter->callback && !filter->callback(filter->userdata, event)) {
-            SDL_UnlockMutex(SDL_event_lock);
-            return false;
-        }
+            result = false;
+        } else {
+            int i;
 
-        list->dispatching = true;
-        for (i = 0; i < count; ++i) {
-            if (!list->watchers[i].removed) {
-                list->watchers[i].callback(list->watchers[i].userdata, event);
-            }
-        }
-        list->dispatching = false;
-
-        if (list->removed) {
-            for (i = list->count; i--;) {
-                if (list->watchers[i].removed) {
-                    --list->count;
-                    if (i < list->count) {
-                        SDL_memmove(&list->watchers[i], &list->watchers[i + 1], (list->count - i) * sizeof(list->watchers[i]));
-                    }
+            for (i = 0; i < snapshot->count; ++i) {
+                SDL_EventWatcher *watcher = &snapshot->watchers[i];
+
+                // Watchers removed while we're dispatching aren't called anymore
+                if (!SDL_GetAtomicInt(&watcher->removed)) {
+                    watcher->callback(watcher->userdata, event);
                 }
             }
-            list->removed = false;
+        }
+        SDL_SetEventWatchDepth(list, depth);
+        SDL_AtomicDecRef(&snapshot->readers);
+    }
+    if (SDL_AtomicDecRef(&list->readers) && SDL_GetAtomicPointer((void **)&list->retired)) {
+        // Don't wait for the lock, the next writer will clean up if it's busy
+        if (SDL_TryLockMutex(SDL_event_lock)) {
+            SDL_ReclaimEventWatchSnapshots(list);
+            SDL_UnlockMutex(SDL_event_lock);
         }
     }
-    SDL_UnlockMutex(SDL_event_lock);
 
-    return true;
+    return result;
 }
 
 bool SDL_AddEventWatchList(SDL_EventWatchList *list, SDL_EventFilter filter, void *userdata)
@@ -88,18 +233,15 @@ bool SDL_AddEventWatchList(SDL_EventWatchList *list, SDL_EventFilter filter, voi
 
     SDL_LockMutex(SDL_event_lock);
     {
-        SDL_EventWatcher *watchers;
+        SDL_EventWatchSnapshot *snapshot;
 
-        watchers = (SDL_EventWatcher *)SDL_realloc(list->watchers, (list->count + 1) * sizeof(*watchers));
-        if (watchers) {
-            SDL_EventWatcher *watcher;
+        if (SDL_CopyEventWatchSnapshot(list, 1, &snapshot)) {
+            SDL_EventWatcher *watcher = &snapshot->watchers[snapshot->count++];
 
-            list->watchers = watchers;
-            watcher = &list->watchers[list->count];
             watcher->callback = filter;
             watcher->userdata = userdata;
-            watcher->removed = false;
-            ++list->count;
+            SDL_SetAtomicInt(&watcher->removed, 0);
+            SDL_PublishEventWatchSnapshot(list, snapshot);
         } else {
             result = false;
         }
@@ -111,24 +253,75 @@ bool SDL_AddEventWatchList(SDL_EventWatchList *list, SDL_EventFilter filter, voi
 
 void SDL_RemoveEventWatchList(SDL_EventWatchList *list, SDL_EventFilter filter, void *userdata)
 {
+    SDL_EventWatchSnapshot *old = NULL;
+    SDL_EventWatchSnapshot *retired = NULL;
+
     SDL_LockMutex(SDL_event_lock);
     {
-        int i;
-
-        for (i = 0; i < list->count; ++i) {
-            if (list->watchers[i].callback == filter && list->watchers[i].userdata == userdata) {
-                if (list->dispatching) {
-                    list->watchers[i].removed = true;
-                    list->removed = true;
-                } else {
-                    --list->count;
-                    if (i < list->count) {
-                        SDL_memmove(&list->watchers[i], &list->watchers[i + 1], (list->count - i) * sizeof(list->watchers[i]));
-                    }
+        SDL_EventWatchSnapshot *current = (SDL_EventWatchSnapshot *)SDL_GetAtomicPointer((void **)&list->snapshot);
+        SDL_EventWatchSnapshot *snapshot;
+
+        /* Flag it in the published snapshot so dispatches in progress skip it.
+           If we're out of memory, the flag is all it takes and the entry is
+           left out of the next snapshot instead. */
+        if (current && SDL_FlagEventWatcherRemoved(current, filter, userdata)) {
+            // Count ourselves as a reader so no snapshot is freed while we wait
+            SDL_AtomicIncRef(&list->readers);
+            if (SDL_CopyEventWatchSnapshot(list, 0, &snapshot)) {
+                SDL_PublishEventWatchSnapshot(list, snapshot);
+            }
+
+            /* Dispatches that started before earlier changes have their own copy of the watcher.
+               Nothing is reclaimed while we count as a reader, so these stay around. */
+            retired = (SDL_EventWatchSnapshot *)SDL_GetAtomicPointer((void **)&list->retired);
+            for (snapshot = retired; snapshot; snapshot = snapshot->next_retired) {
+                SDL_FlagEventWatcherRemoved(snapshot, filter, userdata);
+            }
+            old = current;
+        }
+    }
+    SDL_UnlockMutex(SDL_event_lock);
+
+    if (old) {
+        // A dispatch of this list on this thread may be using one of them, we can't wait for it
+        if (SDL_GetEventWatchDepth(list) == 0) {
+            SDL_EventWatchSnapshot *snapshot;
+
+            // If we couldn't publish a new snapshot, the old one isn't among the retired ones
+            SDL_WaitForEventWatchReaders(&old->readers);
+            for (snapshot = retired; snapshot; snapshot = snapshot->next_retired) {
+                if (snapshot != old) {
+                    SDL_WaitForEventWatchReaders(&snapshot->readers);
                 }
-                break;
             }
         }
+
+        SDL_LockMutex(SDL_event_lock);
+        SDL_AtomicDecRef(&list->readers);
+        SDL_ReclaimEventWatchSnapshots(list);
+        SDL_UnlockMutex(SDL_event_lock);
+    }
+}
+
+bool SDL_SetEventWatchListFilter(SDL_EventWatchList *list, SDL_EventFilter filter, void *userdata)
+{
+    bool result = true;
+
+    SDL_LockMutex(SDL_event_lock);
+    {
+        SDL_EventWatcher old_filter = list->filter;
+        SDL_EventWatchSnapshot *snapshot;
+
+        list->filter.callback = filter;
+        list->filter.userdata = userdata;
+        if (SDL_CopyEventWatchSnapshot(list, 0, &snapshot)) {
+            SDL_PublishEventWatchSnapshot(list, snapshot);
+        } else {
+            list->filter = old_filter;
+            result = false;
+        }
     }
     SDL_UnlockMutex(SDL_event_lock);
+
+    return result;
 }
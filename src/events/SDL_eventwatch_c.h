@@ -24,16 +24,29 @@ typedef struct SDL_EventWatcher
 {
     SDL_EventFilter callback;
     void *userdata;
-    bool removed;
+    SDL_AtomicInt removed;
 } SDL_EventWatcher;
 
-typedef struct SDL_EventWatchList
+/* An immutable copy of the watchers, dispatch reads it without taking any lock.
+ * Changing the list publishes a new snapshot, old ones are freed once no dispatch
+ * is running anymore.
+ */
+typedef struct SDL_EventWatchSnapshot
 {
     SDL_EventWatcher filter;
     SDL_EventWatcher *watchers;
     int count;
-    bool dispatching;
-    bool removed;
+    SDL_AtomicInt readers;
+    struct SDL_EventWatchSnapshot *next_retired;
+} SDL_EventWatchSnapshot;
+
+typedef struct SDL_EventWatchList
+{
+    SDL_EventWatcher filter;
+    SDL_EventWatchSnapshot *snapshot; // accessed atomically
+    SDL_EventWatchSnapshot *retired;  // accessed atomically
+    SDL_AtomicInt readers;
+    SDL_TLSID depth; // how many dispatches of this list are running on the current thread
 } SDL_EventWatchList;
 
 
@@ -42,3 +55,4 @@ extern void SDL_QuitEventWatchList(SDL_EventWatchList *list);
 extern bool SDL_DispatchEventWatchList(SDL_EventWatchList *list, SDL_Event *event);
 extern bool SDL_AddEventWatchList(SDL_EventWatchList *list, SDL_EventFilter filter, void *userdata);
 extern void SDL_RemoveEventWatchList(SDL_EventWatchList *list, SDL_EventFilter filter, void *userdata);
+extern bool SDL_SetEventWatchListFilter(SDL_EventWatchList *list, SDL_EventFilter filter, void *userdata);
@@ -51,12 +51,17 @@ typedef struct SDL_Keyboard
     SDL_Keymod modstate;
     Uint8 keysource[SDL_SCANCODE_COUNT];
     bool keystate[SDL_SCANCODE_COUNT];
+    SDL_SpinLock snapshot_lock;
+    SDL_KeyboardSnapshot snapshot;
     SDL_Keymap *keymap;
     Uint32 keycode_options;
     bool autorelease_pending;
     Uint64 hardware_timestamp;
 } SDL_Keyboard;
 
+// The snapshot bitmaps need to cover every scancode
+SDL_COMPILE_TIME_ASSERT(keyboard_snapshot_bits, (SDL_SCANCODE_COUNT % 64) == 0);
+
 static SDL_Keyboard SDL_keyboard;
 static int SDL_keyboard_count;
 static SDL_KeyboardID *SDL_keyboards;
@@ -564,6 +569,20 @@ static bool SDL_SendKeyboardKeyInternal(Uint64 timestamp, Uint32 flags, SDL_Keyb
         }
 
         // Update internal keyboard state
+        if (!repeat) {
+            const Uint64 bit = ((Uint64)1 << (scancode & 63));
+            const int word = (scancode >> 6);
+
+            SDL_LockSpinlock(&keyboard->snapshot_lock);
+            if (down) {
+                keyboard->snapshot.down[word] |= bit;
+                keyboard->snapshot.pressed[word] |= bit;
+            } else {
+                keyboard->snapshot.down[word] &= ~bit;
+                keyboard->snapshot.released[word] |= bit;
+            }
+            SDL_UnlockSpinlock(&keyboard->snapshot_lock);
+        }
         keyboard->keystate[scancode] = down;
 
         keycode = SDL_GetKeyFromScancode(scancode, keyboard->modstate, true);
@@ -942,6 +961,23 @@ const bool *SDL_GetKeyboardState(int *numkeys)
     return keyboard->keystate;
 }
 
+bool SDL_GetKeyboardSnapshot(SDL_KeyboardSnapshot *snapshot)
+{
+    SDL_Keyboard *keyboard = &SDL_keyboard;
+
+    CHECK_PARAM(!snapshot) {
+        return SDL_InvalidParamError("snapshot");
+    }
+
+    SDL_LockSpinlock(&keyboard->snapshot_lock);
+    SDL_copyp(snapshot, &keyboard->snapshot);
+    SDL_zeroa(keyboard->snapshot.pressed);
+    SDL_zeroa(keyboard->snapshot.released);
+    SDL_UnlockSpinlock(&keyboard->snapshot_lock);
+
+    return true;
+}
+
 SDL_Keymod SDL_GetModState(void)
 {
     SDL_Keyboard *keyboard = &SDL_keyboard;
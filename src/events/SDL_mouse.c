@@ -41,6 +41,13 @@ static SDL_MouseID *SDL_mice;
 static SDL_HashTable *SDL_mouse_names;
 static bool SDL_mouse_initialized;
 
+// Raw motion samples, added as events are pumped and read by the application
+#define SDL_MAX_MOUSE_SAMPLES (1 << 20)
+static SDL_MouseSample *SDL_mouse_samples;
+static Uint32 SDL_mouse_samples_mask;
+static SDL_AtomicU32 SDL_mouse_samples_head;
+static SDL_AtomicU32 SDL_mouse_samples_tail;
+
 // for mapping mouse events to touch
 static bool track_mouse_down = false;
 
@@ -226,6 +233,27 @@ static void SDLCALL SDL_MouseIntegerModeChanged(void *userdata, const char *name
     }
 }
 
+static void SDL_InitMouseSamples(void)
+{
+    const char *hint = SDL_GetHint(SDL_HINT_MOUSE_SAMPLE_BUFFER_SIZE);
+    int requested = hint ? SDL_atoi(hint) : 0;
+    Uint32 size = 1;
+
+    if (requested <= 0) {
+        return;
+    }
+    while (size < (Uint32)SDL_min(requested, SDL_MAX_MOUSE_SAMPLES)) {
+        size <<= 1;
+    }
+
+    SDL_mouse_samples = (SDL_MouseSample *)SDL_malloc(size * sizeof(*SDL_mouse_samples));
+    if (SDL_mouse_samples) {
+        SDL_mouse_samples_mask = size - 1;
+        SDL_SetAtomicU32(&SDL_mouse_samples_head, 0);
+        SDL_SetAtomicU32(&SDL_mouse_samples_tail, 0);
+    }
+}
+
 // Public functions
 bool SDL_PreInitMouse(void)
 {
@@ -288,6 +316,8 @@ bool SDL_PreInitMouse(void)
 
     SDL_mouse_names = SDL_CreateHashTable(0, true, SDL_HashID, SDL_KeyMatchID, SDL_DestroyHashValue, NULL);
 
+    SDL_InitMouseSamples();
+
     return true;
 }
 
@@ -1203,6 +1233,10 @@ void SDL_QuitMouse(void)
     SDL_DestroyHashTable(SDL_mouse_names);
     SDL_mouse_names = NULL;
 
+    SDL_free(SDL_mouse_samples);
+    SDL_mouse_samples = NULL;
+    SDL_mouse_samples_mask = 0;
+
     if (mouse->internal) {
         SDL_free(mouse->internal);
         mouse->internal = NULL;
@@ -1249,6 +1283,63 @@ SDL_MouseButtonFlags SDL_GetRelativeMouseState(float *x, float *y)
     return SDL_GetMouseButtonState(mouse, SDL_GLOBAL_MOUSE_ID, true);
 }
 
+void SDL_SendMouseSample(Uint64 timestamp, SDL_MouseID mouseID, int dx, int dy)
+{
+    SDL_MouseSample *sample;
+    Uint32 head;
+
+    if (!SDL_mouse_samples) {
+        return;
+    }
+
+    // Samples are only added while pumping events, so only the reader moves the tail
+    head = SDL_GetAtomicU32(&SDL_mouse_samples_head);
+    if (head - SDL_GetAtomicU32(&SDL_mouse_samples_tail) > SDL_mouse_samples_mask) {
+        // The buffer is full, drop the sample
+        return;
+    }
+
+    sample = &SDL_mouse_samples[head & SDL_mouse_samples_mask];
+    sample->timestamp = timestamp;
+    sample->which = mouseID;
+    sample->dx = dx;
+    sample->dy = dy;
+    SDL_SetAtomicU32(&SDL_mouse_samples_head, head + 1);
+}
+
+int SDL_GetMouseSamples(SDL_MouseSample *samples, int count)
+{
+    Uint32 head, tail, available, first;
+
+    CHECK_PARAM(count < 0) {
+        SDL_InvalidParamError("count");
+        return -1;
+    }
+
+    if (!SDL_mouse_samples) {
+        return 0;
+    }
+
+    tail = SDL_GetAtomicU32(&SDL_mouse_samples_tail);
+    head = SDL_GetAtomicU32(&SDL_mouse_samples_head);
+    available = head - tail;
+    if (!samples) {
+        return (int)available;
+    }
+
+    if (available > (Uint32)count) {
+        available = (Uint32)count;
+    }
+
+    // Copy out in up to two pieces, around the end of the buffer
+    first = SDL_min(available, SDL_mouse_samples_mask + 1 - (tail & SDL_mouse_samples_mask));
+    SDL_memcpy(samples, &SDL_mouse_samples[tail & SDL_mouse_samples_mask], first * sizeof(*samples));
+    SDL_memcpy(samples + first, SDL_mouse_samples, (available - first) * sizeof(*samples));
+
+    SDL_SetAtomicU32(&SDL_mouse_samples_tail, tail + available);
+    return (int)available;
+}
+
 SDL_MouseButtonFlags SDL_GetGlobalMouseState(float *x, float *y)
 {
     SDL_Mouse *mouse = SDL_GetMouse();
@@ -211,6 +211,9 @@ extern bool SDL_UpdateMouseCapture(bool force_release);
 // Send a mouse motion event
 extern void SDL_SendMouseMotion(Uint64 timestamp, SDL_Window *window, SDL_MouseID mouseID, bool relative, float x, float y);
 
+// Keep a raw relative motion sample for SDL_GetMouseSamples(), if enabled
+extern void SDL_SendMouseSample(Uint64 timestamp, SDL_MouseID mouseID, int dx, int dy);
+
 // Send a mouse motion event resulting from a pointer warp
 void SDL_SendMouseWarp(Uint64 timestamp, SDL_Window *window, SDL_MouseID mouseID, float x, float y);
 
@@ -28,6 +28,8 @@
 #include "../events/SDL_windowevents_c.h"
 #include "../video/SDL_pixels_c.h"
 #include "../video/SDL_video_c.h"
+#include "../SDL_properties_c.h"
+#include "../stdlib/SDL_malloc_c.h"
 
 #ifdef SDL_PLATFORM_ANDROID
 #include "../core/android/SDL_android.h"
@@ -49,6 +51,12 @@ this should probably be removed at some point in the future.  --ryan. */
 #define SDL_PROP_WINDOW_RENDERER_POINTER "SDL.internal.window.renderer"
 #define SDL_PROP_TEXTURE_PARENT_POINTER "SDL.internal.texture.parent"
 
+// These are looked up on every frame, so they're interned once and used by atom
+static SDL_AtomicU32 SDL_window_renderer_atom;
+static SDL_AtomicU32 SDL_texture_parent_atom;
+#define SDL_PROP_WINDOW_RENDERER_ATOM SDL_GetCachedPropertyAtom(&SDL_window_renderer_atom, SDL_PROP_WINDOW_RENDERER_POINTER)
+#define SDL_PROP_TEXTURE_PARENT_ATOM SDL_GetCachedPropertyAtom(&SDL_texture_parent_atom, SDL_PROP_TEXTURE_PARENT_POINTER)
+
 #define CHECK_RENDERER_MAGIC_BUT_NOT_DESTROYED_FLAG(renderer, result)   \
     CHECK_PARAM(!SDL_ObjectValid(renderer, SDL_OBJECT_TYPE_RENDERER)) { \
         SDL_InvalidParamError("renderer");                              \
@@ -319,12 +327,10 @@ static bool FlushRenderCommands(SDL_Renderer *renderer)
     result = renderer->RunCommandQueue(renderer, renderer->render_commands, renderer->vertex_data, renderer->vertex_data_used);
 
     // Move the whole render command queue to the unused pool so we can reuse them next time.
-    if (renderer->render_commands_tail) {
-        renderer->render_commands_tail->next = renderer->render_commands_pool;
-        renderer->render_commands_pool = renderer->render_commands;
-        renderer->render_commands_tail = NULL;
-        renderer->render_commands = NULL;
-    }
+    SDL_ReleaseObjects(&renderer->render_commands_pool, renderer->render_commands, renderer->render_commands_tail, renderer->num_render_commands);
+    renderer->render_commands_tail = NULL;
+    renderer->render_commands = NULL;
+    renderer->num_render_commands = 0;
     renderer->vertex_data_used = 0;
     renderer->render_command_generation++;
     renderer->color_queued = false;
@@ -387,7 +393,7 @@ void *SDL_AllocateRenderVertices(SDL_Renderer *renderer, size_t numbytes, size_t
             newsize *= 2;
         }
 
-        ptr = SDL_realloc(renderer->vertex_data, newsize);
+        ptr = SDL_realloc_tagged(SDL_MEMORY_TAG_RENDER, renderer->vertex_data, renderer->vertex_data_allocation, newsize);
 
         if (!ptr) {
             return NULL;
@@ -407,18 +413,11 @@ void *SDL_AllocateRenderVertices(SDL_Renderer *renderer, size_t numbytes, size_t
 
 static SDL_RenderCommand *AllocateRenderCommand(SDL_Renderer *renderer)
 {
-    SDL_RenderCommand *result = NULL;
-
-    result = renderer->render_commands_pool;
-    if (result) {
-        renderer->render_commands_pool = result->next;
-        result->next = NULL;
-    } else {
-        result = (SDL_RenderCommand *)SDL_calloc(1, sizeof(*result));
-        if (!result) {
-            return NULL;
-        }
+    SDL_RenderCommand *result = (SDL_RenderCommand *)SDL_AllocateObject(&renderer->render_commands_pool);
+    if (!result) {
+        return NULL;
     }
+    result->next = NULL;
 
     SDL_assert((renderer->render_commands == NULL) == (renderer->render_commands_tail == NULL));
     if (renderer->render_commands_tail) {
@@ -427,6 +426,7 @@ static SDL_RenderCommand *AllocateRenderCommand(SDL_Renderer *renderer)
         renderer->render_commands = result;
     }
     renderer->render_commands_tail = result;
+    ++renderer->num_render_commands;
 
     return result;
 }
@@ -1159,6 +1159,9 @@ SDL_Renderer *SDL_CreateRendererWithProperties(SDL_PropertiesID props)
 
     VerifyDrawQueueFunctions(renderer);
 
+    // Commands are queued again every frame, so keep all of them around
+    SDL_InitObjectPool(&renderer->render_commands_pool, sizeof(SDL_RenderCommand), offsetof(SDL_RenderCommand, next), SDL_MAX_SINT32, SDL_MEMORY_TAG_RENDER);
+
     renderer->window = window;
     renderer->target_mutex = SDL_CreateMutex();
     if (surface) {
@@ -1329,7 +1332,7 @@ SDL_Renderer *SDL_CreateSoftwareRenderer(SDL_Surface *surface)
 
 SDL_Renderer *SDL_GetRenderer(SDL_Window *window)
 {
-    return (SDL_Renderer *)SDL_GetPointerProperty(SDL_GetWindowProperties(window), SDL_PROP_WINDOW_RENDERER_POINTER, NULL);
+    return (SDL_Renderer *)SDL_GetPointerPropertyByAtom(SDL_GetWindowProperties(window), SDL_PROP_WINDOW_RENDERER_ATOM, NULL);
 }
 
 SDL_Window *SDL_GetRenderWindow(SDL_Renderer *renderer)
@@ -2844,7 +2847,7 @@ SDL_Texture *SDL_GetRenderTarget(SDL_Renderer *renderer)
     if (!renderer->target) {
         return NULL;
     }
-    return (SDL_Texture *) SDL_GetPointerProperty(SDL_GetTextureProperties(renderer->target), SDL_PROP_TEXTURE_PARENT_POINTER, renderer->target);
+    return (SDL_Texture *) SDL_GetPointerPropertyByAtom(SDL_GetTextureProperties(renderer->target), SDL_PROP_TEXTURE_PARENT_ATOM, renderer->target);
 }
 
 static void UpdateLogicalPresentation(SDL_Renderer *renderer)
@@ -5444,7 +5447,7 @@ SDL_Surface *SDL_RenderReadPixels(SDL_Renderer *renderer, const SDL_Rect *rect)
 
         if (renderer->target) {
             SDL_Texture *target = renderer->target;
-            SDL_Texture *parent = SDL_GetPointerProperty(SDL_GetTextureProperties(target), SDL_PROP_TEXTURE_PARENT_POINTER, NULL);
+            SDL_Texture *parent = SDL_GetPointerPropertyByAtom(SDL_GetTextureProperties(target), SDL_PROP_TEXTURE_PARENT_ATOM, NULL);
             SDL_PixelFormat expected_format = (parent ? parent->format : target->format);
 
             if (SDL_COLORSPACETRANSFER(target->colorspace) == SDL_TRANSFER_CHARACTERISTICS_PQ) {
@@ -5633,25 +5636,13 @@ void SDL_DestroyTexture(SDL_Texture *texture)
 
 static void SDL_DiscardAllCommands(SDL_Renderer *renderer)
 {
-    SDL_RenderCommand *cmd;
-
-    if (renderer->render_commands_tail) {
-        renderer->render_commands_tail->next = renderer->render_commands_pool;
-        cmd = renderer->render_commands;
-    } else {
-        cmd = renderer->render_commands_pool;
-    }
+    SDL_ReleaseObjects(&renderer->render_commands_pool, renderer->render_commands, renderer->render_commands_tail, renderer->num_render_commands);
+    SDL_QuitObjectPool(&renderer->render_commands_pool);
 
-    renderer->render_commands_pool = NULL;
     renderer->render_commands_tail = NULL;
     renderer->render_commands = NULL;
+    renderer->num_render_commands = 0;
     renderer->vertex_data_used = 0;
-
-    while (cmd) {
-        SDL_RenderCommand *next = cmd->next;
-        SDL_free(cmd);
-        cmd = next;
-    }
 }
 
 void SDL_DestroyRendererWithoutFreeing(SDL_Renderer *renderer)
@@ -5706,7 +5697,7 @@ void SDL_DestroyRendererWithoutFreeing(SDL_Renderer *renderer)
         renderer->target_mutex = NULL;
     }
     if (renderer->vertex_data) {
-        SDL_free(renderer->vertex_data);
+        SDL_free_tagged(SDL_MEMORY_TAG_RENDER, renderer->vertex_data, renderer->vertex_data_allocation);
         renderer->vertex_data = NULL;
     }
     if (renderer->texture_formats) {
@@ -0,0 +1,515 @@
+/*
+  Simple DirectMedia Layer
+  Copyright (C) 1997-2026 Sam Lantinga <slouken@libsdl.org>
+
+  This software is provided 'as-is', without any express or implied
+  warranty.  In no event will the authors be held liable for any damages
+  arising from the use of this software.
+
+  Permission is granted to anyone to use this software for any purpose,
+  including commercial applications, and to alter it and redistribute it
+  freely, subject to the following restrictions:
+
+  1. The origin of this software must not be misrepresented; you must not
+     claim that you wrote the original software. If you use this software
+     in a product, an acknowledgment in the product documentation would be
+     appreciated but is not required.
+  2. Altered source versions must be plainly marked as such, and must not be
+     misrepresented as being the original software.
+  3. This notice may not be removed or altered from any source distribution.
+*/
+#include "SDL_internal.h"
+
+#include "SDL_sysrender.h"
+
+/* Texture atlas using a guillotine packer
+ *
+ * Each atlas texture keeps a list of free rectangles. A new image is placed in
+ * the free rectangle that fits it best, and the remaining space is split into
+ * at most two new free rectangles. Removing an image returns its rectangle to
+ * the free list, where it's merged with neighbors that share a full edge.
+ */
+
+// Empty space kept to the right of and below each image, to avoid bleeding with linear filtering
+#define ATLAS_PADDING 1
+
+typedef struct SDL_TextureAtlasPage
+{
+    SDL_Texture *texture;
+    SDL_Rect *free_rects;
+    int num_free_rects;
+    int max_free_rects;
+    int num_entries;
+} SDL_TextureAtlasPage;
+
+typedef struct SDL_TextureAtlasEntry
+{
+    int page; // -1 if this entry is unused
+    SDL_Rect rect;
+    int next_free;
+} SDL_TextureAtlasEntry;
+
+struct SDL_TextureAtlas
+{
+    SDL_Renderer *renderer;
+    SDL_PixelFormat format;
+    int w;
+    int h;
+
+    SDL_TextureAtlasPage *pages;
+    int num_pages;
+
+    SDL_TextureAtlasEntry *entries;
+    int num_entries;
+    int max_entries;
+    int first_free_entry;
+    int num_used_entries;
+
+    Sint64 used_area;
+};
+
+#define CHECK_ATLAS_PARAM(atlas, result)    \
+    CHECK_PARAM(!atlas) {                   \
+        SDL_InvalidParamError("atlas");     \
+        return result;                      \
+    }
+
+static bool ReserveFreeRects(SDL_TextureAtlasPage *page, int count)
+{
+    if (page->num_free_rects + count > page->max_free_rects) {
+        int max_free_rects = page->max_free_rects ? page->max_free_rects * 2 : 16;
+        while (max_free_rects < page->num_free_rects + count) {
+            max_free_rects *= 2;
+        }
+        SDL_Rect *free_rects = (SDL_Rect *)SDL_realloc(page->free_rects, max_free_rects * sizeof(*free_rects));
+        if (!free_rects) {
+            return false;
+        }
+        page->free_rects = free_rects;
+        page->max_free_rects = max_free_rects;
+    }
+    return true;
+}
+
+static bool AddFreeRect(SDL_TextureAtlasPage *page, const SDL_Rect *rect)
+{
+    if (!ReserveFreeRects(page, 1)) {
+        return false;
+    }
+    page->free_rects[page->num_free_rects++] = *rect;
+    return true;
+}
+
+static void RemoveFreeRect(SDL_TextureAtlasPage *page, int index)
+{
+    --page->num_free_rects;
+    if (index < page->num_free_rects) {
+        page->free_rects[index] = page->free_rects[page->num_free_rects];
+    }
+}
+
+static void ResetFreeRects(SDL_TextureAtlas *atlas, SDL_TextureAtlasPage *page)
+{
+    SDL_Rect rect;
+
+    // The padding of images along the right and bottom edges may hang off the texture
+    rect.x = 0;
+    rect.y = 0;
+    rect.w = atlas->w + ATLAS_PADDING;
+    rect.h = atlas->h + ATLAS_PADDING;
+    page->num_free_rects = 0;
+    AddFreeRect(page, &rect);
+}
+
+static bool CanMergeFreeRects(const SDL_Rect *a, const SDL_Rect *b, SDL_Rect *result)
+{
+    if (a->x == b->x && a->w == b->w) {
+        if (a->y + a->h == b->y || b->y + b->h == a->y) {
+            result->x = a->x;
+            result->y = SDL_min(a->y, b->y);
+            result->w = a->w;
+            result->h = a->h + b->h;
+            return true;
+        }
+    } else if (a->y == b->y && a->h == b->h) {
+        if (a->x + a->w == b->x || b->x + b->w == a->x) {
+            result->x = SDL_min(a->x, b->x);
+            result->y = a->y;
+            result->w = a->w + b->w;
+            result->h = a->h;
+            return true;
+        }
+    }
+    return false;
+}
+
+static void MergeFreeRects(SDL_TextureAtlasPage *page)
+{
+    bool merged;
+
+    do {
+        merged = false;
+        for (int i = 0; i < page->num_free_rects && !merged; ++i) {
+            for (int j = i + 1; j < page->num_free_rects; ++j) {
+                SDL_Rect rect;
+                if (CanMergeFreeRects(&page->free_rects[i], &page->free_rects[j], &rect)) {
+                    page->free_rects[i] = rect;
+                    RemoveFreeRect(page, j);
+                    merged = true;
+                    break;
+                }
+            }
+        }
+    } while (merged);
+}
+
+// Find the free rect with the least wasted area, breaking ties by the shorter leftover side
+static bool FindFreeRect(SDL_TextureAtlasPage *page, int w, int h, int *best_index, Sint64 *best_area, int *best_side)
+{
+    bool found = false;
+
+    for (int i = 0; i < page->num_free_rects; ++i) {
+        const SDL_Rect *rect = &page->free_rects[i];
+        if (rect->w >= w && rect->h >= h) {
+            const Sint64 area = (Sint64)rect->w * rect->h - (Sint64)w * h;
+            const int side = SDL_min(rect->w - w, rect->h - h);
+            if (area < *best_area || (area == *best_area && side < *best_side)) {
+                *best_index = i;
+                *best_area = area;
+                *best_side = side;
+                found = true;
+            }
+        }
+    }
+    return found;
+}
+
+static bool PlaceRect(SDL_TextureAtlasPage *page, int index, int w, int h, SDL_Rect *result)
+{
+    const SDL_Rect free_rect = page->free_rects[index];
+    SDL_Rect right, bottom;
+
+    // One free rect is replaced by up to two, make room first so failing leaves the list as it was
+    if (!ReserveFreeRects(page, 1)) {
+        return false;
+    }
+    RemoveFreeRect(page, index);
+
+    result->x = free_rect.x;
+    result->y = free_rect.y;
+    result->w = w;
+    result->h = h;
+
+    // Split along the shorter leftover axis, keeping the larger piece as big as possible
+    if (free_rect.w - w < free_rect.h - h) {
+        right.x = free_rect.x + w;
+        right.y = free_rect.y;
+        right.w = free_rect.w - w;
+        right.h = h;
+        bottom.x = free_rect.x;
+        bottom.y = free_rect.y + h;
+        bottom.w = free_rect.w;
+        bottom.h = free_rect.h - h;
+    } else {
+        right.x = free_rect.x + w;
+        right.y = free_rect.y;
+        right.w = free_rect.w - w;
+        right.h = free_rect.h;
+        bottom.x = free_rect.x;
+        bottom.y = free_rect.y + h;
+        bottom.w = w;
+        bottom.h = free_rect.h - h;
+    }
+
+    if (right.w > 0 && right.h > 0) {
+        AddFreeRect(page, &right);
+    }
+    if (bottom.w > 0 && bottom.h > 0) {
+        AddFreeRect(page, &bottom);
+    }
+    return true;
+}
+
+// Free space is kept transparent, so filtering at the edges of images doesn't pick up what used to be there
+static bool ClearAtlasRect(SDL_TextureAtlas *atlas, SDL_TextureAtlasPage *page, const SDL_Rect *rect)
+{
+    const int pitch = rect->w * SDL_BYTESPERPIXEL(atlas->format);
+    void *pixels = SDL_calloc(rect->h, pitch);
+    if (!pixels) {
+        return false;
+    }
+    const bool result = SDL_UpdateTexture(page->texture, rect, pixels, pitch);
+    SDL_free(pixels);
+    return result;
+}
+
+static SDL_TextureAtlasPage *CreateAtlasPage(SDL_TextureAtlas *atlas)
+{
+    SDL_TextureAtlasPage *pages = (SDL_TextureAtlasPage *)SDL_realloc(atlas->pages, (atlas->num_pages + 1) * sizeof(*pages));
+    if (!pages) {
+        return NULL;
+    }
+    atlas->pages = pages;
+
+    SDL_TextureAtlasPage *page = &pages[atlas->num_pages];
+    SDL_zerop(page);
+
+    page->texture = SDL_CreateTexture(atlas->renderer, atlas->format, SDL_TEXTUREACCESS_STATIC, atlas->w, atlas->h);
+    if (!page->texture) {
+        return NULL;
+    }
+
+    const SDL_Rect full_rect = { 0, 0, atlas->w, atlas->h };
+    if (!ClearAtlasRect(atlas, page, &full_rect)) {
+        SDL_DestroyTexture(page->texture);
+        return NULL;
+    }
+
+    ResetFreeRects(atlas, page);
+    if (page->num_free_rects == 0) {
+        SDL_DestroyTexture(page->texture);
+        return NULL;
+    }
+
+    ++atlas->num_pages;
+    return page;
+}
+
+static SDL_TextureAtlasEntry *GetAtlasEntry(SDL_TextureAtlas *atlas, SDL_TextureAtlasEntryID entry)
+{
+    if (entry == 0 || entry > (Uint32)atlas->num_entries || atlas->entries[entry - 1].page < 0) {
+        SDL_SetError("Invalid texture atlas entry");
+        return NULL;
+    }
+    return &atlas->entries[entry - 1];
+}
+
+static SDL_TextureAtlasEntryID AllocateAtlasEntry(SDL_TextureAtlas *atlas)
+{
+    int index;
+
+    if (atlas->first_free_entry >= 0) {
+        index = atlas->first_free_entry;
+        atlas->first_free_entry = atlas->entries[index].next_free;
+    } else {
+        if (atlas->num_entries == atlas->max_entries) {
+            int max_entries = atlas->max_entries ? atlas->max_entries * 2 : 64;
+            SDL_TextureAtlasEntry *entries = (SDL_TextureAtlasEntry *)SDL_realloc(atlas->entries, max_entries * sizeof(*entries));
+            if (!entries) {
+                return 0;
+            }
+            atlas->entries = entries;
+            atlas->max_entries = max_entries;
+        }
+        index = atlas->num_entries++;
+    }
+    atlas->entries[index].page = -1;
+    atlas->entries[index].next_free = -1;
+    return (SDL_TextureAtlasEntryID)(index + 1);
+}
+
+static void FreeAtlasEntry(SDL_TextureAtlas *atlas, SDL_TextureAtlasEntryID entry)
+{
+    const int index = (int)entry - 1;
+
+    atlas->entries[index].page = -1;
+    atlas->entries[index].next_free = atlas->first_free_entry;
+    atlas->first_free_entry = index;
+}
+
+SDL_TextureAtlas *SDL_CreateTextureAtlas(SDL_Renderer *renderer, SDL_PixelFormat format, int w, int h)
+{
+    CHECK_PARAM(!SDL_ObjectValid(renderer, SDL_OBJECT_TYPE_RENDERER)) {
+        SDL_InvalidParamError("renderer");
+        return NULL;
+    }
+
+    CHECK_PARAM(format == SDL_PIXELFORMAT_UNKNOWN || SDL_ISPIXELFORMAT_FOURCC(format)) {
+        SDL_SetError("Unsupported texture atlas format");
+        return NULL;
+    }
+
+    CHECK_PARAM(w <= 0 || h <= 0) {
+        SDL_SetError("Texture atlas dimensions must be positive");
+        return NULL;
+    }
+
+    SDL_TextureAtlas *atlas = (SDL_TextureAtlas *)SDL_calloc(1, sizeof(*atlas));
+    if (!atlas) {
+        return NULL;
+    }
+    atlas->renderer = renderer;
+    atlas->format = format;
+    atlas->w = w;
+    atlas->h = h;
+    atlas->first_free_entry = -1;
+
+    return atlas;
+}
+
+SDL_TextureAtlasEntryID SDL_AddTextureAtlasEntry(SDL_TextureAtlas *atlas, SDL_Surface *surface)
+{
+    CHECK_ATLAS_PARAM(atlas, 0);
+
+    CHECK_PARAM(!SDL_SurfaceValid(surface)) {
+        SDL_InvalidParamError("surface");
+        return 0;
+    }
+
+    if (surface->w > atlas->w || surface->h > atlas->h) {
+        SDL_SetError("Surface is larger than the texture atlas");
+        return 0;
+    }
+
+    const int w = surface->w + ATLAS_PADDING;
+    const int h = surface->h + ATLAS_PADDING;
+    int best_page = -1;
+    int best_index = -1;
+    Sint64 best_area = SDL_MAX_SINT64;
+    int best_side = SDL_MAX_SINT32;
+    for (int i = 0; i < atlas->num_pages; ++i) {
+        if (FindFreeRect(&atlas->pages[i], w, h, &best_index, &best_area, &best_side)) {
+            best_page = i;
+        }
+    }
+    if (best_page < 0) {
+        if (!CreateAtlasPage(atlas)) {
+            return 0;
+        }
+        best_page = atlas->num_pages - 1;
+        FindFreeRect(&atlas->pages[best_page], w, h, &best_index, &best_area, &best_side);
+    }
+
+    SDL_Surface *converted = NULL;
+    if (surface->format != atlas->format || SDL_MUSTLOCK(surface)) {
+        converted = SDL_ConvertSurface(surface, atlas->format);
+        if (!converted) {
+            return 0;
+        }
+        surface = converted;
+    }
+
+    SDL_TextureAtlasEntryID entry = AllocateAtlasEntry(atlas);
+    if (!entry) {
+        SDL_DestroySurface(converted);
+        return 0;
+    }
+
+    SDL_TextureAtlasPage *page = &atlas->pages[best_page];
+    SDL_Rect rect;
+    if (!PlaceRect(page, best_index, w, h, &rect)) {
+        FreeAtlasEntry(atlas, entry);
+        SDL_DestroySurface(converted);
+        return 0;
+    }
+    rect.w -= ATLAS_PADDING;
+    rect.h -= ATLAS_PADDING;
+
+    if (!SDL_UpdateTexture(page->texture, &rect, surface->pixels, surface->pitch)) {
+        SDL_Rect padded = { rect.x, rect.y, w, h };
+        AddFreeRect(page, &padded);
+        MergeFreeRects(page);
+        FreeAtlasEntry(atlas, entry);
+        SDL_DestroySurface(converted);
+        return 0;
+    }
+    SDL_DestroySurface(converted);
+
+    SDL_TextureAtlasEntry *item = &atlas->entries[entry - 1];
+    item->page = best_page;
+    item->rect = rect;
+    ++page->num_entries;
+    ++atlas->num_used_entries;
+    atlas->used_area += (Sint64)rect.w * rect.h;
+
+    return entry;
+}
+
+bool SDL_GetTextureAtlasEntry(SDL_TextureAtlas *atlas, SDL_TextureAtlasEntryID entry, SDL_Texture **texture, SDL_FRect *srcrect)
+{
+    CHECK_ATLAS_PARAM(atlas, false);
+
+    SDL_TextureAtlasEntry *item = GetAtlasEntry(atlas, entry);
+    if (!item) {
+        return false;
+    }
+
+    if (texture) {
+        *texture = atlas->pages[item->page].texture;
+    }
+    if (srcrect) {
+        SDL_RectToFRect(&item->rect, srcrect);
+    }
+    return true;
+}
+
+bool SDL_RemoveTextureAtlasEntry(SDL_TextureAtlas *atlas, SDL_TextureAtlasEntryID entry)
+{
+    CHECK_ATLAS_PARAM(atlas, false);
+
+    SDL_TextureAtlasEntry *item = GetAtlasEntry(atlas, entry);
+    if (!item) {
+        return false;
+    }
+
+    SDL_TextureAtlasPage *page = &atlas->pages[item->page];
+    --page->num_entries;
+    --atlas->num_used_entries;
+    atlas->used_area -= (Sint64)item->rect.w * item->rect.h;
+
+    SDL_Rect rect = item->rect;
+    rect.w += ATLAS_PADDING;
+    rect.h += ATLAS_PADDING;
+    if (!ClearAtlasRect(atlas, page, &rect)) {
+        // The next image placed here might bleed into the old pixels, but the entry is still gone
+        SDL_ClearError();
+    }
+
+    if (page->num_entries == 0) {
+        ResetFreeRects(atlas, page);
+    } else {
+        if (!AddFreeRect(page, &rect)) {
+            // The space is lost until the page empties, but the entry is still gone
+            SDL_ClearError();
+        }
+        MergeFreeRects(page);
+    }
+
+    FreeAtlasEntry(atlas, entry);
+    return true;
+}
+
+bool SDL_GetTextureAtlasOccupancy(SDL_TextureAtlas *atlas, int *num_textures, int *num_entries, float *occupancy)
+{
+    CHECK_ATLAS_PARAM(atlas, false);
+
+    if (num_textures) {
+        *num_textures = atlas->num_pages;
+    }
+    if (num_entries) {
+        *num_entries = atlas->num_used_entries;
+    }
+    if (occupancy) {
+        if (atlas->num_pages > 0) {
+            *occupancy = (float)((double)atlas->used_area / ((double)atlas->w * atlas->h * atlas->num_pages));
+        } else {
+            *occupancy = 0.0f;
+        }
+    }
+    return true;
+}
+
+void SDL_DestroyTextureAtlas(SDL_TextureAtlas *atlas)
+{
+    if (!atlas) {
+        return;
+    }
+
+    for (int i = 0; i < atlas->num_pages; ++i) {
+        SDL_DestroyTexture(atlas->pages[i].texture);
+        SDL_free(atlas->pages[i].free_rects);
+    }
+    SDL_free(atlas->pages);
+    SDL_free(atlas->entries);
+    SDL_free(atlas);
+}
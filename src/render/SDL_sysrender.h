@@ -24,6 +24,7 @@
 #define SDL_sysrender_h_
 
 #include "../video/SDL_surface_c.h"
+#include "../SDL_objectpool.h"
 
 #include "SDL_yuv_sw_c.h"
 
@@ -337,7 +338,8 @@ struct SDL_Renderer
 
     SDL_RenderCommand *render_commands;
     SDL_RenderCommand *render_commands_tail;
-    SDL_RenderCommand *render_commands_pool;
+    int num_render_commands;
+    SDL_ObjectPool render_commands_pool;
     Uint32 render_command_generation;
     SDL_FColor last_queued_color;
     float last_queued_color_scale;
@@ -24,6 +24,20 @@
 
 #include "SDL_draw.h"
 #include "SDL_blendfillrect.h"
+#include "SDL_blendspan.h"
+
+static bool SDL_BlendFillRect_Span(SDL_Surface *dst, const SDL_Rect *rect,
+                                   SDL_BlendMode blendMode, Uint8 r, Uint8 g, Uint8 b, Uint8 a)
+{
+    Uint8 *row = (Uint8 *)dst->pixels + rect->y * dst->pitch + rect->x * 4;
+    int h = rect->h;
+
+    while (h--) {
+        SDL_BlendSpan(dst->fmt, (Uint32 *)row, rect->w, 1, blendMode, r, g, b, a);
+        row += dst->pitch;
+    }
+    return true;
+}
 
 static bool SDL_BlendFillRect_RGB555(SDL_Surface *dst, const SDL_Rect *rect,
                                     SDL_BlendMode blendMode, Uint8 r, Uint8 g, Uint8 b, Uint8 a)
@@ -264,6 +278,10 @@ bool SDL_BlendFillRect(SDL_Surface *dst, const SDL_Rect *rect, SDL_BlendMode ble
         b = DRAW_MUL(b, a);
     }
 
+    if (SDL_HasBlendSpan(dst->fmt, blendMode)) {
+        return SDL_BlendFillRect_Span(dst, rect, blendMode, r, g, b, a);
+    }
+
     switch (dst->fmt->bits_per_pixel) {
     case 15:
         switch (dst->fmt->Rmask) {
@@ -350,7 +368,9 @@ bool SDL_BlendFillRects(SDL_Surface *dst, const SDL_Rect *rects, int count, SDL_
         break;
     }
 
-    if (!func) {
+    if (SDL_HasBlendSpan(dst->fmt, blendMode)) {
+        func = SDL_BlendFillRect_Span;
+    } else if (!func) {
         if (!dst->fmt->Amask) {
             func = SDL_BlendFillRect_RGB;
         } else {
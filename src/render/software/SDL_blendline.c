@@ -25,6 +25,7 @@
 #include "SDL_draw.h"
 #include "SDL_blendline.h"
 #include "SDL_blendpoint.h"
+#include "SDL_blendspan.h"
 
 static void SDL_BlendLine_RGB2(SDL_Surface *dst, int x1, int y1, int x2, int y2,
                                SDL_BlendMode blendMode, Uint8 _r, Uint8 _g, Uint8 _b, Uint8 _a,
@@ -883,6 +884,52 @@ static void SDL_BlendLine_ARGB8888(SDL_Surface *dst, int x1, int y1, int x2, int
     }
 }
 
+// Draw horizontal and vertical lines with the vectorized span code, returns false for other lines
+static bool SDL_BlendLine_Span(SDL_Surface *dst, int x1, int y1, int x2, int y2,
+                               SDL_BlendMode blendMode, Uint8 r, Uint8 g, Uint8 b, Uint8 a,
+                               bool draw_end)
+{
+    const int pitch = dst->pitch / 4;
+    Uint32 *pixels;
+    int length, stride;
+
+    if (y1 == y2) {
+        if (x1 <= x2) {
+            pixels = (Uint32 *)dst->pixels + y1 * pitch + x1;
+            length = draw_end ? (x2 - x1 + 1) : (x2 - x1);
+        } else {
+            pixels = (Uint32 *)dst->pixels + y1 * pitch + x2;
+            if (!draw_end) {
+                ++pixels;
+            }
+            length = draw_end ? (x1 - x2 + 1) : (x1 - x2);
+        }
+        stride = 1;
+    } else if (x1 == x2) {
+        if (y1 <= y2) {
+            pixels = (Uint32 *)dst->pixels + y1 * pitch + x1;
+            length = draw_end ? (y2 - y1 + 1) : (y2 - y1);
+        } else {
+            pixels = (Uint32 *)dst->pixels + y2 * pitch + x1;
+            if (!draw_end) {
+                pixels += pitch;
+            }
+            length = draw_end ? (y1 - y2 + 1) : (y1 - y2);
+        }
+        stride = pitch;
+    } else {
+        return false;
+    }
+
+    if (blendMode == SDL_BLENDMODE_BLEND || blendMode == SDL_BLENDMODE_ADD) {
+        r = DRAW_MUL(r, a);
+        g = DRAW_MUL(g, a);
+        b = DRAW_MUL(b, a);
+    }
+    SDL_BlendSpan(dst->fmt, pixels, length, stride, blendMode, r, g, b, a);
+    return true;
+}
+
 typedef void (*BlendLineFunc)(SDL_Surface *dst,
                               int x1, int y1, int x2, int y2,
                               SDL_BlendMode blendMode,
@@ -938,6 +985,10 @@ bool SDL_BlendLine(SDL_Surface *dst, int x1, int y1, int x2, int y2, SDL_BlendMo
         return true;
     }
 
+    if (SDL_HasBlendSpan(dst->fmt, blendMode) &&
+        SDL_BlendLine_Span(dst, x1, y1, x2, y2, blendMode, r, g, b, a, true)) {
+        return true;
+    }
     func(dst, x1, y1, x2, y2, blendMode, r, g, b, a, true);
     return true;
 }
@@ -947,7 +998,10 @@ bool SDL_BlendLines(SDL_Surface *dst, const SDL_Point *points, int count, SDL_Bl
     int i;
     int x1, y1;
     int x2, y2;
+    int clip_x1, clip_y1;
+    int clip_x2, clip_y2;
     bool draw_end;
+    bool use_span;
     BlendLineFunc func;
 
     if (!SDL_SurfaceValid(dst)) {
@@ -958,6 +1012,13 @@ bool SDL_BlendLines(SDL_Surface *dst, const SDL_Point *points, int count, SDL_Bl
     if (!func) {
         return SDL_SetError("SDL_BlendLines(): Unsupported surface format");
     }
+    use_span = SDL_HasBlendSpan(dst->fmt, blendMode);
+
+    // Segments entirely inside the clip rect, the common case, skip the clipping code
+    clip_x1 = dst->clip_rect.x;
+    clip_y1 = dst->clip_rect.y;
+    clip_x2 = dst->clip_rect.x + dst->clip_rect.w - 1;
+    clip_y2 = dst->clip_rect.y + dst->clip_rect.h - 1;
 
     for (i = 1; i < count; ++i) {
         x1 = points[i - 1].x;
@@ -965,15 +1026,23 @@ bool SDL_BlendLines(SDL_Surface *dst, const SDL_Point *points, int count, SDL_Bl
         x2 = points[i].x;
         y2 = points[i].y;
 
-        // Perform clipping
-        // FIXME: We don't actually want to clip, as it may change line slope
-        if (!SDL_GetRectAndLineIntersection(&dst->clip_rect, &x1, &y1, &x2, &y2)) {
-            continue;
-        }
+        if (x1 >= clip_x1 && x1 <= clip_x2 && y1 >= clip_y1 && y1 <= clip_y2 &&
+            x2 >= clip_x1 && x2 <= clip_x2 && y2 >= clip_y1 && y2 <= clip_y2) {
+            draw_end = false;
+        } else {
+            // Perform clipping
+            // FIXME: We don't actually want to clip, as it may change line slope
+            if (!SDL_GetRectAndLineIntersection(&dst->clip_rect, &x1, &y1, &x2, &y2)) {
+                continue;
+            }
 
-        // Draw the end if it was clipped
-        draw_end = (x2 != points[i].x || y2 != points[i].y);
+            // Draw the end if it was clipped
+            draw_end = (x2 != points[i].x || y2 != points[i].y);
+        }
 
+        if (use_span && SDL_BlendLine_Span(dst, x1, y1, x2, y2, blendMode, r, g, b, a, draw_end)) {
+            continue;
+        }
         func(dst, x1, y1, x2, y2, blendMode, r, g, b, a, draw_end);
     }
     if (points[0].x != points[count - 1].x || points[0].y != points[count - 1].y) {
@@ -0,0 +1,216 @@
+/*
+  Simple DirectMedia Layer
+  Copyright (C) 1997-2026 Sam Lantinga <slouken@libsdl.org>
+
+  This software is provided 'as-is', without any express or implied
+  warranty.  In no event will the authors be held liable for any damages
+  arising from the use of this software.
+
+  Permission is granted to anyone to use this software for any purpose,
+  including commercial applications, and to alter it and redistribute it
+  freely, subject to the following restrictions:
+
+  1. The origin of this software must not be misrepresented; you must not
+     claim that you wrote the original software. If you use this software
+     in a product, an acknowledgment in the product documentation would be
+     appreciated but is not required.
+  2. Altered source versions must be plainly marked as such, and must not be
+     misrepresented as being the original software.
+  3. This notice may not be removed or altered from any source distribution.
+*/
+#include "SDL_internal.h"
+
+#ifdef SDL_VIDEO_RENDER_SW
+
+#include "SDL_draw.h"
+#include "SDL_blendspan.h"
+
+/* Every supported blend mode is expressed as a per-channel operation on the destination:
+ *
+ *   dst = clamp(dst * mul1 / 255 + dst * mul2 / 255 + add)
+ *
+ * BLEND:  mul1 = 255 - a, mul2 = 0,       add = color
+ * ADD:    mul1 = 255,     mul2 = 0,       add = color
+ * MOD:    mul1 = color,   mul2 = 0,       add = 0
+ * MUL:    mul1 = color,   mul2 = 255 - a, add = 0
+ *
+ * The alpha channel is left alone for everything but BLEND, and the unused byte
+ * of formats without alpha is always cleared, matching the scalar code in SDL_draw.h.
+ * The division by 255 is exact, so the results are bit identical to the scalar code.
+ */
+typedef struct BlendSpanFactors
+{
+    Uint32 mul1;
+    Uint32 mul2;
+    Uint32 add;
+    Uint32 mask;
+} BlendSpanFactors;
+
+static Uint32 PackChannels(const SDL_PixelFormatDetails *fmt, Uint8 r, Uint8 g, Uint8 b, Uint8 a)
+{
+    Uint32 pixel = ((Uint32)r << fmt->Rshift) | ((Uint32)g << fmt->Gshift) | ((Uint32)b << fmt->Bshift);
+    if (fmt->Amask) {
+        pixel |= ((Uint32)a << fmt->Ashift);
+    }
+    return pixel;
+}
+
+static void CalculateBlendSpanFactors(const SDL_PixelFormatDetails *fmt, SDL_BlendMode blendMode,
+                                      Uint8 r, Uint8 g, Uint8 b, Uint8 a, BlendSpanFactors *factors)
+{
+    const Uint8 inva = (Uint8)(0xff - a);
+    const Uint32 rgbmask = fmt->Rmask | fmt->Gmask | fmt->Bmask;
+
+    switch (blendMode) {
+    case SDL_BLENDMODE_BLEND:
+    case SDL_BLENDMODE_BLEND_PREMULTIPLIED:
+        factors->mul1 = PackChannels(fmt, inva, inva, inva, inva);
+        factors->mul2 = 0;
+        factors->add = PackChannels(fmt, r, g, b, a);
+        break;
+    case SDL_BLENDMODE_ADD:
+    case SDL_BLENDMODE_ADD_PREMULTIPLIED:
+        factors->mul1 = 0xFFFFFFFF;
+        factors->mul2 = 0;
+        factors->add = PackChannels(fmt, r, g, b, 0);
+        break;
+    case SDL_BLENDMODE_MOD:
+        factors->mul1 = PackChannels(fmt, r, g, b, 0) | ~rgbmask;
+        factors->mul2 = 0;
+        factors->add = 0;
+        break;
+    case SDL_BLENDMODE_MUL:
+    default:
+        factors->mul1 = PackChannels(fmt, r, g, b, 0) | ~rgbmask;
+        factors->mul2 = PackChannels(fmt, inva, inva, inva, 0);
+        factors->add = 0;
+        break;
+    }
+    factors->mask = fmt->Amask ? 0xFFFFFFFF : rgbmask;
+}
+
+#ifdef SDL_SSE2_INTRINSICS
+
+// Exact x / 255 for 0 <= x <= 255 * 255
+#define DIV255_SSE2(x) _mm_srli_epi16(_mm_add_epi16(_mm_add_epi16(x, one), _mm_srli_epi16(x, 8)), 8)
+
+#define BLEND_SPAN_SSE2(pixel_lo, pixel_hi)                                         \
+    do {                                                                            \
+        __m128i p_lo = _mm_mullo_epi16(pixel_lo, mul1_lo);                          \
+        __m128i p_hi = _mm_mullo_epi16(pixel_hi, mul1_hi);                          \
+        __m128i q_lo = _mm_mullo_epi16(pixel_lo, mul2_lo);                          \
+        __m128i q_hi = _mm_mullo_epi16(pixel_hi, mul2_hi);                          \
+        pixel_lo = _mm_add_epi16(_mm_add_epi16(DIV255_SSE2(p_lo), DIV255_SSE2(q_lo)), add_lo); \
+        pixel_hi = _mm_add_epi16(_mm_add_epi16(DIV255_SSE2(p_hi), DIV255_SSE2(q_hi)), add_hi); \
+    } while (0)
+
+static void SDL_TARGETING("sse2") SDL_BlendSpan_SSE2(Uint32 *pixels, int length, int stride, const BlendSpanFactors *factors)
+{
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i one = _mm_set1_epi16(1);
+    const __m128i mul1 = _mm_set1_epi32((int)factors->mul1);
+    const __m128i mul2 = _mm_set1_epi32((int)factors->mul2);
+    const __m128i add = _mm_set1_epi32((int)factors->add);
+    const __m128i mask = _mm_set1_epi32((int)factors->mask);
+    const __m128i mul1_lo = _mm_unpacklo_epi8(mul1, zero);
+    const __m128i mul1_hi = _mm_unpackhi_epi8(mul1, zero);
+    const __m128i mul2_lo = _mm_unpacklo_epi8(mul2, zero);
+    const __m128i mul2_hi = _mm_unpackhi_epi8(mul2, zero);
+    const __m128i add_lo = _mm_unpacklo_epi8(add, zero);
+    const __m128i add_hi = _mm_unpackhi_epi8(add, zero);
+
+    if (stride == 1) {
+        // Four pixels at a time along a row
+        for (; length >= 4; length -= 4, pixels += 4) {
+            __m128i dst128 = _mm_loadu_si128((const __m128i *)pixels);
+            __m128i dst_lo = _mm_unpacklo_epi8(dst128, zero);
+            __m128i dst_hi = _mm_unpackhi_epi8(dst128, zero);
+
+            BLEND_SPAN_SSE2(dst_lo, dst_hi);
+
+            dst128 = _mm_and_si128(_mm_packus_epi16(dst_lo, dst_hi), mask);
+            _mm_storeu_si128((__m128i *)pixels, dst128);
+        }
+    } else {
+        // Two pixels at a time down a column
+        for (; length >= 2; length -= 2, pixels += 2 * stride) {
+            __m128i dst128 = _mm_unpacklo_epi32(_mm_cvtsi32_si128((int)pixels[0]), _mm_cvtsi32_si128((int)pixels[stride]));
+            __m128i dst_lo = _mm_unpacklo_epi8(dst128, zero);
+            __m128i dst_hi = zero;
+
+            BLEND_SPAN_SSE2(dst_lo, dst_hi);
+
+            dst128 = _mm_and_si128(_mm_packus_epi16(dst_lo, dst_hi), mask);
+            pixels[0] = (Uint32)_mm_cvtsi128_si32(dst128);
+            pixels[stride] = (Uint32)_mm_cvtsi128_si32(_mm_srli_si128(dst128, 4));
+        }
+    }
+
+    // Leftover pixels, one at a time
+    for (; length > 0; --length, pixels += stride) {
+        __m128i dst128 = _mm_cvtsi32_si128((int)*pixels);
+        __m128i dst_lo = _mm_unpacklo_epi8(dst128, zero);
+        __m128i dst_hi = zero;
+
+        BLEND_SPAN_SSE2(dst_lo, dst_hi);
+
+        dst128 = _mm_and_si128(_mm_packus_epi16(dst_lo, dst_hi), mask);
+        *pixels = (Uint32)_mm_cvtsi128_si32(dst128);
+    }
+}
+
+#undef BLEND_SPAN_SSE2
+#undef DIV255_SSE2
+
+#endif // SDL_SSE2_INTRINSICS
+
+bool SDL_HasBlendSpan(const SDL_PixelFormatDetails *fmt, SDL_BlendMode blendMode)
+{
+    switch (blendMode) {
+    case SDL_BLENDMODE_BLEND:
+    case SDL_BLENDMODE_BLEND_PREMULTIPLIED:
+    case SDL_BLENDMODE_ADD:
+    case SDL_BLENDMODE_ADD_PREMULTIPLIED:
+    case SDL_BLENDMODE_MOD:
+    case SDL_BLENDMODE_MUL:
+        break;
+    default:
+        return false;
+    }
+
+    if (fmt->bytes_per_pixel != 4 ||
+        fmt->Rbits != 8 || fmt->Gbits != 8 || fmt->Bbits != 8 ||
+        (fmt->Amask && fmt->Abits != 8) ||
+        (fmt->Rshift % 8) != 0 || (fmt->Gshift % 8) != 0 || (fmt->Bshift % 8) != 0 || (fmt->Ashift % 8) != 0) {
+        return false;
+    }
+
+#ifdef SDL_SSE2_INTRINSICS
+    if (SDL_HasSSE2()) {
+        return true;
+    }
+#endif
+    return false;
+}
+
+void SDL_BlendSpan(const SDL_PixelFormatDetails *fmt, Uint32 *pixels, int length, int stride,
+                   SDL_BlendMode blendMode, Uint8 r, Uint8 g, Uint8 b, Uint8 a)
+{
+    BlendSpanFactors factors;
+
+    if (length <= 0) {
+        return;
+    }
+
+    CalculateBlendSpanFactors(fmt, blendMode, r, g, b, a, &factors);
+
+#ifdef SDL_SSE2_INTRINSICS
+    if (SDL_HasSSE2()) {
+        SDL_BlendSpan_SSE2(pixels, length, stride, &factors);
+        return;
+    }
+#endif
+    SDL_assert(!"SDL_BlendSpan() called without checking SDL_HasBlendSpan()");
+}
+
+#endif // SDL_VIDEO_RENDER_SW
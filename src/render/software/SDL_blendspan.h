@@ -0,0 +1,39 @@
+/*
+  Simple DirectMedia Layer
+  Copyright (C) 1997-2026 Sam Lantinga <slouken@libsdl.org>
+
+  This software is provided 'as-is', without any express or implied
+  warranty.  In no event will the authors be held liable for any damages
+  arising from the use of this software.
+
+  Permission is granted to anyone to use this software for any purpose,
+  including commercial applications, and to alter it and redistribute it
+  freely, subject to the following restrictions:
+
+  1. The origin of this software must not be misrepresented; you must not
+     claim that you wrote the original software. If you use this software
+     in a product, an acknowledgment in the product documentation would be
+     appreciated but is not required.
+  2. Altered source versions must be plainly marked as such, and must not be
+     misrepresented as being the original software.
+  3. This notice may not be removed or altered from any source distribution.
+*/
+
+#ifndef SDL_blendspan_h_
+#define SDL_blendspan_h_
+
+#include "SDL_internal.h"
+
+/* Vectorized blending of a solid color into a run of 32-bit pixels.
+ *
+ * These only handle formats with 8 bits per color channel, and the color must
+ * already be premultiplied by alpha for SDL_BLENDMODE_BLEND and SDL_BLENDMODE_ADD,
+ * the same way the other software blend functions expect it.
+ */
+extern bool SDL_HasBlendSpan(const SDL_PixelFormatDetails *fmt, SDL_BlendMode blendMode);
+
+// Blend 'length' pixels, moving 'stride' pixels between each one
+extern void SDL_BlendSpan(const SDL_PixelFormatDetails *fmt, Uint32 *pixels, int length, int stride,
+                          SDL_BlendMode blendMode, Uint8 r, Uint8 g, Uint8 b, Uint8 a);
+
+#endif // SDL_blendspan_h_
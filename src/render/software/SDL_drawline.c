@@ -161,6 +161,8 @@ bool SDL_DrawLines(SDL_Surface *dst, const SDL_Point *points, int count, Uint32
     int i;
     int x1, y1;
     int x2, y2;
+    int clip_x1, clip_y1;
+    int clip_x2, clip_y2;
     bool draw_end;
     DrawLineFunc func;
 
@@ -173,16 +175,25 @@ bool SDL_DrawLines(SDL_Surface *dst, const SDL_Point *points, int count, Uint32
         return SDL_SetError("SDL_DrawLines(): Unsupported surface format");
     }
 
+    // Segments entirely inside the clip rect, the common case, skip the clipping code
+    clip_x1 = dst->clip_rect.x;
+    clip_y1 = dst->clip_rect.y;
+    clip_x2 = dst->clip_rect.x + dst->clip_rect.w - 1;
+    clip_y2 = dst->clip_rect.y + dst->clip_rect.h - 1;
+
     for (i = 1; i < count; ++i) {
         x1 = points[i - 1].x;
         y1 = points[i - 1].y;
         x2 = points[i].x;
         y2 = points[i].y;
 
-        // Perform clipping
-        // FIXME: We don't actually want to clip, as it may change line slope
-        if (!SDL_GetRectAndLineIntersection(&dst->clip_rect, &x1, &y1, &x2, &y2)) {
-            continue;
+        if (!(x1 >= clip_x1 && x1 <= clip_x2 && y1 >= clip_y1 && y1 <= clip_y2 &&
+              x2 >= clip_x1 && x2 <= clip_x2 && y2 >= clip_y1 && y2 <= clip_y2)) {
+            // Perform clipping
+            // FIXME: We don't actually want to clip, as it may change line slope
+            if (!SDL_GetRectAndLineIntersection(&dst->clip_rect, &x1, &y1, &x2, &y2)) {
+                continue;
+            }
         }
 
         // Draw the end if the whole line is a single point or it was clipped
@@ -46,12 +46,81 @@ typedef struct
     SDL_Color color;
 } SW_DrawStateCache;
 
+// Maximum number of separate dirty regions tracked between presents
+#define SW_MAX_DIRTY_RECTS 16
+
 typedef struct
 {
     SDL_Surface *surface;
     SDL_Surface *window;
+
+    // Whether lines and untextured geometry are drawn with anti-aliased edges
+    bool antialias;
+
+    // Regions of the window surface touched since the last present
+    bool dirty_all;
+    int num_dirty_rects;
+    SDL_Rect dirty_rects[SW_MAX_DIRTY_RECTS];
 } SW_RenderData;
 
+static void SW_InvalidateWindow(SW_RenderData *data)
+{
+    data->dirty_all = true;
+    data->num_dirty_rects = 0;
+}
+
+static void SW_AddDirtyRect(SW_RenderData *data, SDL_Surface *surface, const SDL_Rect *rect)
+{
+    SDL_Rect clipped;
+    int i;
+
+    if (surface != data->window || data->dirty_all) {
+        return;
+    }
+
+    // Nothing outside of the current clip rect can have been touched
+    if (!SDL_GetRectIntersection(rect, &surface->clip_rect, &clipped)) {
+        return;
+    }
+
+    // Merge with an overlapping region, if there is one
+    for (i = 0; i < data->num_dirty_rects; ++i) {
+        if (SDL_HasRectIntersection(&data->dirty_rects[i], &clipped)) {
+            SDL_GetRectUnion(&data->dirty_rects[i], &clipped, &data->dirty_rects[i]);
+            return;
+        }
+    }
+
+    if (data->num_dirty_rects == SW_MAX_DIRTY_RECTS) {
+        // Out of slots, collapse everything into a single region
+        for (i = 1; i < data->num_dirty_rects; ++i) {
+            SDL_GetRectUnion(&data->dirty_rects[0], &data->dirty_rects[i], &data->dirty_rects[0]);
+        }
+        SDL_GetRectUnion(&data->dirty_rects[0], &clipped, &data->dirty_rects[0]);
+        data->num_dirty_rects = 1;
+        return;
+    }
+
+    data->dirty_rects[data->num_dirty_rects++] = clipped;
+}
+
+static void SW_AddDirtyPoints(SW_RenderData *data, SDL_Surface *surface, const SDL_Point *points, int count, int margin)
+{
+    SDL_Rect rect;
+
+    if (surface != data->window || data->dirty_all) {
+        return;
+    }
+
+    if (SDL_GetRectEnclosingPoints(points, count, NULL, &rect)) {
+        rect.x -= margin;
+        rect.y -= margin;
+        rect.w += 2 * margin;
+        rect.h += 2 * margin;
+        SW_AddDirtyRect(data, surface, &rect);
+    }
+}
+
 static SDL_Surface *SW_ActivateRenderer(SDL_Renderer *renderer)
 {
     SW_RenderData *data = (SW_RenderData *)renderer->internal;
@@ -64,6 +133,7 @@ static SDL_Surface *SW_ActivateRenderer(SDL_Renderer *renderer)
         SDL_Surface *surface = SDL_GetWindowSurface(window);
         if (surface) {
             data->surface = data->window = surface;
+            SW_InvalidateWindow(data);
         }
     }
     return data->surface;
@@ -76,6 +146,10 @@ static void SW_WindowEvent(SDL_Renderer *renderer, const SDL_WindowEvent *event)
     if (event->type == SDL_EVENT_WINDOW_PIXEL_SIZE_CHANGED) {
         data->surface = NULL;
         data->window = NULL;
+        SW_InvalidateWindow(data);
+    } else if (event->type == SDL_EVENT_WINDOW_EXPOSED) {
+        // The window contents may have been lost, push everything on the next present
+        SW_InvalidateWindow(data);
     }
 }
 
@@ -356,6 +430,395 @@ static bool Blit_to_Screen(SDL_Surface *src, SDL_Rect *srcrect, SDL_Surface *sur
     return result;
 }
 
+typedef struct SW_AffineCopyData
+{
+    const Uint8 *pixels; // the top left corner of the source rectangle
+    int pitch;
+    int w, h;
+    Sint64 du, dv; // source steps per target pixel, in 16.16 fixed point
+    /* Pixels are rotated so alpha (or padding) ends up in the top byte, after that
+     * source and target have their color components in the same order.
+     */
+    int src_rotate, dst_rotate;
+    bool src_alpha, dst_alpha;
+    Uint32 mod0, mod1, mod2, aMod; // color modulation for the low three bytes, and alpha
+} SW_AffineCopyData;
+
+#define SW_ROTATE_RIGHT(X, N) (((X) >> (N)) | ((X) << ((32 - (N)) & 31)))
+#define SW_ROTATE_LEFT(X, N)  (((X) << (N)) | ((X) >> ((32 - (N)) & 31)))
+
+// Exact division by 255 of the two 16-bit lanes in X, each lane must be at most 255 * 255
+#define SW_DIV255_LANES(X) ((((X) + 0x00010001 + (((X) >> 8) & 0x00FF00FF)) >> 8) & 0x00FF00FF)
+
+// Clamps the two 16-bit lanes in X to 255, each lane must be at most 511
+SDL_FORCE_INLINE Uint32 SW_SaturateLanes(Uint32 x)
+{
+    const Uint32 overflow = x & 0x01000100;
+    return (x | (overflow - (overflow >> 8))) & 0x00FF00FF;
+}
+
+// Interpolates all four components of two pixels at once, w is in [0, 256]
+SDL_FORCE_INLINE Uint32 SW_LerpPixel(Uint32 a, Uint32 b, Uint32 w)
+{
+    const Uint32 rb = ((((a & 0x00FF00FF) * (256 - w)) + ((b & 0x00FF00FF) * w)) >> 8) & 0x00FF00FF;
+    const Uint32 ag = (((((a >> 8) & 0x00FF00FF) * (256 - w)) + (((b >> 8) & 0x00FF00FF) * w)) >> 8) & 0x00FF00FF;
+    return rb | (ag << 8);
+}
+
+SDL_FORCE_INLINE Uint32 SW_SampleAffine(const Uint8 *pixels, int pitch, int w, int h, const bool linear, Sint64 u, Sint64 v)
+{
+    if (linear) {
+        // Bilinear filtering between texel centers, clamped to the source rectangle
+        const Sint64 fu = u - 0x8000;
+        const Sint64 fv = v - 0x8000;
+        const int x0 = (int)(fu >> 16);
+        const int y0 = (int)(fv >> 16);
+        const Uint32 wx = (Uint32)((fu >> 8) & 0xFF);
+        const Uint32 wy = (Uint32)((fv >> 8) & 0xFF);
+        const int sx0 = SDL_max(x0, 0);
+        const int sx1 = SDL_min(x0 + 1, w - 1);
+        const Uint32 *row0 = (const Uint32 *)(pixels + SDL_max(y0, 0) * pitch);
+        const Uint32 *row1 = (const Uint32 *)(pixels + SDL_min(y0 + 1, h - 1) * pitch);
+        return SW_LerpPixel(SW_LerpPixel(row0[sx0], row0[sx1], wx), SW_LerpPixel(row1[sx0], row1[sx1], wx), wy);
+    }
+    return ((const Uint32 *)(pixels + (int)(v >> 16) * pitch))[(int)(u >> 16)];
+}
+
+// Same math as the generic surface blitter, specialized for each blend mode and filter
+SDL_FORCE_INLINE void SW_CopyExAffineSpan(const SW_AffineCopyData *data, Uint32 *dst, int count,
+                                          Sint64 u, Sint64 v, const SDL_BlendMode blendmode, const bool linear)
+{
+    // Keep everything in locals, the compiler can't tell that writing to dst doesn't change them
+    const Uint8 *pixels = data->pixels;
+    const int pitch = data->pitch, w = data->w, h = data->h;
+    const Sint64 du = data->du, dv = data->dv;
+    const int src_rotate = data->src_rotate, dst_rotate = data->dst_rotate;
+    const Uint32 src_amask = data->src_alpha ? 0 : 0xFF000000;
+    const Uint32 dst_amask = data->dst_alpha ? 0xFFFFFFFF : 0x00FFFFFF;
+    const bool modulate_color = ((data->mod0 & data->mod1 & data->mod2) != 255);
+    const bool modulate_alpha = (data->aMod != 255);
+
+    for (; count > 0; --count, ++dst, u += du, v += dv) {
+        Uint32 srcpixel = SW_SampleAffine(pixels, pitch, w, h, linear, u, v);
+        Uint32 srcA, dstpixel;
+
+        srcpixel = SW_ROTATE_RIGHT(srcpixel, src_rotate) | src_amask;
+        srcA = srcpixel >> 24;
+        if (modulate_alpha) {
+            srcA = (srcA * data->aMod) / 255;
+        }
+        if (srcA == 0 && (blendmode == SDL_BLENDMODE_BLEND || blendmode == SDL_BLENDMODE_ADD)) {
+            // Fully transparent, nothing to do
+            continue;
+        }
+
+        if (modulate_color) {
+            const Uint32 src0 = ((srcpixel & 0xFF) * data->mod0) / 255;
+            const Uint32 src1 = (((srcpixel >> 8) & 0xFF) * data->mod1) / 255;
+            const Uint32 src2 = (((srcpixel >> 16) & 0xFF) * data->mod2) / 255;
+            srcpixel = src0 | (src1 << 8) | (src2 << 16);
+        }
+        srcpixel = (srcpixel & 0x00FFFFFF) | (srcA << 24);
+
+        if (blendmode == SDL_BLENDMODE_NONE || (blendmode == SDL_BLENDMODE_BLEND && srcA == 255)) {
+            // The destination is simply replaced
+            *dst = SW_ROTATE_LEFT(srcpixel & dst_amask, dst_rotate);
+            continue;
+        }
+
+        dstpixel = SW_ROTATE_RIGHT(*dst, dst_rotate) | ~dst_amask;
+
+        if (blendmode == SDL_BLENDMODE_MOD || blendmode == SDL_BLENDMODE_MUL) {
+            Uint32 c0 = dstpixel & 0xFF, c1 = (dstpixel >> 8) & 0xFF, c2 = (dstpixel >> 16) & 0xFF;
+            if (blendmode == SDL_BLENDMODE_MOD) {
+                c0 = ((srcpixel & 0xFF) * c0) / 255;
+                c1 = (((srcpixel >> 8) & 0xFF) * c1) / 255;
+                c2 = (((srcpixel >> 16) & 0xFF) * c2) / 255;
+            } else {
+                c0 = SDL_min((((srcpixel & 0xFF) * c0) + (c0 * (255 - srcA))) / 255, 255);
+                c1 = SDL_min(((((srcpixel >> 8) & 0xFF) * c1) + (c1 * (255 - srcA))) / 255, 255);
+                c2 = SDL_min(((((srcpixel >> 16) & 0xFF) * c2) + (c2 * (255 - srcA))) / 255, 255);
+            }
+            dstpixel = c0 | (c1 << 8) | (c2 << 16) | (dstpixel & 0xFF000000);
+        } else {
+            // The remaining modes work on two components per multiply, in 16-bit lanes
+            Uint32 src02 = srcpixel & 0x00FF00FF;
+            Uint32 src13 = (srcpixel >> 8) & 0x00FF00FF;
+            Uint32 dst02 = dstpixel & 0x00FF00FF;
+            Uint32 dst13 = (dstpixel >> 8) & 0x00FF00FF;
+
+            if ((blendmode == SDL_BLENDMODE_BLEND || blendmode == SDL_BLENDMODE_ADD) && srcA < 255) {
+                src02 = SW_DIV255_LANES(src02 * srcA);
+                src13 = (SW_DIV255_LANES(src13 * srcA) & 0xFF) | (srcA << 16);
+            }
+            if (blendmode == SDL_BLENDMODE_BLEND || blendmode == SDL_BLENDMODE_BLEND_PREMULTIPLIED) {
+                dst02 = SW_DIV255_LANES(dst02 * (255 - srcA));
+                dst13 = SW_DIV255_LANES(dst13 * (255 - srcA));
+            } else {
+                // Additive modes leave the destination alpha alone
+                src13 &= 0xFF;
+            }
+            dstpixel = SW_SaturateLanes(src02 + dst02) | (SW_SaturateLanes(src13 + dst13) << 8);
+        }
+
+        *dst = SW_ROTATE_LEFT(dstpixel & dst_amask, dst_rotate);
+    }
+}
+
+typedef void (*SW_AffineSpanFunc)(const SW_AffineCopyData *data, Uint32 *dst, int count, Sint64 u, Sint64 v);
+
+#define SW_AFFINE_SPAN_FUNCS(NAME, BLENDMODE)                                                            \
+    static void NAME##_Nearest(const SW_AffineCopyData *data, Uint32 *dst, int count, Sint64 u, Sint64 v) \
+    {                                                                                                   \
+        SW_CopyExAffineSpan(data, dst, count, u, v, BLENDMODE, false);                                  \
+    }                                                                                                   \
+    static void NAME##_Linear(const SW_AffineCopyData *data, Uint32 *dst, int count, Sint64 u, Sint64 v)  \
+    {                                                                                                   \
+        SW_CopyExAffineSpan(data, dst, count, u, v, BLENDMODE, true);                                   \
+    }
+SW_AFFINE_SPAN_FUNCS(SW_CopyExAffineSpan_None, SDL_BLENDMODE_NONE)
+SW_AFFINE_SPAN_FUNCS(SW_CopyExAffineSpan_Blend, SDL_BLENDMODE_BLEND)
+SW_AFFINE_SPAN_FUNCS(SW_CopyExAffineSpan_BlendPremultiplied, SDL_BLENDMODE_BLEND_PREMULTIPLIED)
+SW_AFFINE_SPAN_FUNCS(SW_CopyExAffineSpan_Add, SDL_BLENDMODE_ADD)
+SW_AFFINE_SPAN_FUNCS(SW_CopyExAffineSpan_AddPremultiplied, SDL_BLENDMODE_ADD_PREMULTIPLIED)
+SW_AFFINE_SPAN_FUNCS(SW_CopyExAffineSpan_Mod, SDL_BLENDMODE_MOD)
+SW_AFFINE_SPAN_FUNCS(SW_CopyExAffineSpan_Mul, SDL_BLENDMODE_MUL)
+#undef SW_AFFINE_SPAN_FUNCS
+
+static SW_AffineSpanFunc SW_GetAffineSpanFunc(SDL_BlendMode blendmode, bool linear)
+{
+#define CASE(BLENDMODE, NAME) \
+    case BLENDMODE:           \
+        return linear ? NAME##_Linear : NAME##_Nearest;
+    switch (blendmode) {
+    CASE(SDL_BLENDMODE_NONE, SW_CopyExAffineSpan_None)
+    CASE(SDL_BLENDMODE_BLEND, SW_CopyExAffineSpan_Blend)
+    CASE(SDL_BLENDMODE_BLEND_PREMULTIPLIED, SW_CopyExAffineSpan_BlendPremultiplied)
+    CASE(SDL_BLENDMODE_ADD, SW_CopyExAffineSpan_Add)
+    CASE(SDL_BLENDMODE_ADD_PREMULTIPLIED, SW_CopyExAffineSpan_AddPremultiplied)
+    CASE(SDL_BLENDMODE_MOD, SW_CopyExAffineSpan_Mod)
+    CASE(SDL_BLENDMODE_MUL, SW_CopyExAffineSpan_Mul)
+    default:
+        return NULL;
+    }
+#undef CASE
+}
+
+// The number of bits to rotate an 8888 pixel right by to get the alpha or padding byte on top
+static int SW_GetAffineRotation(const SDL_PixelFormatDetails *fmt)
+{
+    const int padshift = (0 + 8 + 16 + 24) - fmt->Rshift - fmt->Gshift - fmt->Bshift;
+    return (padshift == 24) ? 0 : 8;
+}
+
+static bool SW_CanRenderCopyExAffine(SDL_Surface *src, SDL_Surface *surface, SDL_ScaleMode scaleMode)
+{
+    SDL_BlendMode blendmode;
+    Uint8 alphaMod, rMod, gMod, bMod;
+    int src_rotate, dst_rotate;
+
+    // Both surfaces need 8 bits per component in 32-bit pixels
+    if (!(SDL_BYTESPERPIXEL(src->format) == 4 && SDL_PIXELLAYOUT(src->format) == SDL_PACKEDLAYOUT_8888) ||
+        !(SDL_BYTESPERPIXEL(surface->format) == 4 && SDL_PIXELLAYOUT(surface->format) == SDL_PACKEDLAYOUT_8888) ||
+        SDL_SurfaceHasColorKey(src)) {
+        return false;
+    }
+
+    // ... with the color components in the same order
+    src_rotate = SW_GetAffineRotation(src->fmt);
+    dst_rotate = SW_GetAffineRotation(surface->fmt);
+    if (src->fmt->Rshift - src_rotate != surface->fmt->Rshift - dst_rotate ||
+        src->fmt->Gshift - src_rotate != surface->fmt->Gshift - dst_rotate ||
+        src->fmt->Bshift - src_rotate != surface->fmt->Bshift - dst_rotate) {
+        return false;
+    }
+
+    /* Without filtering or modulation the rotated copy is a plain pixel shuffle and the
+     * final blit gets the vectorized blenders, which beats blending pixel by pixel here.
+     */
+    SDL_GetSurfaceAlphaMod(src, &alphaMod);
+    SDL_GetSurfaceColorMod(src, &rMod, &gMod, &bMod);
+    if (scaleMode != SDL_SCALEMODE_LINEAR && (alphaMod & rMod & gMod & bMod) == 255) {
+        return false;
+    }
+
+    SDL_GetSurfaceBlendMode(src, &blendmode);
+    return SW_GetAffineSpanFunc(blendmode, false) != NULL;
+}
+
+/* Draws a rotated, flipped and scaled copy with color modulation directly into the target.
+ * Each target pixel covered by the transformed rectangle is mapped back into the source,
+ * sampled and blended in a single pass, without any intermediate surfaces.
+ */
+static bool SW_RenderCopyExAffine(SDL_Surface *surface, SDL_Surface *src,
+                                  const SDL_Rect *srcrect, const SDL_Rect *final_rect,
+                                  const double angle, const SDL_FPoint *center, const SDL_FlipMode flip, float scale_x, float scale_y, const SDL_ScaleMode scaleMode)
+{
+    const double radangle = angle * (SDL_PI_D / 180.0);
+    const double sinangle = SDL_sin(radangle);
+    const double cosangle = SDL_cos(radangle);
+    const double pivot_x = final_rect->x + center->x;
+    const double pivot_y = final_rect->y + center->y;
+    SW_AffineCopyData data;
+    double kx, ky;
+    double dudx, dudy, dvdx, dvdy;
+    double minx, maxx, miny, maxy;
+    SDL_Rect bounds;
+    SDL_BlendMode blendmode;
+    SW_AffineSpanFunc span;
+    Uint8 alphaMod, rMod, gMod, bMod;
+    Uint32 mods[3];
+    Sint64 du, dv, max_u, max_v;
+    int i, y;
+
+    if (final_rect->w <= 0 || final_rect->h <= 0 || srcrect->w <= 0 || srcrect->h <= 0 ||
+        scale_x <= 0.0f || scale_y <= 0.0f) {
+        return true;
+    }
+
+    // Bounding box of the rotated destination rectangle, in target pixels
+    minx = miny = SDL_MAX_SINT32;
+    maxx = maxy = SDL_MIN_SINT32;
+    for (i = 0; i < 4; ++i) {
+        const double lx = ((i == 1 || i == 2) ? final_rect->w : 0) - center->x;
+        const double ly = ((i >= 2) ? final_rect->h : 0) - center->y;
+        const double tx = (pivot_x + lx * cosangle - ly * sinangle) * scale_x;
+        const double ty = (pivot_y + lx * sinangle + ly * cosangle) * scale_y;
+        minx = SDL_min(minx, tx);
+        maxx = SDL_max(maxx, tx);
+        miny = SDL_min(miny, ty);
+        maxy = SDL_max(maxy, ty);
+    }
+    bounds.x = (int)SDL_floor(minx);
+    bounds.y = (int)SDL_floor(miny);
+    bounds.w = (int)SDL_ceil(maxx) - bounds.x;
+    bounds.h = (int)SDL_ceil(maxy) - bounds.y;
+    if (!SDL_GetRectIntersection(&bounds, &surface->clip_rect, &bounds)) {
+        return true;
+    }
+
+    /* The inverse transform is affine: a target pixel center maps to (u, v) in the source
+     * rectangle with constant steps along x and y.
+     */
+    kx = (double)srcrect->w / final_rect->w;
+    ky = (double)srcrect->h / final_rect->h;
+    dudx = (cosangle / scale_x) * kx;
+    dudy = (sinangle / scale_y) * kx;
+    dvdx = (-sinangle / scale_x) * ky;
+    dvdy = (cosangle / scale_y) * ky;
+    if (flip & SDL_FLIP_HORIZONTAL) {
+        dudx = -dudx;
+        dudy = -dudy;
+    }
+    if (flip & SDL_FLIP_VERTICAL) {
+        dvdx = -dvdx;
+        dvdy = -dvdy;
+    }
+
+    // Source coordinates are walked in 16.16 fixed point
+    du = (Sint64)(dudx * 65536.0);
+    dv = (Sint64)(dvdx * 65536.0);
+    max_u = (Sint64)srcrect->w << 16;
+    max_v = (Sint64)srcrect->h << 16;
+
+    SDL_GetSurfaceBlendMode(src, &blendmode);
+    SDL_GetSurfaceAlphaMod(src, &alphaMod);
+    SDL_GetSurfaceColorMod(src, &rMod, &gMod, &bMod);
+    span = SW_GetAffineSpanFunc(blendmode, (scaleMode == SDL_SCALEMODE_LINEAR));
+
+    if (SDL_MUSTLOCK(src)) {
+        if (!SDL_LockSurface(src)) {
+            return false;
+        }
+    }
+
+    data.pixels = (const Uint8 *)src->pixels + srcrect->y * src->pitch + srcrect->x * 4;
+    data.pitch = src->pitch;
+    data.w = srcrect->w;
+    data.h = srcrect->h;
+    data.du = du;
+    data.dv = dv;
+    data.src_rotate = SW_GetAffineRotation(src->fmt);
+    data.dst_rotate = SW_GetAffineRotation(surface->fmt);
+    data.src_alpha = (src->fmt->Amask != 0);
+    data.dst_alpha = (surface->fmt->Amask != 0);
+    mods[(surface->fmt->Rshift - data.dst_rotate) / 8] = rMod;
+    mods[(surface->fmt->Gshift - data.dst_rotate) / 8] = gMod;
+    mods[(surface->fmt->Bshift - data.dst_rotate) / 8] = bMod;
+    data.mod0 = mods[0];
+    data.mod1 = mods[1];
+    data.mod2 = mods[2];
+    data.aMod = alphaMod;
+
+#define AFFINE_INSIDE(X) \
+    (u + du * (X) >= 0 && u + du * (X) < max_u && v + dv * (X) >= 0 && v + dv * (X) < max_v)
+
+    for (y = bounds.y; y < bounds.y + bounds.h; ++y) {
+        const double qx = (bounds.x + 0.5) / scale_x - pivot_x;
+        const double qy = (y + 0.5) / scale_y - pivot_y;
+        double u0 = (qx * cosangle + qy * sinangle + center->x) * kx;
+        double v0 = (-qx * sinangle + qy * cosangle + center->y) * ky;
+        double first = 0.0, last = bounds.w;
+        Sint64 u, v;
+        int x0, x1;
+
+        if (flip & SDL_FLIP_HORIZONTAL) {
+            u0 = srcrect->w - u0;
+        }
+        if (flip & SDL_FLIP_VERTICAL) {
+            v0 = srcrect->h - v0;
+        }
+
+        // The pixels inside the source rectangle form a single span, estimate it...
+        if (dudx != 0.0) {
+            const double a = -u0 / dudx;
+            const double b = (srcrect->w - u0) / dudx;
+            first = SDL_max(first, SDL_min(a, b));
+            last = SDL_min(last, SDL_max(a, b));
+        }
+        if (dvdx != 0.0) {
+            const double a = -v0 / dvdx;
+            const double b = (srcrect->h - v0) / dvdx;
+            first = SDL_max(first, SDL_min(a, b));
+            last = SDL_min(last, SDL_max(a, b));
+        }
+        if (first >= last) {
+            continue;
+        }
+        x0 = (int)SDL_floor(first);
+        x1 = (int)SDL_ceil(last);
+
+        // ... and then settle its exact ends in fixed point
+        u = (Sint64)SDL_floor(u0 * 65536.0);
+        v = (Sint64)SDL_floor(v0 * 65536.0);
+        while (x0 > 0 && AFFINE_INSIDE(x0 - 1)) {
+            --x0;
+        }
+        while (x0 < x1 && !AFFINE_INSIDE(x0)) {
+            ++x0;
+        }
+        while (x1 < bounds.w && AFFINE_INSIDE(x1)) {
+            ++x1;
+        }
+        while (x1 > x0 && !AFFINE_INSIDE(x1 - 1)) {
+            --x1;
+        }
+        if (x0 >= x1) {
+            continue;
+        }
+
+        span(&data, (Uint32 *)((Uint8 *)surface->pixels + y * surface->pitch) + bounds.x + x0, x1 - x0,
+             u + du * x0, v + dv * x0);
+    }
+
+#undef AFFINE_INSIDE
+
+    if (SDL_MUSTLOCK(src)) {
+        SDL_UnlockSurface(src);
+    }
+    return true;
+}
+
 static bool SW_RenderCopyEx(SDL_Renderer *renderer, SDL_Surface *surface, SDL_Texture *texture,
                             const SDL_Rect *srcrect, const SDL_Rect *final_rect,
                             const double angle, const SDL_FPoint *center, const SDL_FlipMode flip, float scale_x, float scale_y, const SDL_ScaleMode scaleMode)
@@ -375,6 +838,10 @@ static bool SW_RenderCopyEx(SDL_Renderer *renderer, SDL_Surface *surface, SDL_Te
         return false;
     }
 
+    if (SW_CanRenderCopyExAffine(src, surface, scaleMode)) {
+        return SW_RenderCopyExAffine(surface, src, srcrect, final_rect, angle, center, flip, scale_x, scale_y, scaleMode);
+    }
+
     tmp_rect.x = 0;
     tmp_rect.y = 0;
     tmp_rect.w = final_rect->w;
@@ -664,6 +1131,54 @@ static bool SW_QueueGeometry(SDL_Renderer *renderer, SDL_RenderCommand *cmd, SDL
     return true;
 }
 
+// Returns a mask of the edges of triangle 'a' that are also edges of triangle 'b', bit N being the edge opposite to vertex N
+static int SW_GetSharedTriangleEdges(const GeometryFillData *a, const GeometryFillData *b)
+{
+    int mask = 0;
+    int i, j;
+
+    for (i = 0; i < 3; i++) {
+        const SDL_Point *p = &a[(i + 1) % 3].dst;
+        const SDL_Point *q = &a[(i + 2) % 3].dst;
+        for (j = 0; j < 3; j++) {
+            const SDL_Point *u = &b[j].dst;
+            const SDL_Point *v = &b[(j + 1) % 3].dst;
+            if ((p->x == u->x && p->y == u->y && q->x == v->x && q->y == v->y) ||
+                (p->x == v->x && p->y == v->y && q->x == u->x && q->y == u->y)) {
+                mask |= (1 << i);
+                break;
+            }
+        }
+    }
+    return mask;
+}
+
+static void SW_AddDirtyGeometry(SW_RenderData *data, SDL_Surface *surface, const SDL_Point *first, size_t stride, int count, int margin)
+{
+    SDL_Point min, max;
+    SDL_Rect rect;
+    int i;
+
+    if (surface != data->window || data->dirty_all || count <= 0) {
+        return;
+    }
+
+    min = max = *first;
+    for (i = 1; i < count; i++) {
+        const SDL_Point *point = (const SDL_Point *)((const Uint8 *)first + i * stride);
+        min.x = SDL_min(min.x, point->x);
+        min.y = SDL_min(min.y, point->y);
+        max.x = SDL_max(max.x, point->x);
+        max.y = SDL_max(max.y, point->y);
+    }
+    SDL_SW_BoundingRectFixedpoint(&min, &max, &max, &rect);
+    rect.x -= margin;
+    rect.y -= margin;
+    rect.w += 2 * margin;
+    rect.h += 2 * margin;
+    SW_AddDirtyRect(data, surface, &rect);
+}
+
 static void PrepTextureForCopy(const SDL_RenderCommand *cmd, SW_DrawStateCache *drawstate, const SDL_Rect *srcrect)
 {
     const Uint8 r = drawstate->color.r;
@@ -718,6 +1233,7 @@ static void SW_InvalidateCachedState(SDL_Renderer *renderer)
 
 static bool SW_RunCommandQueue(SDL_Renderer *renderer, SDL_RenderCommand *cmd, void *vertices, size_t vertsize)
 {
+    SW_RenderData *data = (SW_RenderData *)renderer->internal;
     SDL_Surface *surface = SW_ActivateRenderer(renderer);
     SW_DrawStateCache drawstate;
 
@@ -768,6 +1284,9 @@ static bool SW_RunCommandQueue(SDL_Renderer *renderer, SDL_RenderCommand *cmd, v
             SDL_SetSurfaceClipRect(surface, NULL);
             SDL_FillSurfaceRect(surface, NULL, SDL_MapSurfaceRGBA(surface, r, g, b, a));
             drawstate.surface_cliprect_dirty = true;
+            if (surface == data->window) {
+                SW_InvalidateWindow(data);
+            }
             break;
         }
 
@@ -796,6 +1315,7 @@ static bool SW_RunCommandQueue(SDL_Renderer *renderer, SDL_RenderCommand *cmd, v
             } else {
                 SDL_BlendPoints(surface, verts, count, blend, r, g, b, a);
             }
+            SW_AddDirtyPoints(data, surface, verts, count, 0);
             break;
         }
 
@@ -819,11 +1339,14 @@ static bool SW_RunCommandQueue(SDL_Renderer *renderer, SDL_RenderCommand *cmd, v
                 }
             }
 
-            if (blend == SDL_BLENDMODE_NONE) {
+            if (data->antialias) {
+                SDL_SW_DrawLinesAA(surface, verts, count, blend, drawstate.color);
+            } else if (blend == SDL_BLENDMODE_NONE) {
                 SDL_DrawLines(surface, verts, count, SDL_MapSurfaceRGBA(surface, r, g, b, a));
             } else {
                 SDL_BlendLines(surface, verts, count, blend, r, g, b, a);
             }
+            SW_AddDirtyPoints(data, surface, verts, count, data->antialias ? 1 : 0);
             break;
         }
 
@@ -852,6 +1375,14 @@ static bool SW_RunCommandQueue(SDL_Renderer *renderer, SDL_RenderCommand *cmd, v
             } else {
                 SDL_BlendFillRects(surface, verts, count, blend, r, g, b, a);
             }
+            if (surface == data->window && !data->dirty_all && count > 0) {
+                SDL_Rect bounds = verts[0];
+                int i;
+                for (i = 1; i < count; i++) {
+                    SDL_GetRectUnion(&bounds, &verts[i], &bounds);
+                }
+                SW_AddDirtyRect(data, surface, &bounds);
+            }
             break;
         }
 
@@ -873,6 +1404,8 @@ static bool SW_RunCommandQueue(SDL_Renderer *renderer, SDL_RenderCommand *cmd, v
                 dstrect->y += drawstate.viewport->y;
             }
 
+            SW_AddDirtyRect(data, surface, dstrect);
+
             if (srcrect->w == dstrect->w && srcrect->h == dstrect->h) {
                 SDL_BlitSurface(src, srcrect, surface, dstrect);
             } else {
@@ -933,6 +1466,24 @@ static bool SW_RunCommandQueue(SDL_Renderer *renderer, SDL_RenderCommand *cmd, v
             SW_RenderCopyEx(renderer, surface, cmd->data.draw.texture, &copydata->srcrect,
                             &copydata->dstrect, copydata->angle, &copydata->center, copydata->flip,
                             copydata->scale_x, copydata->scale_y, cmd->data.draw.texture_scale_mode);
+
+            if (surface == data->window && !data->dirty_all) {
+                /* Any rotation of the destination rect around the center stays within the circle
+                 * through its farthest corner, so use the bounding box of that circle.
+                 */
+                const SDL_Rect *dstrect = &copydata->dstrect;
+                const float cx = dstrect->x + copydata->center.x;
+                const float cy = dstrect->y + copydata->center.y;
+                const float dx = SDL_max(copydata->center.x, dstrect->w - copydata->center.x);
+                const float dy = SDL_max(copydata->center.y, dstrect->h - copydata->center.y);
+                const float radius = SDL_sqrtf(dx * dx + dy * dy) + 1.0f;
+                SDL_Rect bounds;
+                bounds.x = (int)SDL_floorf((cx - radius) * copydata->scale_x);
+                bounds.y = (int)SDL_floorf((cy - radius) * copydata->scale_y);
+                bounds.w = (int)SDL_ceilf(2.0f * radius * copydata->scale_x) + 1;
+                bounds.h = (int)SDL_ceilf(2.0f * radius * copydata->scale_y) + 1;
+                SW_AddDirtyRect(data, surface, &bounds);
+            }
             break;
         }
 
@@ -965,6 +1516,8 @@ static bool SW_RunCommandQueue(SDL_Renderer *renderer, SDL_RenderCommand *cmd, v
                     }
                 }
 
+                SW_AddDirtyGeometry(data, surface, &ptr[0].dst, sizeof(*ptr), count, 0);
+
                 for (i = 0; i < count; i += 3, ptr += 3) {
                     SDL_SW_BlitTriangle(
                         src,
@@ -990,8 +1543,22 @@ static bool SW_RunCommandQueue(SDL_Renderer *renderer, SDL_RenderCommand *cmd, v
                     }
                 }
 
+                SW_AddDirtyGeometry(data, surface, &ptr[0].dst, sizeof(*ptr), count, data->antialias ? 1 : 0);
+
                 for (i = 0; i < count; i += 3, ptr += 3) {
-                    SDL_SW_FillTriangle(surface, &(ptr[0].dst), &(ptr[1].dst), &(ptr[2].dst), blend, ptr[0].color, ptr[1].color, ptr[2].color);
+                    if (data->antialias) {
+                        // Edges shared with the neighboring triangles are inside the mesh, keep them sharp
+                        int aa_edges = 0x7;
+                        if (i > 0) {
+                            aa_edges &= ~SW_GetSharedTriangleEdges(ptr, ptr - 3);
+                        }
+                        if (i + 3 < count) {
+                            aa_edges &= ~SW_GetSharedTriangleEdges(ptr, ptr + 3);
+                        }
+                        SDL_SW_FillTriangleAA(surface, &(ptr[0].dst), &(ptr[1].dst), &(ptr[2].dst), aa_edges, blend, ptr[0].color, ptr[1].color, ptr[2].color);
+                    } else {
+                        SDL_SW_FillTriangle(surface, &(ptr[0].dst), &(ptr[1].dst), &(ptr[2].dst), blend, ptr[0].color, ptr[1].color, ptr[2].color);
+                    }
                 }
             }
             break;
@@ -1035,12 +1602,25 @@ static SDL_Surface *SW_RenderReadPixels(SDL_Renderer *renderer, const SDL_Rect *
 
 static bool SW_RenderPresent(SDL_Renderer *renderer)
 {
+    SW_RenderData *data = (SW_RenderData *)renderer->internal;
     SDL_Window *window = renderer->window;
+    bool result;
 
     if (!window) {
         return false;
     }
-    return SDL_UpdateWindowSurface(window);
+
+    if (data->dirty_all) {
+        result = SDL_UpdateWindowSurface(window);
+    } else if (data->num_dirty_rects > 0) {
+        result = SDL_UpdateWindowSurfaceRects(window, data->dirty_rects, data->num_dirty_rects);
+    } else {
+        // Nothing changed since the last present
+        result = false;
+    }
+    data->dirty_all = false;
+    data->num_dirty_rects = 0;
+    return result;
 }
 
 static void SW_DestroyTexture(SDL_Renderer *renderer, SDL_Texture *texture)
@@ -1186,6 +1766,8 @@ bool SW_CreateRendererForSurface(SDL_Renderer *renderer, SDL_Surface *surface, S
     }
     data->surface = surface;
     data->window = surface;
+    data->antialias = SDL_GetBooleanProperty(create_props, SDL_PROP_RENDERER_CREATE_SOFTWARE_ANTIALIAS_BOOLEAN, false);
+    data->dirty_all = true;
 
     renderer->WindowEvent = SW_WindowEvent;
     renderer->GetOutputSize = SW_GetOutputSize;
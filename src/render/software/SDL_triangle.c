@@ -136,7 +136,7 @@ void trianglepoint_2_fixedpoint(SDL_Point *a)
 }
 
 // bounding rect of three points (in fixed point)
-static void bounding_rect_fixedpoint(const SDL_Point *a, const SDL_Point *b, const SDL_Point *c, SDL_Rect *r)
+void SDL_SW_BoundingRectFixedpoint(const SDL_Point *a, const SDL_Point *b, const SDL_Point *c, SDL_Rect *r)
 {
     int min_x = SDL_min(a->x, SDL_min(b->x, c->x));
     int max_x = SDL_max(a->x, SDL_max(b->x, c->x));
@@ -271,7 +271,7 @@ bool SDL_SW_FillTriangle(SDL_Surface *dst, SDL_Point *d0, SDL_Point *d1, SDL_Poi
         }
     }
 
-    bounding_rect_fixedpoint(d0, d1, d2, &dstrect);
+    SDL_SW_BoundingRectFixedpoint(d0, d1, d2, &dstrect);
 
     {
         // Clip triangle rect with surface rect
@@ -462,6 +462,485 @@ end:
     return result;
 }
 
+/* Anti-aliased triangle and line rendering
+ *
+ * Rather than testing each pixel center against the edges, the signed distance from
+ * the pixel center to each edge gives an analytic estimate of the pixel coverage,
+ * and the pixel is blended into the destination with that coverage.
+ */
+
+// Exact division by 255 for values in [0, 255 * 255]
+#define AA_DIV255(x) (((x) + 1 + ((x) >> 8)) >> 8)
+
+static Uint32 read_pixel(const Uint8 *dptr, int bpp)
+{
+    Uint32 pixel = 0;
+
+    if (bpp == 4) {
+        pixel = *(const Uint32 *)dptr;
+    } else if (bpp == 3) {
+        Uint8 *s = (Uint8 *)&pixel;
+        s[0] = dptr[0];
+        s[1] = dptr[1];
+        s[2] = dptr[2];
+    } else if (bpp == 2) {
+        pixel = *(const Uint16 *)dptr;
+    } else if (bpp == 1) {
+        pixel = *dptr;
+    }
+    return pixel;
+}
+
+static void write_pixel(Uint8 *dptr, int bpp, Uint32 pixel)
+{
+    if (bpp == 4) {
+        *(Uint32 *)dptr = pixel;
+    } else if (bpp == 3) {
+        Uint8 *s = (Uint8 *)&pixel;
+        dptr[0] = s[0];
+        dptr[1] = s[1];
+        dptr[2] = s[2];
+    } else if (bpp == 2) {
+        *(Uint16 *)dptr = (Uint16)pixel;
+    } else if (bpp == 1) {
+        *dptr = (Uint8)pixel;
+    }
+}
+
+/* Blend one color component, as if the blend mode was applied with the full source
+ * color and the result was then interpolated with the destination by the coverage.
+ * 'a' is the source alpha already scaled by the coverage.
+ */
+static Uint8 blend_component(SDL_BlendMode blend, int s, int d, int a, int coverage)
+{
+    int v;
+
+    switch (blend) {
+    case SDL_BLENDMODE_NONE:
+        v = AA_DIV255(s * coverage + d * (255 - coverage));
+        break;
+    case SDL_BLENDMODE_BLEND_PREMULTIPLIED:
+        v = AA_DIV255(s * coverage) + AA_DIV255(d * (255 - a));
+        break;
+    case SDL_BLENDMODE_ADD:
+        v = d + AA_DIV255(s * a);
+        break;
+    case SDL_BLENDMODE_ADD_PREMULTIPLIED:
+        v = d + AA_DIV255(s * coverage);
+        break;
+    case SDL_BLENDMODE_MOD:
+        v = AA_DIV255(d * (255 - AA_DIV255((255 - s) * coverage)));
+        break;
+    case SDL_BLENDMODE_MUL:
+        v = AA_DIV255(AA_DIV255(s * d) * coverage) + AA_DIV255(d * (255 - a));
+        break;
+    default:
+        v = AA_DIV255(s * a + d * (255 - a));
+        break;
+    }
+    return (Uint8)SDL_min(v, 255);
+}
+
+static void blend_pixel_coverage(Uint8 *dptr, int bpp, const SDL_PixelFormatDetails *format, const SDL_Palette *palette,
+                                 SDL_BlendMode blend, int r, int g, int b, int a, int coverage)
+{
+    Uint8 dr, dg, db, da;
+    int sa;
+
+    if (coverage >= 255 && blend == SDL_BLENDMODE_NONE) {
+        write_pixel(dptr, bpp, SDL_MapRGBA(format, palette, (Uint8)r, (Uint8)g, (Uint8)b, (Uint8)a));
+        return;
+    }
+
+    SDL_GetRGBA(read_pixel(dptr, bpp), format, palette, &dr, &dg, &db, &da);
+
+    sa = AA_DIV255(a * coverage);
+    dr = blend_component(blend, r, dr, sa, coverage);
+    dg = blend_component(blend, g, dg, sa, coverage);
+    db = blend_component(blend, b, db, sa, coverage);
+    switch (blend) {
+    case SDL_BLENDMODE_NONE:
+        da = (Uint8)AA_DIV255(a * coverage + da * (255 - coverage));
+        break;
+    case SDL_BLENDMODE_BLEND:
+    case SDL_BLENDMODE_BLEND_PREMULTIPLIED:
+        da = (Uint8)(sa + AA_DIV255(da * (255 - sa)));
+        break;
+    default:
+        break;
+    }
+
+    write_pixel(dptr, bpp, SDL_MapRGBA(format, palette, dr, dg, db, da));
+}
+
+// Coverage of a pixel by the inner side of one edge, in 1/255ths
+static SDL_INLINE int edge_coverage(Sint64 w, Sint64 half_pixel, float scale, int bias)
+{
+    if (half_pixel == 0) {
+        // Edge without anti-aliasing
+        return (w + bias >= 0) ? 255 : 0;
+    }
+    if (w >= half_pixel) {
+        return 255;
+    }
+    if (w <= -half_pixel) {
+        return 0;
+    }
+    return (int)(127.5f + (float)w * scale);
+}
+
+static void edge_setup(const SDL_Point *a, const SDL_Point *b, bool antialias, Sint64 *half_pixel, float *scale)
+{
+    if (antialias) {
+        /* The edge function grows by (1 << FP_BITS) * length for each pixel away from the edge,
+         * both measured in fixed point.
+         */
+        const float dx = (float)(b->x - a->x);
+        const float dy = (float)(b->y - a->y);
+        const float w_per_pixel = (float)(1 << FP_BITS) * SDL_sqrtf(dx * dx + dy * dy);
+        *half_pixel = (Sint64)SDL_ceilf(w_per_pixel / 2.0f);
+        *scale = 255.0f / w_per_pixel;
+    } else {
+        *half_pixel = 0;
+        *scale = 0.0f;
+    }
+}
+
+bool SDL_SW_FillTriangleAA(SDL_Surface *dst, SDL_Point *d0, SDL_Point *d1, SDL_Point *d2, int aa_edges, SDL_BlendMode blend, SDL_Color c0, SDL_Color c1, SDL_Color c2)
+{
+    bool result = true;
+    int dst_locked = 0;
+
+    SDL_Rect dstrect;
+
+    int dstbpp;
+    Uint8 *dst_ptr;
+    int dst_pitch;
+
+    Sint64 area;
+    int is_clockwise;
+
+    int d2d1_y, d1d2_x, d0d2_y, d2d0_x, d1d0_y, d0d1_x;
+    Sint64 w0_row, w1_row, w2_row;
+    int bias_w0, bias_w1, bias_w2;
+    Sint64 half_w0, half_w1, half_w2;
+    float scale_w0, scale_w1, scale_w2;
+
+    bool is_uniform;
+
+    const SDL_PixelFormatDetails *format;
+    SDL_Palette *palette;
+
+    /* Fully covered pixels are filled the same way as SDL_SW_FillTriangle() does it:
+     * directly without blending, or into an intermediate surface that is blended at the end.
+     */
+    SDL_Surface *tmp = NULL;
+    const SDL_PixelFormatDetails *fill_format;
+    SDL_Palette *fill_palette;
+    int fill_bpp;
+    Uint8 *fill_ptr;
+    int fill_pitch;
+    Uint32 fill_color;
+
+    int x, y;
+
+    if (!SDL_SurfaceValid(dst)) {
+        return false;
+    }
+
+    area = cross_product(d0, d1, d2->x, d2->y);
+
+    is_uniform = COLOR_EQ(c0, c1) && COLOR_EQ(c1, c2);
+
+    // Flat triangle
+    if (area == 0) {
+        return true;
+    }
+
+    // Lock the destination, if needed
+    if (SDL_MUSTLOCK(dst)) {
+        if (!SDL_LockSurface(dst)) {
+            result = false;
+            goto end;
+        } else {
+            dst_locked = 1;
+        }
+    }
+
+    SDL_SW_BoundingRectFixedpoint(d0, d1, d2, &dstrect);
+
+    // Partially covered pixels can lie just outside of the rasterized area
+    dstrect.x -= 1;
+    dstrect.y -= 1;
+    dstrect.w += 3;
+    dstrect.h += 3;
+
+    {
+        // Clip triangle rect with surface rect
+        SDL_Rect rect;
+        rect.x = 0;
+        rect.y = 0;
+        rect.w = dst->w;
+        rect.h = dst->h;
+        SDL_GetRectIntersection(&dstrect, &rect, &dstrect);
+    }
+
+    {
+        // Clip triangle with surface clip rect
+        SDL_Rect rect;
+        SDL_GetSurfaceClipRect(dst, &rect);
+        SDL_GetRectIntersection(&dstrect, &rect, &dstrect);
+    }
+
+    format = dst->fmt;
+    palette = dst->palette;
+    dstbpp = format->bytes_per_pixel;
+    dst_ptr = (Uint8 *)dst->pixels + dstrect.x * dstbpp + dstrect.y * dst->pitch;
+    dst_pitch = dst->pitch;
+
+    if (blend != SDL_BLENDMODE_NONE) {
+        SDL_PixelFormat tmp_format = dst->format;
+
+        // need an alpha format
+        if (!SDL_ISPIXELFORMAT_ALPHA(tmp_format)) {
+            tmp_format = SDL_PIXELFORMAT_ARGB8888;
+        }
+
+        // Pixels left transparent leave the destination unchanged when blended
+        tmp = SDL_CreateSurfaceZeroed(dstrect.w, dstrect.h, tmp_format);
+        if (!tmp) {
+            result = false;
+            goto end;
+        }
+
+        if (blend == SDL_BLENDMODE_MOD) {
+            Uint32 c = SDL_MapSurfaceRGBA(tmp, 255, 255, 255, 255);
+            SDL_FillSurfaceRect(tmp, NULL, c);
+        }
+
+        SDL_SetSurfaceBlendMode(tmp, blend);
+
+        fill_format = tmp->fmt;
+        fill_palette = tmp->palette;
+        fill_ptr = (Uint8 *)tmp->pixels;
+        fill_pitch = tmp->pitch;
+    } else {
+        fill_format = format;
+        fill_palette = palette;
+        fill_ptr = dst_ptr;
+        fill_pitch = dst_pitch;
+    }
+    fill_bpp = fill_format->bytes_per_pixel;
+
+    is_clockwise = area > 0;
+    if (area < 0) {
+        area = -area;
+    }
+
+    {
+        int val;
+        PRECOMP(d2d1_y, d1->y - d2->y);
+        PRECOMP(d0d2_y, d2->y - d0->y);
+        PRECOMP(d1d0_y, d0->y - d1->y);
+        PRECOMP(d1d2_x, d2->x - d1->x);
+        PRECOMP(d2d0_x, d0->x - d2->x);
+        PRECOMP(d0d1_x, d1->x - d0->x);
+    }
+
+    // Starting point for rendering, at the middle of a pixel
+    {
+        SDL_Point p;
+        p.x = dstrect.x;
+        p.y = dstrect.y;
+        trianglepoint_2_fixedpoint(&p);
+        p.x += (1 << FP_BITS) / 2;
+        p.y += (1 << FP_BITS) / 2;
+        w0_row = cross_product(d1, d2, p.x, p.y);
+        w1_row = cross_product(d2, d0, p.x, p.y);
+        w2_row = cross_product(d0, d1, p.x, p.y);
+    }
+
+    // Handle anti-clockwise triangles
+    if (!is_clockwise) {
+        d2d1_y *= -1;
+        d0d2_y *= -1;
+        d1d0_y *= -1;
+        d1d2_x *= -1;
+        d2d0_x *= -1;
+        d0d1_x *= -1;
+        w0_row *= -1;
+        w1_row *= -1;
+        w2_row *= -1;
+    }
+
+    // Edges that aren't anti-aliased still respect the top-left rasterization rule
+    bias_w0 = (is_top_left(d1, d2, is_clockwise) ? 0 : -1);
+    bias_w1 = (is_top_left(d2, d0, is_clockwise) ? 0 : -1);
+    bias_w2 = (is_top_left(d0, d1, is_clockwise) ? 0 : -1);
+
+    edge_setup(d1, d2, (aa_edges & 0x1) != 0, &half_w0, &scale_w0);
+    edge_setup(d2, d0, (aa_edges & 0x2) != 0, &half_w1, &scale_w1);
+    edge_setup(d0, d1, (aa_edges & 0x4) != 0, &half_w2, &scale_w2);
+
+    fill_color = SDL_MapRGBA(fill_format, fill_palette, c0.r, c0.g, c0.b, c0.a);
+
+    for (y = 0; y < dstrect.h; y++) {
+        Sint64 w0 = w0_row;
+        Sint64 w1 = w1_row;
+        Sint64 w2 = w2_row;
+        Uint8 *dptr = dst_ptr;
+        Uint8 *fptr = fill_ptr;
+        for (x = 0; x < dstrect.w; x++) {
+            int coverage = edge_coverage(w0, half_w0, scale_w0, bias_w0);
+            if (coverage > 0) {
+                coverage = SDL_min(coverage, edge_coverage(w1, half_w1, scale_w1, bias_w1));
+            }
+            if (coverage > 0) {
+                coverage = SDL_min(coverage, edge_coverage(w2, half_w2, scale_w2, bias_w2));
+            }
+            if (coverage >= 255) {
+                if (is_uniform) {
+                    write_pixel(fptr, fill_bpp, fill_color);
+                } else {
+                    TRIANGLE_GET_COLOR
+                    write_pixel(fptr, fill_bpp, SDL_MapRGBA(fill_format, fill_palette, (Uint8)r, (Uint8)g, (Uint8)b, (Uint8)a));
+                }
+            } else if (coverage > 0) {
+                if (is_uniform) {
+                    blend_pixel_coverage(dptr, dstbpp, format, palette, blend, c0.r, c0.g, c0.b, c0.a, coverage);
+                } else {
+                    // Pixels just outside of the triangle extrapolate, so clamp the result
+                    TRIANGLE_GET_COLOR
+                    r = SDL_clamp(r, 0, 255);
+                    g = SDL_clamp(g, 0, 255);
+                    b = SDL_clamp(b, 0, 255);
+                    a = SDL_clamp(a, 0, 255);
+                    blend_pixel_coverage(dptr, dstbpp, format, palette, blend, r, g, b, a, coverage);
+                }
+            }
+            /* x += 1 */
+            w0 += d2d1_y;
+            w1 += d0d2_y;
+            w2 += d1d0_y;
+            dptr += dstbpp;
+            fptr += fill_bpp;
+        }
+        /* y += 1 */
+        w0_row += d1d2_x;
+        w1_row += d2d0_x;
+        w2_row += d0d1_x;
+        dst_ptr += dst_pitch;
+        fill_ptr += fill_pitch;
+    }
+
+    if (tmp) {
+        SDL_BlitSurface(tmp, NULL, dst, &dstrect);
+    }
+
+end:
+    SDL_DestroySurface(tmp);
+    if (dst_locked) {
+        SDL_UnlockSurface(dst);
+    }
+
+    return result;
+}
+
+static void plot_coverage(SDL_Surface *dst, int x, int y, SDL_BlendMode blend, SDL_Color color, int coverage)
+{
+    const SDL_Rect *clip = &dst->clip_rect;
+    const int bpp = dst->fmt->bytes_per_pixel;
+
+    if (coverage <= 0 ||
+        x < clip->x || x >= clip->x + clip->w ||
+        y < clip->y || y >= clip->y + clip->h) {
+        return;
+    }
+
+    blend_pixel_coverage((Uint8 *)dst->pixels + y * dst->pitch + x * bpp, bpp, dst->fmt, dst->palette,
+                         blend, color.r, color.g, color.b, color.a, coverage);
+}
+
+/* Xiaolin Wu's line algorithm: each step along the major axis splits the pixel
+ * between the two pixels straddling the line on the minor axis.
+ * The end point is not drawn.
+ */
+static void draw_line_aa(SDL_Surface *dst, int x1, int y1, int x2, int y2, SDL_BlendMode blend, SDL_Color color)
+{
+    const SDL_Rect *clip = &dst->clip_rect;
+    const int dx = x2 - x1;
+    const int dy = y2 - y1;
+    const bool x_major = SDL_abs(dx) >= SDL_abs(dy);
+    const int length = x_major ? SDL_abs(dx) : SDL_abs(dy);
+    const int major = x_major ? x1 : y1;
+    const int step = (x_major ? dx : dy) > 0 ? 1 : -1;
+    const int clip_min = x_major ? clip->x : clip->y;
+    const int clip_max = x_major ? (clip->x + clip->w - 1) : (clip->y + clip->h - 1);
+    Sint64 gradient;
+    int i, first, last;
+
+    if (length == 0) {
+        return;
+    }
+
+    // Minor axis position in 16.16 fixed point
+    gradient = ((Sint64)(x_major ? dy : dx) * 65536) / length;
+
+    // Only walk the part of the major axis that is inside the clip rect
+    if (step > 0) {
+        first = SDL_max(0, clip_min - major);
+        last = SDL_min(length - 1, clip_max - major);
+    } else {
+        first = SDL_max(0, major - clip_max);
+        last = SDL_min(length - 1, major - clip_min);
+    }
+
+    for (i = first; i <= last; ++i) {
+        const Sint64 minor = (Sint64)(x_major ? y1 : x1) * 65536 + gradient * i;
+        const int pos = (int)(minor >> 16);
+        const int frac = (int)((minor & 0xFFFF) >> 8);
+        if (x_major) {
+            plot_coverage(dst, major + i * step, pos, blend, color, 255 - frac);
+            plot_coverage(dst, major + i * step, pos + 1, blend, color, frac);
+        } else {
+            plot_coverage(dst, pos, major + i * step, blend, color, 255 - frac);
+            plot_coverage(dst, pos + 1, major + i * step, blend, color, frac);
+        }
+    }
+}
+
+bool SDL_SW_DrawLinesAA(SDL_Surface *dst, const SDL_Point *points, int count, SDL_BlendMode blend, SDL_Color color)
+{
+    int i;
+    bool dst_locked = false;
+
+    if (!SDL_SurfaceValid(dst)) {
+        return SDL_SetError("SDL_SW_DrawLinesAA(): Passed NULL destination surface");
+    }
+    if (count < 1) {
+        return true;
+    }
+
+    if (SDL_MUSTLOCK(dst)) {
+        if (!SDL_LockSurface(dst)) {
+            return false;
+        }
+        dst_locked = true;
+    }
+
+    for (i = 1; i < count; ++i) {
+        draw_line_aa(dst, points[i - 1].x, points[i - 1].y, points[i].x, points[i].y, blend, color);
+    }
+    if (points[0].x != points[count - 1].x || points[0].y != points[count - 1].y) {
+        plot_coverage(dst, points[count - 1].x, points[count - 1].y, blend, color, 255);
+    }
+
+    if (dst_locked) {
+        SDL_UnlockSurface(dst);
+    }
+    return true;
+}
+
 bool SDL_SW_BlitTriangle(
     SDL_Surface *src,
     SDL_Point *s0, SDL_Point *s1, SDL_Point *s2,
@@ -538,7 +1017,7 @@ bool SDL_SW_BlitTriangle(
 
     is_uniform = COLOR_EQ(c0, c1) && COLOR_EQ(c1, c2);
 
-    bounding_rect_fixedpoint(d0, d1, d2, &dstrect);
+    SDL_SW_BoundingRectFixedpoint(d0, d1, d2, &dstrect);
 
     SDL_GetSurfaceBlendMode(src, &blend);
 
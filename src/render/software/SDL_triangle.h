@@ -28,6 +28,16 @@ extern bool SDL_SW_FillTriangle(SDL_Surface *dst,
                                 SDL_Point *d0, SDL_Point *d1, SDL_Point *d2,
                                 SDL_BlendMode blend, SDL_Color c0, SDL_Color c1, SDL_Color c2);
 
+/* Anti-aliased variants. Bit N of 'aa_edges' anti-aliases the edge opposite to vertex N,
+ * edges left out use the regular top-left rule so shared edges within a mesh don't show seams.
+ */
+extern bool SDL_SW_FillTriangleAA(SDL_Surface *dst,
+                                  SDL_Point *d0, SDL_Point *d1, SDL_Point *d2, int aa_edges,
+                                  SDL_BlendMode blend, SDL_Color c0, SDL_Color c1, SDL_Color c2);
+
+extern bool SDL_SW_DrawLinesAA(SDL_Surface *dst, const SDL_Point *points, int count,
+                               SDL_BlendMode blend, SDL_Color color);
+
 extern bool SDL_SW_BlitTriangle(SDL_Surface *src,
                                 SDL_Point *s0, SDL_Point *s1, SDL_Point *s2,
                                 SDL_Surface *dst,
@@ -37,5 +47,6 @@ extern bool SDL_SW_BlitTriangle(SDL_Surface *src,
                                 SDL_TextureAddressMode texture_address_mode_v);
 
 extern void trianglepoint_2_fixedpoint(SDL_Point *a);
+extern void SDL_SW_BoundingRectFixedpoint(const SDL_Point *a, const SDL_Point *b, const SDL_Point *c, SDL_Rect *r);
 
 #endif // SDL_triangle_h_
@@ -19,6 +19,8 @@
   3. This notice may not be removed or altered from any source distribution.
 */
 #include "SDL_internal.h"
+#include "SDL_malloc_c.h"
+#include "../SDL_hints_c.h"
 
 /* This file contains portable memory management functions for SDL */
 
@@ -6454,10 +6456,240 @@ static void * SDLCALL real_calloc(size_t n, size_t s) { return calloc(n, s); }
 static void * SDLCALL real_realloc(void *p, size_t s) { return realloc(p,s); }
 static void   SDLCALL real_free(void *p) { free(p); }
 #else
-#define real_malloc dlmalloc
-#define real_calloc dlcalloc
-#define real_realloc dlrealloc
-#define real_free dlfree
+
+/* Small blocks are cached in front of dlmalloc when SDL_HINT_MALLOC_THREAD_CACHE
+   is enabled, so threads that allocate and free small blocks all the time don't
+   all have to go through dlmalloc's global lock.
+
+   Cached blocks are ordinary dlmalloc chunks that dlmalloc still considers in
+   use, so they can be handed to dlrealloc() and dlfree() like any other block,
+   and a block can be freed by a different thread than the one that allocated it.
+   The size class of a block is read from its chunk header when it is freed.
+
+   Each thread picks a cache with SDL_GetThreadStripe(). A thread that finds its
+   cache busy goes straight to dlmalloc instead of waiting for it.
+
+   The hint can be changed while other threads allocate, so the caches check that
+   they are still enabled after taking their lock. A block can't be pushed into a
+   cache after FlushMallocCache() has emptied it that way.
+*/
+#define SDL_MALLOC_CACHE_STRIPES SDL_NUM_THREAD_STRIPES
+#define SDL_MALLOC_CACHE_MAX_CHUNK 256
+#define SDL_MALLOC_CACHE_CLASSES ((SDL_MALLOC_CACHE_MAX_CHUNK / MALLOC_ALIGNMENT) + 1)
+#define SDL_MALLOC_CACHE_CLASS_BYTES 2048
+#define SDL_MALLOC_CACHE_MAX_BLOCKS (SDL_MALLOC_CACHE_CLASS_BYTES / MIN_CHUNK_SIZE)
+#define SDL_MALLOC_CACHE_BATCH 16
+
+typedef struct SDL_MallocCacheBlock
+{
+    struct SDL_MallocCacheBlock *next;
+} SDL_MallocCacheBlock;
+
+typedef struct SDL_MallocCacheStripe
+{
+    SDL_SpinLock lock;
+    SDL_MallocCacheBlock *blocks[SDL_MALLOC_CACHE_CLASSES];
+    int num_blocks[SDL_MALLOC_CACHE_CLASSES];
+} SDL_MallocCacheStripe;
+
+typedef union SDL_MallocCacheStripePadded
+{
+    SDL_MallocCacheStripe stripe;
+    char padding[SDL_CACHELINE_SIZE * ((sizeof(SDL_MallocCacheStripe) + SDL_CACHELINE_SIZE - 1) / SDL_CACHELINE_SIZE)];
+} SDL_MallocCacheStripePadded;
+
+static SDL_MallocCacheStripePadded SDL_malloc_cache[SDL_MALLOC_CACHE_STRIPES];
+static SDL_AtomicInt SDL_malloc_cache_enabled;
+
+static SDL_INLINE SDL_MallocCacheStripe *GetMallocCacheStripe(void)
+{
+    return &SDL_malloc_cache[SDL_GetThreadStripe()].stripe;
+}
+
+static SDL_INLINE int GetMallocCacheLimit(size_t chunk_size)
+{
+    return (int)(SDL_MALLOC_CACHE_CLASS_BYTES / chunk_size);
+}
+
+// Fill an empty size class with a batch of chunks carved out under a single lock
+static SDL_MallocCacheBlock *RefillMallocCache(SDL_MallocCacheStripe *cache, size_t chunk_size)
+{
+    const size_t size_class = chunk_size / MALLOC_ALIGNMENT;
+    size_t sizes[SDL_MALLOC_CACHE_BATCH];
+    void *chunks[SDL_MALLOC_CACHE_BATCH];
+    int i, count = SDL_min(SDL_MALLOC_CACHE_BATCH, GetMallocCacheLimit(chunk_size));
+
+    for (i = 0; i < count; ++i) {
+        sizes[i] = chunk_size - CHUNK_OVERHEAD;
+    }
+    if (!dlindependent_comalloc(count, sizes, chunks)) {
+        return NULL;
+    }
+
+    // Keep the first one for the caller and cache the rest
+    for (i = 1; i < count; ++i) {
+        SDL_MallocCacheBlock *block = (SDL_MallocCacheBlock *)chunks[i];
+        block->next = cache->blocks[size_class];
+        cache->blocks[size_class] = block;
+    }
+    cache->num_blocks[size_class] += count - 1;
+    return (SDL_MallocCacheBlock *)chunks[0];
+}
+
+// Give up to max_blocks blocks of a size class back to dlmalloc under a single lock
+static void FlushMallocCacheClass(SDL_MallocCacheStripe *cache, size_t size_class, int max_blocks)
+{
+    void *blocks[SDL_MALLOC_CACHE_MAX_BLOCKS];
+    int count = 0;
+
+    while (count < max_blocks && cache->blocks[size_class]) {
+        SDL_MallocCacheBlock *block = cache->blocks[size_class];
+        cache->blocks[size_class] = block->next;
+        blocks[count++] = block;
+    }
+    cache->num_blocks[size_class] -= count;
+    if (count > 0) {
+        dlbulk_free(blocks, count);
+    }
+}
+
+static void FlushMallocCache(void)
+{
+    int i;
+    size_t size_class;
+
+    for (i = 0; i < SDL_MALLOC_CACHE_STRIPES; ++i) {
+        SDL_MallocCacheStripe *cache = &SDL_malloc_cache[i].stripe;
+
+        SDL_LockSpinlock(&cache->lock);
+        for (size_class = 0; size_class < SDL_MALLOC_CACHE_CLASSES; ++size_class) {
+            while (cache->blocks[size_class]) {
+                FlushMallocCacheClass(cache, size_class, SDL_MALLOC_CACHE_MAX_BLOCKS);
+            }
+        }
+        SDL_UnlockSpinlock(&cache->lock);
+    }
+}
+
+static void *SDLCALL real_malloc(size_t s)
+{
+    if (SDL_GetAtomicInt(&SDL_malloc_cache_enabled) && s <= SDL_MALLOC_CACHE_MAX_CHUNK - CHUNK_OVERHEAD) {
+        const size_t chunk_size = request2size(s);
+        const size_t size_class = chunk_size / MALLOC_ALIGNMENT;
+        SDL_MallocCacheStripe *cache = GetMallocCacheStripe();
+
+        if (SDL_TryLockSpinlock(&cache->lock)) {
+            SDL_MallocCacheBlock *block = cache->blocks[size_class];
+            if (block) {
+                cache->blocks[size_class] = block->next;
+                --cache->num_blocks[size_class];
+            } else if (SDL_GetAtomicInt(&SDL_malloc_cache_enabled)) {
+                block = RefillMallocCache(cache, chunk_size);
+            }
+            SDL_UnlockSpinlock(&cache->lock);
+            if (block) {
+                return block;
+            }
+        }
+    }
+    return dlmalloc(s);
+}
+
+static void *SDLCALL real_calloc(size_t n, size_t s)
+{
+    if (SDL_GetAtomicInt(&SDL_malloc_cache_enabled) && n > 0 && s <= (SDL_MALLOC_CACHE_MAX_CHUNK - CHUNK_OVERHEAD) / n) {
+        void *mem = real_malloc(n * s);
+        if (mem) {
+            SDL_memset(mem, 0, n * s);
+        }
+        return mem;
+    }
+    return dlcalloc(n, s);
+}
+
+static void *SDLCALL real_realloc(void *p, size_t s)
+{
+    if (!p) {
+        return real_malloc(s);
+    }
+    return dlrealloc(p, s);
+}
+
+static void SDLCALL real_free(void *p)
+{
+    if (SDL_GetAtomicInt(&SDL_malloc_cache_enabled) && p) {
+        const mchunkptr chunk = mem2chunk(p);
+        const size_t chunk_size = chunksize(chunk);
+
+        if (chunk_size <= SDL_MALLOC_CACHE_MAX_CHUNK && !is_mmapped(chunk)) {
+            const size_t size_class = chunk_size / MALLOC_ALIGNMENT;
+            SDL_MallocCacheStripe *cache = GetMallocCacheStripe();
+
+            if (SDL_TryLockSpinlock(&cache->lock)) {
+                SDL_MallocCacheBlock *block = (SDL_MallocCacheBlock *)p;
+                if (!SDL_GetAtomicInt(&SDL_malloc_cache_enabled)) {
+                    // Disabled since we looked, this cache may already have been flushed
+                    SDL_UnlockSpinlock(&cache->lock);
+                    dlfree(p);
+                    return;
+                }
+                block->next = cache->blocks[size_class];
+                cache->blocks[size_class] = block;
+                if (++cache->num_blocks[size_class] > GetMallocCacheLimit(chunk_size)) {
+                    FlushMallocCacheClass(cache, size_class, cache->num_blocks[size_class] / 2);
+                }
+                SDL_UnlockSpinlock(&cache->lock);
+                return;
+            }
+        }
+    }
+    dlfree(p);
+}
+
+static void SDLCALL SDL_MallocCacheChanged(void *userdata, const char *name, const char *oldValue, const char *hint)
+{
+    const bool enabled = SDL_GetStringBoolean(hint, false);
+
+    if (SDL_SetAtomicInt(&SDL_malloc_cache_enabled, enabled) && !enabled) {
+        FlushMallocCache();
+    }
+}
+
+static SDL_InitState SDL_malloc_cache_init;
+
+void SDL_InitMallocCache(void)
+{
+    if (!SDL_ShouldInit(&SDL_malloc_cache_init)) {
+        return;
+    }
+
+    SDL_AddHintCallback(SDL_HINT_MALLOC_THREAD_CACHE, SDL_MallocCacheChanged, NULL);
+
+    SDL_SetInitialized(&SDL_malloc_cache_init, true);
+}
+
+void SDL_QuitMallocCache(void)
+{
+    if (!SDL_ShouldQuit(&SDL_malloc_cache_init)) {
+        return;
+    }
+
+    SDL_RemoveHintCallback(SDL_HINT_MALLOC_THREAD_CACHE, SDL_MallocCacheChanged, NULL);
+    SDL_SetAtomicInt(&SDL_malloc_cache_enabled, 0);
+    FlushMallocCache();
+
+    SDL_SetInitialized(&SDL_malloc_cache_init, false);
+}
+#endif
+
+#ifndef SDL_MALLOC_CACHE_STRIPES
+void SDL_InitMallocCache(void)
+{
+}
+
+void SDL_QuitMallocCache(void)
+{
+}
 #endif
 
 // mark the allocator entry points as KEEPALIVE so we can call these from JavaScript.
@@ -6623,3 +6855,125 @@ void SDL_free(void *ptr)
     s_mem.free_func(ptr);
     DECREMENT_ALLOCATION_COUNT();
 }
+
+/* Memory that SDL allocates for its own use can be counted under a tag.
+
+   The counters are split into stripes picked with SDL_GetThreadStripe(), so
+   threads allocating at the same time rarely touch the same cache line. A
+   block freed by another thread than the one that allocated it makes the live
+   counts of a stripe go negative, which is fine since only the sum over all
+   the stripes means anything.
+*/
+#define SDL_MEMORY_STATS_STRIPES SDL_NUM_THREAD_STRIPES
+
+typedef struct SDL_MemoryStatsStripe
+{
+    SDL_SpinLock lock;
+    Sint64 live_bytes[SDL_MEMORY_TAG_COUNT];
+    Sint64 live_allocations[SDL_MEMORY_TAG_COUNT];
+    Uint64 total_bytes[SDL_MEMORY_TAG_COUNT];
+    Uint64 total_allocations[SDL_MEMORY_TAG_COUNT];
+} SDL_MemoryStatsStripe;
+
+typedef union SDL_MemoryStatsStripePadded
+{
+    SDL_MemoryStatsStripe stripe;
+    char padding[SDL_CACHELINE_SIZE * ((sizeof(SDL_MemoryStatsStripe) + SDL_CACHELINE_SIZE - 1) / SDL_CACHELINE_SIZE)];
+} SDL_MemoryStatsStripePadded;
+
+static SDL_MemoryStatsStripePadded SDL_memory_stats[SDL_MEMORY_STATS_STRIPES];
+
+static SDL_INLINE SDL_MemoryStatsStripe *GetMemoryStatsStripe(void)
+{
+    return &SDL_memory_stats[SDL_GetThreadStripe()].stripe;
+}
+
+void SDL_TrackMemory(SDL_MemoryTag tag, size_t size)
+{
+    SDL_MemoryStatsStripe *stats = GetMemoryStatsStripe();
+
+    SDL_LockSpinlock(&stats->lock);
+    stats->live_bytes[tag] += size;
+    ++stats->live_allocations[tag];
+    stats->total_bytes[tag] += size;
+    ++stats->total_allocations[tag];
+    SDL_UnlockSpinlock(&stats->lock);
+}
+
+void SDL_UntrackMemory(SDL_MemoryTag tag, size_t size)
+{
+    SDL_MemoryStatsStripe *stats = GetMemoryStatsStripe();
+
+    SDL_LockSpinlock(&stats->lock);
+    stats->live_bytes[tag] -= size;
+    --stats->live_allocations[tag];
+    SDL_UnlockSpinlock(&stats->lock);
+}
+
+void *SDL_malloc_tagged(SDL_MemoryTag tag, size_t size)
+{
+    void *mem = SDL_malloc(size);
+    if (mem) {
+        SDL_TrackMemory(tag, size);
+    }
+    return mem;
+}
+
+void *SDL_calloc_tagged(SDL_MemoryTag tag, size_t nmemb, size_t size)
+{
+    void *mem = SDL_calloc(nmemb, size);
+    if (mem) {
+        SDL_TrackMemory(tag, nmemb * size);
+    }
+    return mem;
+}
+
+void *SDL_realloc_tagged(SDL_MemoryTag tag, void *mem, size_t old_size, size_t size)
+{
+    void *result = SDL_realloc(mem, size);
+    if (result) {
+        if (mem) {
+            SDL_UntrackMemory(tag, old_size);
+        }
+        SDL_TrackMemory(tag, size);
+    }
+    return result;
+}
+
+void SDL_free_tagged(SDL_MemoryTag tag, void *mem, size_t size)
+{
+    if (mem) {
+        SDL_free(mem);
+        SDL_UntrackMemory(tag, size);
+    }
+}
+
+bool SDL_GetMemoryStats(SDL_MemoryTag tag, SDL_MemoryStats *stats)
+{
+    Sint64 live_bytes = 0, live_allocations = 0;
+    int i;
+
+    CHECK_PARAM((int)tag < 0 || tag >= SDL_MEMORY_TAG_COUNT) {
+        return SDL_InvalidParamError("tag");
+    }
+    CHECK_PARAM(!stats) {
+        return SDL_InvalidParamError("stats");
+    }
+
+    SDL_zerop(stats);
+    for (i = 0; i < SDL_MEMORY_STATS_STRIPES; ++i) {
+        SDL_MemoryStatsStripe *stripe = &SDL_memory_stats[i].stripe;
+
+        SDL_LockSpinlock(&stripe->lock);
+        live_bytes += stripe->live_bytes[tag];
+        live_allocations += stripe->live_allocations[tag];
+        stats->total_bytes += stripe->total_bytes[tag];
+        stats->total_allocations += stripe->total_allocations[tag];
+        SDL_UnlockSpinlock(&stripe->lock);
+    }
+
+    // A block freed while we were adding up the stripes may have been counted as freed but not as allocated
+    stats->live_bytes = (Uint64)SDL_max(live_bytes, 0);
+    stats->live_allocations = (Uint64)SDL_max(live_allocations, 0);
+    return true;
+}
@@ -0,0 +1,35 @@
+/*
+  Simple DirectMedia Layer
+  Copyright (C) 1997-2026 Sam Lantinga <slouken@libsdl.org>
+
+  This software is provided 'as-is', without any express or implied
+  warranty.  In no event will the authors be held liable for any damages
+  arising from the use of this software.
+
+  Permission is granted to anyone to use this software for any purpose,
+  including commercial applications, and to alter it and redistribute it
+  freely, subject to the following restrictions:
+
+  1. The origin of this software must not be misrepresented; you must not
+     claim that you wrote the original software. If you use this software
+     in a product, an acknowledgment in the product documentation would be
+     appreciated but is not required.
+  2. Altered source versions must be plainly marked as such, and must not be
+     misrepresented as being the original software.
+  3. This notice may not be removed or altered from any source distribution.
+*/
+#include "SDL_internal.h"
+
+extern void SDL_InitMallocCache(void);
+extern void SDL_QuitMallocCache(void);
+
+// Counts memory SDL allocates for its own use under a tag, see SDL_GetMemoryStats()
+extern void SDL_TrackMemory(SDL_MemoryTag tag, size_t size);
+extern void SDL_UntrackMemory(SDL_MemoryTag tag, size_t size);
+
+// These allocate and free memory like SDL_malloc() and friends, counting it under a tag.
+// Memory from these functions must be freed with SDL_free_tagged(), passing the size it was allocated with.
+extern void *SDL_malloc_tagged(SDL_MemoryTag tag, size_t size);
+extern void *SDL_calloc_tagged(SDL_MemoryTag tag, size_t nmemb, size_t size);
+extern void *SDL_realloc_tagged(SDL_MemoryTag tag, void *mem, size_t old_size, size_t size);
+extern void SDL_free_tagged(SDL_MemoryTag tag, void *mem, size_t size);
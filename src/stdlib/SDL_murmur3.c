@@ -85,3 +85,102 @@ Uint32 SDLCALL SDL_murmur3_32(const void *data, size_t len, Uint32 seed)
 
     return hash;
 }
+
+// Public domain murmur3 x64 128-bit hash algorithm, of which we return the first 64 bits
+//
+// Adapted from: https://github.com/aappleby/smhasher/blob/master/src/MurmurHash3.cpp
+
+static SDL_INLINE Uint64 murmur_64_rotl(Uint64 x, int r)
+{
+    return (x << r) | (x >> (64 - r));
+}
+
+static SDL_INLINE Uint64 murmur_64_fmix(Uint64 k)
+{
+    k ^= k >> 33;
+    k *= 0xff51afd7ed558ccdULL;
+    k ^= k >> 33;
+    k *= 0xc4ceb9fe1a85ec53ULL;
+    k ^= k >> 33;
+    return k;
+}
+
+static SDL_INLINE Uint64 murmur_64_read(const Uint8 *bytes)
+{
+    Uint64 k;
+    SDL_memcpy(&k, bytes, sizeof(k));
+    return SDL_Swap64LE(k);
+}
+
+Uint64 SDLCALL SDL_murmur3_64(const void *data, size_t len, Uint64 seed)
+{
+    const Uint64 c1 = 0x87c37b91114253d5ULL;
+    const Uint64 c2 = 0x4cf5ad432745937fULL;
+    const Uint8 *bytes = (const Uint8 *)data;
+    Uint64 h1 = seed;
+    Uint64 h2 = seed;
+    Uint64 k1, k2;
+
+    // Read in groups of 16.
+    for (size_t i = len >> 4; i--; ) {
+        k1 = murmur_64_read(bytes);
+        k2 = murmur_64_read(bytes + 8);
+        bytes += 16;
+
+        k1 *= c1;
+        k1 = murmur_64_rotl(k1, 31);
+        k1 *= c2;
+        h1 ^= k1;
+        h1 = murmur_64_rotl(h1, 27);
+        h1 += h2;
+        h1 = h1 * 5 + 0x52dce729;
+
+        k2 *= c2;
+        k2 = murmur_64_rotl(k2, 33);
+        k2 *= c1;
+        h2 ^= k2;
+        h2 = murmur_64_rotl(h2, 31);
+        h2 += h1;
+        h2 = h2 * 5 + 0x38495ab5;
+    }
+
+    // Read the rest, one word at a time where we can.
+    size_t left = (len & 15);
+    if (left > 8) {
+        k2 = 0;
+        for (size_t i = left; i-- > 8; ) {
+            k2 <<= 8;
+            k2 |= bytes[i];
+        }
+        k2 *= c2;
+        k2 = murmur_64_rotl(k2, 33);
+        k2 *= c1;
+        h2 ^= k2;
+    }
+    if (left) {
+        if (left >= 8) {
+            k1 = murmur_64_read(bytes);
+        } else {
+            k1 = 0;
+            for (size_t i = left; i--; ) {
+                k1 <<= 8;
+                k1 |= bytes[i];
+            }
+        }
+        k1 *= c1;
+        k1 = murmur_64_rotl(k1, 31);
+        k1 *= c2;
+        h1 ^= k1;
+    }
+
+    /* Finalize. */
+    h1 ^= len;
+    h2 ^= len;
+    h1 += h2;
+    h2 += h1;
+    h1 = murmur_64_fmix(h1);
+    h2 = murmur_64_fmix(h2);
+    h1 += h2;
+
+    return h1;
+}
@@ -181,15 +181,19 @@ static char _ID[]="<qsort.c gjm WITH CHANGES FOR SDL3 1.16 2021-02-20>";
  */
 #define PIVOT_THRESHOLD 40
 
-typedef struct { char * first; char * last; } stack_entry;
-#define pushLeft {stack[stacktop].first=ffirst;stack[stacktop++].last=last;}
-#define pushRight {stack[stacktop].first=first;stack[stacktop++].last=llast;}
+/* BEGIN SDL CHANGE ... each stack entry remembers how many more times
+ * it may be partitioned before we give up and heapsort it. */
+typedef struct { char * first; char * last; int depth; } stack_entry;
+#define pushLeft {stack[stacktop].first=ffirst;stack[stacktop].last=last;stack[stacktop++].depth=depth;}
+#define pushRight {stack[stacktop].first=first;stack[stacktop].last=llast;stack[stacktop++].depth=depth;}
 #define doLeft {first=ffirst;llast=last;continue;}
 #define doRight {ffirst=first;last=llast;continue;}
 #define pop {if (--stacktop<0) break;\
   first=ffirst=stack[stacktop].first;\
   last=llast=stack[stacktop].last;\
+  depth=stack[stacktop].depth;\
   continue;}
+/* END SDL CHANGE ... each stack entry remembers its depth limit. */
 
 /* Some comments on the implementation.
  * 1. When we finish partitioning the array into "low"
@@ -257,6 +261,22 @@ typedef struct { char * first; char * last; } stack_entry;
  *        16-bit |int|s and 4096-bit |size_t|s. :-)
  */
 
+/* BEGIN SDL CHANGE ... introsort.
+ * Point 5 above notwithstanding, callers sort data they don't control
+ * (and McIlroy's "killer adversary" defeats any pivot selection), so
+ * we bound the work the way introsort does: every subarray starts
+ * with a budget of 2*log2(nmemb) partitioning steps, and a subarray
+ * that runs out of budget is heapsorted in place instead. Heapsorting
+ * leaves it in its final position, so the closing insertion sort
+ * (and its sentinel) are unaffected.
+ * END SDL CHANGE ... introsort.
+ */
+#define Introsort(sz)				\
+  if (depth--<=0) {				\
+    heapsort_r(first,last,sz,compare,userdata);	\
+    pop						\
+  }
+
 /* The recursion logic is the same in each case.
  * We keep chopping up until we reach subarrays of size
  * strictly less than Trunc; we leave these unsorted. */
@@ -401,11 +421,47 @@ fprintf(stderr,"-> %d %d %d @ %p %p %p\n",*(int*)m1,*(int*)m2,*(int*)m3, m1,m2,m
 
 /* ---------------------------------------------------------------------- */
 
+/* BEGIN SDL CHANGE ... heapsort fallback for introsort. */
+static int depth_limit(size_t nmemb) {
+  int depth=0;
+  while (nmemb>1) { depth+=2; nmemb>>=1; }
+  return depth;
+}
+
+static void sift_down(char *base, size_t root, size_t n, size_t size,
+                      int (SDLCALL *compare)(void *, const void *, const void *), void *userdata) {
+  size_t child;
+  while ((child=2*root+1)<n) {
+    char *r=base+root*size, *c=base+child*size;
+    if (child+1<n && compare(userdata,c,c+size)<0) { c+=size; ++child; }
+    if (compare(userdata,r,c)>=0) break;
+    SWAP_nonaligned(r,c);
+    root=child;
+  }
+}
+
+/* Note: last is inclusive. */
+static void heapsort_r(char *first, char *last, size_t size,
+                       int (SDLCALL *compare)(void *, const void *, const void *), void *userdata) {
+  size_t n=(size_t)(last-first)/size+1;
+  size_t i;
+  for (i=n/2;i>0;--i) sift_down(first,i-1,n,size,compare,userdata);
+  for (i=n-1;i>0;--i) {
+    char *end=first+i*size;
+    SWAP_nonaligned(first,end);
+    sift_down(first,0,i,size,compare,userdata);
+  }
+}
+/* END SDL CHANGE ... heapsort fallback for introsort. */
+
+/* ---------------------------------------------------------------------- */
+
 static void qsort_r_nonaligned(void *base, size_t nmemb, size_t size,
            int (SDLCALL *compare)(void *, const void *, const void *), void *userdata) {
 
   stack_entry stack[STACK_SIZE];
   int stacktop=0;
+  int depth=depth_limit(nmemb);
   char *first,*last;
   char *pivot=malloc(size);
   size_t trunc=TRUNC_nonaligned*size;
@@ -416,6 +472,7 @@ static void qsort_r_nonaligned(void *base, size_t nmemb, size_t size,
   if ((size_t)(last-first)>=trunc) {
     char *ffirst=first, *llast=last;
     while (1) {
+      Introsort(size);
       /* Select pivot */
       { char * mid=first+size*((last-first)/size >> 1);
         if (mid>=last) break;
@@ -438,6 +495,7 @@ static void qsort_r_aligned(void *base, size_t nmemb, size_t size,
 
   stack_entry stack[STACK_SIZE];
   int stacktop=0;
+  int depth=depth_limit(nmemb);
   char *first,*last;
   char *pivot=malloc(size);
   size_t trunc=TRUNC_aligned*size;
@@ -448,6 +506,7 @@ static void qsort_r_aligned(void *base, size_t nmemb, size_t size,
   if ((size_t)(last-first)>=trunc) {
     char *ffirst=first,*llast=last;
     while (1) {
+      Introsort(size);
       /* Select pivot */
       { char * mid=first+size*((last-first)/size >> 1);
         if (mid>=last) break;
@@ -470,6 +529,7 @@ static void qsort_r_words(void *base, size_t nmemb,
 
   stack_entry stack[STACK_SIZE];
   int stacktop=0;
+  int depth=depth_limit(nmemb);
   char *first,*last;
   char *pivot=malloc(WORD_BYTES);
   assert(pivot != NULL);
@@ -484,6 +544,7 @@ fprintf(stderr,"Doing %d:%d: ",
         (first-(char*)base)/WORD_BYTES,
         (last-(char*)base)/WORD_BYTES);
 #endif
+      Introsort(WORD_BYTES);
       /* Select pivot */
       { char * mid=first+WORD_BYTES*((last-first) / (2*WORD_BYTES));
         if (mid>=last) break;
@@ -574,3 +635,295 @@ void *SDL_bsearch(const void *key, const void *base, size_t nmemb, size_t size,
     // qsort_non_r_bridge just happens to match calling conventions, so reuse it.
     return SDL_bsearch_r(key, base, nmemb, size, qsort_non_r_bridge, compare);
 }
+
+// The code below uses SDL_memcpy() directly, which may itself be memcpy()
+#undef memcpy
+
+// SDL_SortByKey() is an LSD radix sort. The keys are first converted to
+// unsigned integers that order the same way as the original values, and
+// sorted along with the index of their element, one byte per pass. Passes
+// where every key has the same byte are skipped, so 32-bit keys only take
+// four passes and keys with a small range take fewer. The elements
+// themselves are only moved once, at the end.
+
+typedef struct SDL_SortKey
+{
+    Uint64 key;
+    size_t index;
+} SDL_SortKey;
+
+static Uint64 LoadSortKey(const Uint8 *data, SDL_SortKeyType key_type)
+{
+    switch (key_type) {
+    case SDL_SORTKEY_UINT32:
+    case SDL_SORTKEY_SINT32:
+    case SDL_SORTKEY_FLOAT:
+    {
+        Uint32 key;
+        SDL_memcpy(&key, data, sizeof(key));
+        if (key_type == SDL_SORTKEY_SINT32) {
+            key ^= 0x80000000u;
+        } else if (key_type == SDL_SORTKEY_FLOAT) {
+            // Negative values order backwards, so flip all their bits
+            key = (key & 0x80000000u) ? ~key : (key | 0x80000000u);
+        }
+        return key;
+    }
+    default:
+    {
+        Uint64 key;
+        SDL_memcpy(&key, data, sizeof(key));
+        if (key_type == SDL_SORTKEY_SINT64) {
+            key ^= SDL_UINT64_C(0x8000000000000000);
+        } else if (key_type == SDL_SORTKEY_DOUBLE) {
+            key = (key & SDL_UINT64_C(0x8000000000000000)) ? ~key : (key | SDL_UINT64_C(0x8000000000000000));
+        }
+        return key;
+    }
+    }
+}
+
+bool SDL_SortByKey(void *base, size_t nmemb, size_t size, size_t key_offset, SDL_SortKeyType key_type)
+{
+    size_t key_size, key_end;
+    size_t counts_size, keys_size, elements_size, total_size;
+    size_t (*counts)[256];
+    SDL_SortKey *keys, *sorted;
+    Uint8 *memory, *elements;
+    Uint8 *data = (Uint8 *)base;
+    size_t i;
+    int passes, pass;
+
+    switch (key_type) {
+    case SDL_SORTKEY_UINT32:
+    case SDL_SORTKEY_SINT32:
+    case SDL_SORTKEY_FLOAT:
+        key_size = sizeof(Uint32);
+        break;
+    case SDL_SORTKEY_UINT64:
+    case SDL_SORTKEY_SINT64:
+    case SDL_SORTKEY_DOUBLE:
+        key_size = sizeof(Uint64);
+        break;
+    default:
+        return SDL_InvalidParamError("key_type");
+    }
+
+    CHECK_PARAM(!base && nmemb > 0) {
+        return SDL_InvalidParamError("base");
+    }
+    CHECK_PARAM(!SDL_size_add_check_overflow(key_offset, key_size, &key_end) || key_end > size) {
+        return SDL_InvalidParamError("key_offset");
+    }
+
+    if (nmemb <= 1) {
+        return true;
+    }
+
+    passes = (int)key_size;
+    counts_size = passes * sizeof(*counts);
+    if (!SDL_size_mul_check_overflow(nmemb, sizeof(*keys), &keys_size) ||
+        !SDL_size_mul_check_overflow(nmemb, size, &elements_size) ||
+        !SDL_size_add_check_overflow(counts_size, keys_size, &total_size) ||
+        !SDL_size_add_check_overflow(total_size, keys_size, &total_size) ||
+        !SDL_size_add_check_overflow(total_size, elements_size, &total_size)) {
+        return SDL_OutOfMemory();
+    }
+    memory = (Uint8 *)SDL_malloc(total_size);
+    if (!memory) {
+        return false;
+    }
+    counts = (size_t (*)[256])memory;
+    keys = (SDL_SortKey *)(memory + counts_size);
+    sorted = keys + nmemb;
+    elements = (Uint8 *)(sorted + nmemb);
+
+    SDL_memset(counts, 0, counts_size);
+    for (i = 0; i < nmemb; ++i) {
+        const Uint64 key = LoadSortKey(data + i * size + key_offset, key_type);
+        keys[i].key = key;
+        keys[i].index = i;
+        for (pass = 0; pass < passes; ++pass) {
+            ++counts[pass][(key >> (pass * 8)) & 0xFF];
+        }
+    }
+
+    for (pass = 0; pass < passes; ++pass) {
+        size_t *count = counts[pass];
+        const int shift = pass * 8;
+        size_t offset = 0;
+        SDL_SortKey *swap;
+        int digit;
+
+        if (count[(keys[0].key >> shift) & 0xFF] == nmemb) {
+            continue;  // every key has the same byte here, nothing to do
+        }
+
+        for (digit = 0; digit < 256; ++digit) {
+            const size_t n = count[digit];
+            count[digit] = offset;
+            offset += n;
+        }
+        for (i = 0; i < nmemb; ++i) {
+            sorted[count[(keys[i].key >> shift) & 0xFF]++] = keys[i];
+        }
+        swap = keys;
+        keys = sorted;
+        sorted = swap;
+    }
+
+    for (i = 0; i < nmemb; ++i) {
+        SDL_memcpy(elements + i * size, data + keys[i].index * size, size);
+    }
+    SDL_memcpy(data, elements, elements_size);
+
+    SDL_free(memory);
+    return true;
+}
+
+// SDL_ParallelSort() splits the array into one run per thread, sorts the
+// runs with SDL_qsort_r(), then merges pairs of runs into a second buffer
+// and back until a single run is left. The merges in each round run on
+// separate threads as well.
+
+// Below this many elements per thread, starting threads costs more than it saves
+#define SDL_PARALLEL_SORT_MIN_RUN   16384
+#define SDL_PARALLEL_SORT_MAX_RUNS  64
+
+typedef struct SDL_SortTask
+{
+    const Uint8 *src;   // the runs to merge, or NULL to sort dst in place
+    Uint8 *dst;
+    size_t size;
+    size_t start;
+    size_t middle;
+    size_t end;
+    SDL_CompareCallback_r compare;
+    void *userdata;
+    SDL_Thread *thread;
+} SDL_SortTask;
+
+static void MergeRuns(const SDL_SortTask *task)
+{
+    const size_t size = task->size;
+    const Uint8 *a = task->src + task->start * size;
+    const Uint8 *a_end = task->src + task->middle * size;
+    const Uint8 *b = a_end;
+    const Uint8 *b_end = task->src + task->end * size;
+    Uint8 *out = task->dst + task->start * size;
+
+    while (a < a_end && b < b_end) {
+        if (task->compare(task->userdata, b, a) < 0) {
+            SDL_memcpy(out, b, size);
+            b += size;
+        } else {
+            SDL_memcpy(out, a, size);
+            a += size;
+        }
+        out += size;
+    }
+    SDL_memcpy(out, a, (size_t)(a_end - a));
+    out += (a_end - a);
+    SDL_memcpy(out, b, (size_t)(b_end - b));
+}
+
+static int SDLCALL SortTaskThread(void *data)
+{
+    const SDL_SortTask *task = (const SDL_SortTask *)data;
+
+    if (task->src) {
+        MergeRuns(task);
+    } else {
+        SDL_qsort_r(task->dst + task->start * task->size, task->end - task->start, task->size, task->compare, task->userdata);
+    }
+    return 0;
+}
+
+static void RunSortTasks(SDL_SortTask *tasks, int num_tasks)
+{
+    int i;
+
+    // The calling thread takes the first task, and any task a thread can't be created for
+    for (i = 1; i < num_tasks; ++i) {
+        tasks[i].thread = SDL_CreateThread(SortTaskThread, "SDLSort", &tasks[i]);
+    }
+    SortTaskThread(&tasks[0]);
+    for (i = 1; i < num_tasks; ++i) {
+        if (tasks[i].thread) {
+            SDL_WaitThread(tasks[i].thread, NULL);
+            tasks[i].thread = NULL;
+        } else {
+            SortTaskThread(&tasks[i]);
+        }
+    }
+}
+
+void SDL_ParallelSort(void *base, size_t nmemb, size_t size, SDL_CompareCallback_r compare, void *userdata, int num_threads)
+{
+    SDL_SortTask tasks[SDL_PARALLEL_SORT_MAX_RUNS];
+    size_t bounds[SDL_PARALLEL_SORT_MAX_RUNS + 1];
+    size_t buffer_size;
+    Uint8 *buffer, *src, *dst;
+    int num_runs, i;
+
+#ifdef SDL_THREADS_DISABLED
+    num_threads = 1;
+#else
+    if (num_threads <= 0) {
+        num_threads = SDL_GetNumLogicalCPUCores();
+    }
+#endif
+    num_runs = (int)SDL_min((size_t)SDL_clamp(num_threads, 1, SDL_PARALLEL_SORT_MAX_RUNS), nmemb / SDL_PARALLEL_SORT_MIN_RUN);
+    if (num_runs <= 1 ||
+        !SDL_size_mul_check_overflow(nmemb, size, &buffer_size) ||
+        (buffer = (Uint8 *)SDL_malloc(buffer_size)) == NULL) {
+        SDL_qsort_r(base, nmemb, size, compare, userdata);
+        return;
+    }
+
+    SDL_zeroa(tasks);
+    for (i = 0; i <= num_runs; ++i) {
+        bounds[i] = (nmemb / num_runs) * i + (nmemb % num_runs) * i / num_runs;
+    }
+    for (i = 0; i < num_runs; ++i) {
+        tasks[i].dst = (Uint8 *)base;
+        tasks[i].size = size;
+        tasks[i].start = bounds[i];
+        tasks[i].end = bounds[i + 1];
+        tasks[i].compare = compare;
+        tasks[i].userdata = userdata;
+    }
+    RunSortTasks(tasks, num_runs);
+
+    src = (Uint8 *)base;
+    dst = buffer;
+    while (num_runs > 1) {
+        int num_tasks = 0;
+        Uint8 *swap;
+
+        for (i = 0; i < num_runs; i += 2) {
+            SDL_SortTask *task = &tasks[num_tasks++];
+            task->src = src;
+            task->dst = dst;
+            task->start = bounds[i];
+            task->middle = bounds[i + 1];
+            // An odd run out is merged with nothing, which copies it across
+            task->end = (i + 1 < num_runs) ? bounds[i + 2] : bounds[i + 1];
+        }
+        RunSortTasks(tasks, num_tasks);
+
+        for (i = 0; i < num_tasks; ++i) {
+            bounds[i] = bounds[i * 2];
+        }
+        bounds[num_tasks] = bounds[num_runs];
+        num_runs = num_tasks;
+
+        swap = src;
+        src = dst;
+        dst = swap;
+    }
+    if (src != (Uint8 *)base) {
+        SDL_memcpy(base, src, buffer_size);
+    }
+    SDL_free(buffer);
+}
@@ -46,6 +46,9 @@ static const char *common_usage[] = {
     "[--no-time]",
     "[--info all|video|modes|render|event|event_motion]",
     "[--log all|error|system|audio|video|render|input]",
+    "[--record-events file]",
+    "[--replay-events file]",
+    "[--replay-speed N]",
     NULL
 };
 
@@ -214,6 +217,30 @@ static int SDLCALL SDLTest_CommonStateParseCommonArguments(void *data, char **ar
             return 2;
         }
         return -1;
+    } else if (SDL_strcasecmp(argv[index], "--record-events") == 0) {
+        ++index;
+        if (!argv[index]) {
+            return -1;
+        }
+        state->record_events_file = argv[index];
+        return 2;
+    } else if (SDL_strcasecmp(argv[index], "--replay-events") == 0) {
+        ++index;
+        if (!argv[index]) {
+            return -1;
+        }
+        state->replay_events_file = argv[index];
+        return 2;
+    } else if (SDL_strcasecmp(argv[index], "--replay-speed") == 0) {
+        ++index;
+        if (!argv[index]) {
+            return -1;
+        }
+        state->replay_speed = (float)SDL_atof(argv[index]);
+        if (state->replay_speed <= 0.0f) {
+            return -1;
+        }
+        return 2;
     } else if (SDL_strcmp(argv[index], "-NSDocumentRevisionsDebugMode") == 0) {
         /* Debug flag sent by Xcode */
         return 2;
@@ -662,6 +689,7 @@ SDLTest_CommonState *SDLTest_CommonCreateState(char **argv, SDL_InitFlags flags)
     state->audio_freq = 22050;
     state->audio_format = SDL_AUDIO_S16;
     state->audio_channels = 2;
+    state->replay_speed = 1.0f;
 
     /* Set some very sane GL defaults */
     state->gl_red_size = 8;
@@ -1500,6 +1528,30 @@ bool SDLTest_CommonInit(SDLTest_CommonState *state)
         state->quit_after_ms_timer = SDL_AddTimer(state->quit_after_ms_interval, quit_after_ms_cb, NULL);
     }
 
+    /* Start these last, so the events of setting up the windows aren't doubled up */
+    if (state->record_events_file) {
+        SDL_IOStream *dst = SDL_IOFromFile(state->record_events_file, "wb");
+        if (!dst || !SDLTest_StartEventRecording(dst, true)) {
+            SDL_Log("Couldn't record events to %s: %s", state->record_events_file, SDL_GetError());
+            if (dst) {
+                SDL_CloseIO(dst);
+            }
+            state->record_events_file = NULL;
+            return false;
+        }
+    }
+    if (state->replay_events_file) {
+        SDL_IOStream *src = SDL_IOFromFile(state->replay_events_file, "rb");
+        if (!src || !SDLTest_StartEventReplay(src, true, state->replay_speed)) {
+            SDL_Log("Couldn't replay events from %s: %s", state->replay_events_file, SDL_GetError());
+            if (src) {
+                SDL_CloseIO(src);
+            }
+            state->replay_events_file = NULL;
+            return false;
+        }
+    }
+
     return true;
 }
 
@@ -2723,6 +2775,13 @@ void SDLTest_CommonQuit(SDLTest_CommonState *state)
     if (state) {
         int i;
 
+        if (state->replay_events_file) {
+            SDLTest_StopEventReplay();
+        }
+        if (state->record_events_file && !SDLTest_StopEventRecording()) {
+            SDL_Log("Couldn't record events to %s: %s", state->record_events_file, SDL_GetError());
+        }
+
         if (state->targets) {
             for (i = 0; i < state->num_windows; ++i) {
                 if (state->targets[i]) {
@@ -0,0 +1,548 @@
+/*
+  Simple DirectMedia Layer
+  Copyright (C) 1997-2026 Sam Lantinga <slouken@libsdl.org>
+
+  This software is provided 'as-is', without any express or implied
+  warranty.  In no event will the authors be held liable for any damages
+  arising from the use of this software.
+
+  Permission is granted to anyone to use this software for any purpose,
+  including commercial applications, and to alter it and redistribute it
+  freely, subject to the following restrictions:
+
+  1. The origin of this software must not be misrepresented; you must not
+     claim that you wrote the original software. If you use this software
+     in a product, an acknowledgment in the product documentation would be
+     appreciated but is not required.
+  2. Altered source versions must be plainly marked as such, and must not be
+     misrepresented as being the original software.
+  3. This notice may not be removed or altered from any source distribution.
+*/
+
+/*
+
+ Used to record and replay input sessions.
+
+ A recording starts with a header: the magic bytes "SDLEVREC", then the
+ format version and the size of SDL_Event as 32-bit little endian values.
+ Each event follows as a 64-bit time in nanoseconds since the start of the
+ recording, a 32-bit count of strings, the raw SDL_Event with its pointers
+ cleared, then the strings, each one a 32-bit length followed by that many
+ bytes, or a length of 0xFFFFFFFF for NULL.
+
+*/
+#include <SDL3/SDL_test.h>
+
+#define EVENT_RECORDING_MAGIC       "SDLEVREC"
+#define EVENT_RECORDING_VERSION     1
+#define EVENT_RECORDING_NULL_STRING 0xFFFFFFFF
+#define EVENT_RECORDING_FLUSH_SIZE  (64 * 1024)
+
+typedef struct EventRecorder
+{
+    SDL_Mutex *lock; /* the event watch can run on any thread, events are recorded one at a time */
+    SDL_IOStream *dst;
+    bool closeio;
+    Uint64 start;
+    Uint8 *buffer;
+    size_t buffer_used;
+    size_t buffer_size;
+    bool failed;
+} EventRecorder;
+
+/* The strings of a replayed event, in one block that is freed once the event has been consumed */
+typedef struct EventReplayStrings
+{
+    struct EventReplayStrings *next;
+    size_t size;
+    Uint32 type;
+} EventReplayStrings;
+
+typedef struct EventReplay
+{
+    SDL_IOStream *src;
+    bool closeio;
+    double speed;
+    SDL_Thread *thread;
+    SDL_Semaphore *stop;
+    SDL_AtomicInt done;
+    EventReplayStrings *strings; /* oldest first */
+    EventReplayStrings *strings_tail;
+} EventReplay;
+
+static EventRecorder *recorder;
+static EventReplay *replay;
+
+/* Get the strings attached to an event, pointing 'strings' at either the event's own array or 'storage' */
+static int GetEventStrings(const SDL_Event *event, const char *const **strings, const char *storage[2])
+{
+    switch (event->type) {
+    case SDL_EVENT_TEXT_EDITING:
+        storage[0] = event->edit.text;
+        *strings = storage;
+        return 1;
+    case SDL_EVENT_TEXT_EDITING_CANDIDATES:
+        *strings = event->edit_candidates.candidates;
+        return *strings ? event->edit_candidates.num_candidates : 0;
+    case SDL_EVENT_TEXT_INPUT:
+        storage[0] = event->text.text;
+        *strings = storage;
+        return 1;
+    case SDL_EVENT_DROP_BEGIN:
+    case SDL_EVENT_DROP_FILE:
+    case SDL_EVENT_DROP_TEXT:
+    case SDL_EVENT_DROP_COMPLETE:
+    case SDL_EVENT_DROP_POSITION:
+        storage[0] = event->drop.source;
+        storage[1] = event->drop.data;
+        *strings = storage;
+        return 2;
+    case SDL_EVENT_CLIPBOARD_UPDATE:
+        *strings = (const char *const *)event->clipboard.mime_types;
+        return *strings ? event->clipboard.num_mime_types : 0;
+    case SDL_EVENT_NOTIFICATION_ACTION_INVOKED:
+        storage[0] = event->notification.action_id;
+        *strings = storage;
+        return 1;
+    default:
+        *strings = NULL;
+        return 0;
+    }
+}
+
+/* Point an event at its strings again, or clear its pointers if 'strings' is NULL */
+static void SetEventStrings(SDL_Event *event, char **strings)
+{
+    switch (event->type) {
+    case SDL_EVENT_TEXT_EDITING:
+        event->edit.text = strings ? strings[0] : NULL;
+        break;
+    case SDL_EVENT_TEXT_EDITING_CANDIDATES:
+        event->edit_candidates.candidates = (const char *const *)strings;
+        break;
+    case SDL_EVENT_TEXT_INPUT:
+        event->text.text = strings ? strings[0] : NULL;
+        break;
+    case SDL_EVENT_DROP_BEGIN:
+    case SDL_EVENT_DROP_FILE:
+    case SDL_EVENT_DROP_TEXT:
+    case SDL_EVENT_DROP_COMPLETE:
+    case SDL_EVENT_DROP_POSITION:
+        event->drop.source = strings ? strings[0] : NULL;
+        event->drop.data = strings ? strings[1] : NULL;
+        break;
+    case SDL_EVENT_CLIPBOARD_UPDATE:
+        event->clipboard.mime_types = (const char **)strings;
+        break;
+    case SDL_EVENT_NOTIFICATION_ACTION_INVOKED:
+        event->notification.action_id = strings ? strings[0] : NULL;
+        break;
+    default:
+        if (event->type >= SDL_EVENT_USER) {
+            /* Whatever these pointed to is long gone */
+            event->user.data1 = NULL;
+            event->user.data2 = NULL;
+        }
+        break;
+    }
+}
+
+static bool AppendRecordData(EventRecorder *rec, const void *data, size_t size)
+{
+    if (rec->buffer_used + size > rec->buffer_size) {
+        size_t new_size = SDL_max(rec->buffer_size * 2, EVENT_RECORDING_FLUSH_SIZE);
+        Uint8 *buffer;
+
+        while (new_size < rec->buffer_used + size) {
+            new_size *= 2;
+        }
+        buffer = (Uint8 *)SDL_realloc(rec->buffer, new_size);
+        if (!buffer) {
+            return false;
+        }
+        rec->buffer = buffer;
+        rec->buffer_size = new_size;
+    }
+    SDL_memcpy(rec->buffer + rec->buffer_used, data, size);
+    rec->buffer_used += size;
+    return true;
+}
+
+static bool AppendRecordU32(EventRecorder *rec, Uint32 value)
+{
+    value = SDL_Swap32LE(value);
+    return AppendRecordData(rec, &value, sizeof(value));
+}
+
+static bool AppendRecordU64(EventRecorder *rec, Uint64 value)
+{
+    value = SDL_Swap64LE(value);
+    return AppendRecordData(rec, &value, sizeof(value));
+}
+
+static bool FlushRecording(EventRecorder *rec)
+{
+    if (rec->buffer_used > 0) {
+        if (SDL_WriteIO(rec->dst, rec->buffer, rec->buffer_used) != rec->buffer_used) {
+            return false;
+        }
+        rec->buffer_used = 0;
+    }
+    return true;
+}
+
+static bool RecordEvent(EventRecorder *rec, const SDL_Event *event)
+{
+    const char *storage[2];
+    const char *const *strings;
+    const int num_strings = GetEventStrings(event, &strings, storage);
+    SDL_Event copy;
+    int i;
+
+    SDL_copyp(&copy, event);
+    SetEventStrings(&copy, NULL);
+
+    if (!AppendRecordU64(rec, (event->common.timestamp > rec->start) ? (event->common.timestamp - rec->start) : 0) ||
+        !AppendRecordU32(rec, (Uint32)num_strings) ||
+        !AppendRecordData(rec, &copy, sizeof(copy))) {
+        return false;
+    }
+    for (i = 0; i < num_strings; ++i) {
+        if (strings[i]) {
+            const size_t length = SDL_strlen(strings[i]);
+            if (!AppendRecordU32(rec, (Uint32)length) ||
+                !AppendRecordData(rec, strings[i], length)) {
+                return false;
+            }
+        } else if (!AppendRecordU32(rec, EVENT_RECORDING_NULL_STRING)) {
+            return false;
+        }
+    }
+
+    if (rec->buffer_used >= EVENT_RECORDING_FLUSH_SIZE) {
+        return FlushRecording(rec);
+    }
+    return true;
+}
+
+static bool SDLCALL RecordEventWatch(void *userdata, SDL_Event *event)
+{
+    EventRecorder *rec = (EventRecorder *)userdata;
+
+    SDL_LockMutex(rec->lock);
+    if (!rec->failed) {
+        if (!RecordEvent(rec, event)) {
+            SDLTest_LogError("Couldn't record event: %s", SDL_GetError());
+            rec->failed = true;
+        }
+    }
+    SDL_UnlockMutex(rec->lock);
+    return true;
+}
+
+static void DestroyEventRecorder(EventRecorder *rec)
+{
+    SDL_DestroyMutex(rec->lock);
+    SDL_free(rec->buffer);
+    SDL_free(rec);
+}
+
+bool SDLTest_StartEventRecording(SDL_IOStream *dst, bool closeio)
+{
+    EventRecorder *rec;
+
+    if (!dst) {
+        return SDL_InvalidParamError("dst");
+    }
+    if (recorder) {
+        return SDL_SetError("Events are already being recorded");
+    }
+
+    rec = (EventRecorder *)SDL_calloc(1, sizeof(*rec));
+    if (!rec) {
+        return false;
+    }
+    rec->dst = dst;
+    rec->closeio = closeio;
+    rec->start = SDL_GetTicksNS();
+    rec->lock = SDL_CreateMutex();
+
+    if (!rec->lock ||
+        !AppendRecordData(rec, EVENT_RECORDING_MAGIC, 8) ||
+        !AppendRecordU32(rec, EVENT_RECORDING_VERSION) ||
+        !AppendRecordU32(rec, (Uint32)sizeof(SDL_Event)) ||
+        !FlushRecording(rec)) {
+        DestroyEventRecorder(rec);
+        return false;
+    }
+
+    if (!SDL_AddEventWatch(RecordEventWatch, rec)) {
+        DestroyEventRecorder(rec);
+        return false;
+    }
+    recorder = rec;
+    return true;
+}
+
+bool SDLTest_StopEventRecording(void)
+{
+    EventRecorder *rec;
+    bool result;
+
+    if (!recorder) {
+        return SDL_SetError("Events aren't being recorded");
+    }
+
+    /* This waits for the watch to finish on other threads, so nothing else uses the recorder after it */
+    rec = recorder;
+    recorder = NULL;
+    SDL_RemoveEventWatch(RecordEventWatch, rec);
+
+    result = !rec->failed && FlushRecording(rec);
+    if (rec->failed) {
+        SDL_SetError("Couldn't record all the events");
+    }
+    if (rec->closeio && !SDL_CloseIO(rec->dst)) {
+        result = false;
+    }
+    DestroyEventRecorder(rec);
+    return result;
+}
+
+/* Read the next event of the replay, allocating its strings in one block at the end of the replay's list */
+static bool ReadReplayEvent(EventReplay *rep, SDL_Event *event, Uint64 *when)
+{
+    Uint32 num_strings, length, i;
+    size_t size;
+    Uint8 *block;
+    char **strings, *text;
+    Sint64 position;
+
+    if (!SDL_ReadU64LE(rep->src, when) ||
+        !SDL_ReadU32LE(rep->src, &num_strings) ||
+        SDL_ReadIO(rep->src, event, sizeof(*event)) != sizeof(*event)) {
+        return false;
+    }
+
+    if (num_strings == 0) {
+        SetEventStrings(event, NULL);
+        return true;
+    }
+
+    /* Find out how much room the strings need, then go back and read them */
+    position = SDL_TellIO(rep->src);
+    size = sizeof(EventReplayStrings) + (num_strings + 1) * sizeof(char *);
+    for (i = 0; i < num_strings; ++i) {
+        if (!SDL_ReadU32LE(rep->src, &length)) {
+            return false;
+        }
+        if (length != EVENT_RECORDING_NULL_STRING) {
+            size += length + 1;
+            if (SDL_SeekIO(rep->src, length, SDL_IO_SEEK_CUR) < 0) {
+                return false;
+            }
+        }
+    }
+    if (SDL_SeekIO(rep->src, position, SDL_IO_SEEK_SET) < 0) {
+        return false;
+    }
+
+    block = (Uint8 *)SDL_malloc(size);
+    if (!block) {
+        return false;
+    }
+    ((EventReplayStrings *)block)->next = NULL;
+    ((EventReplayStrings *)block)->size = size;
+    ((EventReplayStrings *)block)->type = event->type;
+    if (rep->strings_tail) {
+        rep->strings_tail->next = (EventReplayStrings *)block;
+    } else {
+        rep->strings = (EventReplayStrings *)block;
+    }
+    rep->strings_tail = (EventReplayStrings *)block;
+
+    strings = (char **)(block + sizeof(EventReplayStrings));
+    text = (char *)(strings + num_strings + 1);
+    for (i = 0; i < num_strings; ++i) {
+        if (!SDL_ReadU32LE(rep->src, &length)) {
+            return false;
+        }
+        if (length == EVENT_RECORDING_NULL_STRING) {
+            strings[i] = NULL;
+        } else {
+            if (SDL_ReadIO(rep->src, text, length) != length) {
+                return false;
+            }
+            text[length] = '\0';
+            strings[i] = text;
+            text += length + 1;
+        }
+    }
+    strings[num_strings] = NULL;
+
+    SetEventStrings(event, strings);
+    return true;
+}
+
+static bool IsInReplayStrings(const void *ptr, const EventReplayStrings *block)
+{
+    return (uintptr_t)ptr >= (uintptr_t)block && (uintptr_t)ptr < (uintptr_t)block + block->size;
+}
+
+/* Check whether an event of the queue still points into a block of strings */
+static bool IsReplayStringsQueued(const EventReplayStrings *block)
+{
+    SDL_Event events[16];
+    const int count = SDL_PeepEvents(events, SDL_arraysize(events), SDL_PEEKEVENT, block->type, block->type);
+    int i, j;
+
+    if (count == SDL_arraysize(events)) {
+        /* There could be more, keep the block for now */
+        return true;
+    }
+    for (i = 0; i < count; ++i) {
+        const char *storage[2];
+        const char *const *strings;
+        const int num_strings = GetEventStrings(&events[i], &strings, storage);
+
+        if (num_strings > 0 && IsInReplayStrings(strings, block)) {
+            return true;
+        }
+        for (j = 0; j < num_strings; ++j) {
+            if (strings[j] && IsInReplayStrings(strings[j], block)) {
+                return true;
+            }
+        }
+    }
+    return false;
+}
+
+static void FreeFirstReplayStrings(EventReplay *rep)
+{
+    EventReplayStrings *block = rep->strings;
+
+    rep->strings = block->next;
+    if (!rep->strings) {
+        rep->strings_tail = NULL;
+    }
+    SDL_free(block);
+}
+
+/* Free the strings of events that have been taken off the queue. Events are consumed in order,
+   so the strings of the last one taken off stay around until a later one is, in case the
+   application is still looking at it and hasn't asked for the next event yet. */
+static void FreeConsumedReplayStrings(EventReplay *rep)
+{
+    while (rep->strings && rep->strings->next &&
+           !IsReplayStringsQueued(rep->strings) &&
+           !IsReplayStringsQueued(rep->strings->next)) {
+        FreeFirstReplayStrings(rep);
+    }
+}
+
+static int SDLCALL EventReplayThread(void *data)
+{
+    EventReplay *rep = (EventReplay *)data;
+    const Uint64 start = SDL_GetTicksNS();
+    SDL_Event event;
+    Uint64 when;
+
+    while (ReadReplayEvent(rep, &event, &when)) {
+        const Uint64 due = start + (Uint64)(when / rep->speed);
+        Uint64 now = SDL_GetTicksNS();
+
+        while (now < due) {
+            const Sint32 timeout = (Sint32)SDL_min(SDL_NS_TO_MS(due - now) + 1, SDL_MAX_SINT32);
+            if (SDL_WaitSemaphoreTimeout(rep->stop, timeout)) {
+                /* We were asked to stop */
+                SDL_SetAtomicInt(&rep->done, 1);
+                return 0;
+            }
+            now = SDL_GetTicksNS();
+        }
+
+        event.common.timestamp = due;
+        SDL_PushEvent(&event);
+        FreeConsumedReplayStrings(rep);
+    }
+
+    SDL_SetAtomicInt(&rep->done, 1);
+    return 0;
+}
+
+bool SDLTest_StartEventReplay(SDL_IOStream *src, bool closeio, float speed)
+{
+    EventReplay *rep;
+    char magic[8];
+    Uint32 version = 0, event_size = 0;
+
+    if (!src) {
+        return SDL_InvalidParamError("src");
+    }
+    if (!(speed > 0.0f)) {
+        return SDL_InvalidParamError("speed");
+    }
+    if (replay) {
+        return SDL_SetError("Events are already being replayed");
+    }
+
+    if (SDL_ReadIO(src, magic, sizeof(magic)) != sizeof(magic) ||
+        SDL_memcmp(magic, EVENT_RECORDING_MAGIC, sizeof(magic)) != 0 ||
+        !SDL_ReadU32LE(src, &version) ||
+        !SDL_ReadU32LE(src, &event_size)) {
+        return SDL_SetError("Not an event recording");
+    }
+    if (version != EVENT_RECORDING_VERSION || event_size != sizeof(SDL_Event)) {
+        return SDL_SetError("Unsupported event recording (version %" SDL_PRIu32 ", event size %" SDL_PRIu32 ")", version, event_size);
+    }
+
+    rep = (EventReplay *)SDL_calloc(1, sizeof(*rep));
+    if (!rep) {
+        return false;
+    }
+    rep->src = src;
+    rep->closeio = closeio;
+    rep->speed = speed;
+    rep->stop = SDL_CreateSemaphore(0);
+    if (!rep->stop) {
+        SDL_free(rep);
+        return false;
+    }
+    rep->thread = SDL_CreateThread(EventReplayThread, "SDLTestReplay", rep);
+    if (!rep->thread) {
+        SDL_DestroySemaphore(rep->stop);
+        SDL_free(rep);
+        return false;
+    }
+    replay = rep;
+    return true;
+}
+
+bool SDLTest_IsEventReplayDone(void)
+{
+    return !replay || SDL_GetAtomicInt(&replay->done);
+}
+
+void SDLTest_StopEventReplay(void)
+{
+    EventReplay *rep = replay;
+
+    if (!rep) {
+        return;
+    }
+    replay = NULL;
+
+    SDL_SignalSemaphore(rep->stop);
+    SDL_WaitThread(rep->thread, NULL);
+    SDL_DestroySemaphore(rep->stop);
+
+    while (rep->strings) {
+        EventReplayStrings *next = rep->strings->next;
+        SDL_free(rep->strings);
+        rep->strings = next;
+    }
+    if (rep->closeio) {
+        SDL_CloseIO(rep->src);
+    }
+    SDL_free(rep);
+}
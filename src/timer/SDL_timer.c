@@ -35,26 +35,31 @@ typedef struct SDL_Timer
     void *userdata;
     Uint64 interval;
     Uint64 scheduled;
+    Uint64 sequence;
     SDL_AtomicInt canceled;
     struct SDL_Timer *next;
 } SDL_Timer;
 
-typedef struct SDL_TimerMap
-{
-    SDL_TimerID timerID;
-    SDL_Timer *timer;
-    struct SDL_TimerMap *next;
-} SDL_TimerMap;
+#define SDL_MAX_TIMER_THREADS 64
 
-// The timers are kept in a sorted list
+// The timers are kept in a heap, ordered by scheduling time
 typedef struct
 {
     // Data used by the main thread
     SDL_InitState init;
     SDL_Thread *thread;
-    SDL_TimerMap *timermap;
+    SDL_HashTable *timermap;
     SDL_Mutex *timermap_lock;
 
+    // Threads running the callbacks, if SDL_HINT_TIMER_THREADS is set
+    int num_workers;
+    SDL_Thread *workers[SDL_MAX_TIMER_THREADS];
+    SDL_Mutex *work_lock;
+    SDL_Condition *work_cond;
+    SDL_Timer *work;
+    SDL_Timer *work_tail;
+    bool work_quit;
+
     // Padding to separate cache lines between threads
     char cache_pad[SDL_CACHELINE_SIZE];
 
@@ -65,36 +70,153 @@ typedef struct
     SDL_Timer *freelist;
     SDL_AtomicInt active;
 
-    // List of timers - this is only touched by the timer thread
-    SDL_Timer *timers;
+    // Heap of timers - this is only touched by the timer thread
+    SDL_Timer **timers;
+    int num_timers;
+    int max_timers;
+    Uint64 next_sequence;
 } SDL_TimerData;
 
 static SDL_TimerData SDL_timer_data;
 
 /* The idea here is that any thread might add a timer, but a single
- * thread manages the active timer queue, sorted by scheduling time.
+ * thread manages the active timer queue, a binary heap ordered by
+ * scheduling time, so adding a timer is O(log n) however many there are.
  *
  * Timers are removed by simply setting a canceled flag
  */
 
-static void SDL_AddTimerInternal(SDL_TimerData *data, SDL_Timer *timer)
+static bool SDL_TimerBefore(const SDL_Timer *a, const SDL_Timer *b)
 {
-    SDL_Timer *prev, *curr;
+    // Timers scheduled for the same time run in the order they were queued
+    if (a->scheduled != b->scheduled) {
+        return a->scheduled < b->scheduled;
+    }
+    return a->sequence < b->sequence;
+}
 
-    prev = NULL;
-    for (curr = data->timers; curr; prev = curr, curr = curr->next) {
-        if (curr->scheduled > timer->scheduled) {
+static bool SDL_AddTimerInternal(SDL_TimerData *data, SDL_Timer *timer)
+{
+    int i;
+
+    if (data->num_timers == data->max_timers) {
+        const int max_timers = data->max_timers ? data->max_timers * 2 : 64;
+        SDL_Timer **timers = (SDL_Timer **)SDL_realloc(data->timers, max_timers * sizeof(*timers));
+        if (!timers) {
+            return false;
+        }
+        data->timers = timers;
+        data->max_timers = max_timers;
+    }
+
+    timer->sequence = data->next_sequence++;
+
+    // Move the timer up from the bottom of the heap
+    i = data->num_timers++;
+    while (i > 0) {
+        const int parent = (i - 1) / 2;
+        if (!SDL_TimerBefore(timer, data->timers[parent])) {
             break;
         }
+        data->timers[i] = data->timers[parent];
+        i = parent;
     }
+    data->timers[i] = timer;
+    return true;
+}
 
-    // Insert the timer here!
-    if (prev) {
-        prev->next = timer;
-    } else {
-        data->timers = timer;
+static SDL_Timer *SDL_RemoveFirstTimer(SDL_TimerData *data)
+{
+    SDL_Timer *first = data->timers[0];
+    SDL_Timer *last = data->timers[--data->num_timers];
+    const int count = data->num_timers;
+    int i = 0;
+
+    if (count == 0) {
+        return first;
+    }
+
+    // Move the last timer down from the top of the heap
+    for (;;) {
+        int child = 2 * i + 1;
+        if (child >= count) {
+            break;
+        }
+        if (child + 1 < count && SDL_TimerBefore(data->timers[child + 1], data->timers[child])) {
+            ++child;
+        }
+        if (!SDL_TimerBefore(data->timers[child], last)) {
+            break;
+        }
+        data->timers[i] = data->timers[child];
+        i = child;
+    }
+    data->timers[i] = last;
+    return first;
+}
+
+static Uint64 SDL_RunTimerCallback(SDL_Timer *timer)
+{
+    if (SDL_GetAtomicInt(&timer->canceled)) {
+        return 0;
     }
-    timer->next = curr;
+    if (timer->callback_ms) {
+        return SDL_MS_TO_NS(timer->callback_ms(timer->userdata, timer->timerID, (Uint32)SDL_NS_TO_MS(timer->interval)));
+    }
+    return timer->callback_ns(timer->userdata, timer->timerID, timer->interval);
+}
+
+static void SDL_RequeueTimers(SDL_TimerData *data, SDL_Timer *head, SDL_Timer *tail)
+{
+    SDL_LockSpinlock(&data->lock);
+    tail->next = data->pending;
+    data->pending = head;
+    SDL_UnlockSpinlock(&data->lock);
+}
+
+static int SDLCALL SDL_TimerWorkerThread(void *_data)
+{
+    SDL_TimerData *data = (SDL_TimerData *)_data;
+    SDL_Timer *timer;
+    Uint64 interval;
+
+    for (;;) {
+        SDL_LockMutex(data->work_lock);
+        while (!data->work && !data->work_quit) {
+            SDL_WaitCondition(data->work_cond, data->work_lock);
+        }
+        if (data->work_quit) {
+            SDL_UnlockMutex(data->work_lock);
+            break;
+        }
+        timer = data->work;
+        data->work = timer->next;
+        if (!data->work) {
+            data->work_tail = NULL;
+        }
+        SDL_UnlockMutex(data->work_lock);
+
+        interval = SDL_RunTimerCallback(timer);
+
+        // Hand the timer back to the timer thread, or retire it
+        SDL_LockSpinlock(&data->lock);
+        if (interval > 0) {
+            timer->interval = interval;
+            timer->scheduled += interval;
+            timer->next = data->pending;
+            data->pending = timer;
+        } else {
+            SDL_SetAtomicInt(&timer->canceled, 1);
+            timer->next = data->freelist;
+            data->freelist = timer;
+        }
+        SDL_UnlockSpinlock(&data->lock);
+
+        if (interval > 0) {
+            SDL_SignalSemaphore(data->sem);
+        }
+    }
+    return 0;
 }
 
 static int SDLCALL SDL_TimerThread(void *_data)
@@ -102,14 +224,17 @@ static int SDLCALL SDL_TimerThread(void *_data)
     SDL_TimerData *data = (SDL_TimerData *)_data;
     SDL_Timer *pending;
     SDL_Timer *current;
+    SDL_Timer *batch_head, *batch_tail;
     SDL_Timer *freelist_head = NULL;
     SDL_Timer *freelist_tail = NULL;
     Uint64 tick, now, interval, delay;
+    bool retry;
 
     /* Threaded timer loop:
      *  1. Queue timers added by other threads
-     *  2. Handle any timers that should dispatch this cycle
-     *  3. Wait until next dispatch time or new timer arrives
+     *  2. Take all the timers that should dispatch this cycle
+     *  3. Run them here, or hand them to the callback threads
+     *  4. Wait until next dispatch time or new timer arrives
      */
     for (;;) {
         // Pending and freelist maintenance
@@ -127,11 +252,19 @@ static int SDLCALL SDL_TimerThread(void *_data)
         }
         SDL_UnlockSpinlock(&data->lock);
 
-        // Sort the pending timers into our list
+        // Sort the pending timers into our heap
+        retry = false;
         while (pending) {
             current = pending;
+            if (!SDL_AddTimerInternal(data, current)) {
+                // Out of memory, try again in a little bit
+                for (batch_tail = pending; batch_tail->next; batch_tail = batch_tail->next) {
+                }
+                SDL_RequeueTimers(data, pending, batch_tail);
+                retry = true;
+                break;
+            }
             pending = pending->next;
-            SDL_AddTimerInternal(data, current);
         }
         freelist_head = NULL;
         freelist_tail = NULL;
@@ -141,50 +274,73 @@ static int SDLCALL SDL_TimerThread(void *_data)
             break;
         }
 
-        // Initial delay if there are no timers
-        delay = (Uint64)-1;
-
         tick = SDL_GetTicksNS();
 
-        // Process all the pending timers for this tick
-        while (data->timers) {
-            current = data->timers;
-
-            if (tick < current->scheduled) {
-                // Scheduled for the future, wait a bit
-                delay = (current->scheduled - tick);
-                break;
+        // Take all the timers that are due this tick at once
+        batch_head = NULL;
+        batch_tail = NULL;
+        while (data->num_timers > 0 && data->timers[0]->scheduled <= tick) {
+            current = SDL_RemoveFirstTimer(data);
+            current->next = NULL;
+            if (batch_tail) {
+                batch_tail->next = current;
+            } else {
+                batch_head = current;
             }
+            batch_tail = current;
+        }
 
-            // We're going to do something with this timer
-            data->timers = current->next;
+        if (batch_head && data->num_workers > 0) {
+            // Rescheduling is relative to the time the timer was dispatched
+            for (current = batch_head; current; current = current->next) {
+                current->scheduled = tick;
+            }
 
-            if (SDL_GetAtomicInt(&current->canceled)) {
-                interval = 0;
+            SDL_LockMutex(data->work_lock);
+            if (data->work_tail) {
+                data->work_tail->next = batch_head;
             } else {
-                if (current->callback_ms) {
-                    interval = SDL_MS_TO_NS(current->callback_ms(current->userdata, current->timerID, (Uint32)SDL_NS_TO_MS(current->interval)));
+                data->work = batch_head;
+            }
+            data->work_tail = batch_tail;
+            SDL_BroadcastCondition(data->work_cond);
+            SDL_UnlockMutex(data->work_lock);
+        } else {
+            while (batch_head) {
+                current = batch_head;
+                batch_head = batch_head->next;
+
+                interval = SDL_RunTimerCallback(current);
+                if (interval > 0) {
+                    // Reschedule this timer
+                    current->interval = interval;
+                    current->scheduled = tick + interval;
+                    if (!SDL_AddTimerInternal(data, current)) {
+                        SDL_RequeueTimers(data, current, current);
+                        retry = true;
+                    }
                 } else {
-                    interval = current->callback_ns(current->userdata, current->timerID, current->interval);
+                    current->next = NULL;
+                    if (!freelist_head) {
+                        freelist_head = current;
+                    }
+                    if (freelist_tail) {
+                        freelist_tail->next = current;
+                    }
+                    freelist_tail = current;
+
+                    SDL_SetAtomicInt(&current->canceled, 1);
                 }
             }
+        }
 
-            if (interval > 0) {
-                // Reschedule this timer
-                current->interval = interval;
-                current->scheduled = tick + interval;
-                SDL_AddTimerInternal(data, current);
-            } else {
-                if (!freelist_head) {
-                    freelist_head = current;
-                }
-                if (freelist_tail) {
-                    freelist_tail->next = current;
-                }
-                freelist_tail = current;
-
-                SDL_SetAtomicInt(&current->canceled, 1);
-            }
+        // Wait until the next timer is due, or forever if there are no timers
+        if (retry) {
+            delay = SDL_NS_PER_MS;
+        } else if (data->num_timers > 0) {
+            delay = (data->timers[0]->scheduled > tick) ? (data->timers[0]->scheduled - tick) : 0;
+        } else {
+            delay = (Uint64)-1;
         }
 
         // Adjust the delay based on processing time
@@ -203,12 +359,15 @@ static int SDLCALL SDL_TimerThread(void *_data)
          */
         SDL_WaitSemaphoreTimeoutNS(data->sem, delay);
     }
+
     return 0;
 }
 
 bool SDL_InitTimers(void)
 {
     SDL_TimerData *data = &SDL_timer_data;
+    const char *hint;
+    int i;
 
     if (!SDL_ShouldInit(&data->init)) {
         return true;
@@ -219,11 +378,31 @@ bool SDL_InitTimers(void)
         goto error;
     }
 
+    data->timermap = SDL_CreateHashTable(0, false, SDL_HashID, SDL_KeyMatchID, NULL, NULL);
+    if (!data->timermap) {
+        goto error;
+    }
+
     data->sem = SDL_CreateSemaphore(0);
     if (!data->sem) {
         goto error;
     }
 
+    hint = SDL_GetHint(SDL_HINT_TIMER_THREADS);
+    if (hint) {
+        data->num_workers = SDL_clamp(SDL_atoi(hint), 0, SDL_MAX_TIMER_THREADS);
+    }
+    if (data->num_workers > 0) {
+        data->work_lock = SDL_CreateMutex();
+        if (!data->work_lock) {
+            goto error;
+        }
+        data->work_cond = SDL_CreateCondition();
+        if (!data->work_cond) {
+            goto error;
+        }
+    }
+
     SDL_SetAtomicInt(&data->active, true);
 
     // Timer threads use a callback into the app, so we can't set a limited stack size here.
@@ -232,6 +411,15 @@ bool SDL_InitTimers(void)
         goto error;
     }
 
+    for (i = 0; i < data->num_workers; ++i) {
+        char name[64];
+        (void)SDL_snprintf(name, sizeof(name), "SDLTimer%d", i);
+        data->workers[i] = SDL_CreateThread(SDL_TimerWorkerThread, name, data);
+        if (!data->workers[i]) {
+            goto error;
+        }
+    }
+
     SDL_SetInitialized(&data->init, true);
     return true;
 
@@ -245,7 +433,7 @@ void SDL_QuitTimers(void)
 {
     SDL_TimerData *data = &SDL_timer_data;
     SDL_Timer *timer;
-    SDL_TimerMap *entry;
+    int i;
 
     if (!SDL_ShouldQuit(&data->init)) {
         return;
@@ -260,15 +448,54 @@ void SDL_QuitTimers(void)
         data->thread = NULL;
     }
 
+    // Shutdown the callback threads, any timers still waiting for them are dropped
+    if (data->work_lock) {
+        SDL_LockMutex(data->work_lock);
+        data->work_quit = true;
+        SDL_BroadcastCondition(data->work_cond);
+        SDL_UnlockMutex(data->work_lock);
+    }
+    for (i = 0; i < data->num_workers; ++i) {
+        if (data->workers[i]) {
+            SDL_WaitThread(data->workers[i], NULL);
+            data->workers[i] = NULL;
+        }
+    }
+    data->num_workers = 0;
+    data->work_quit = false;
+
+    if (data->work_cond) {
+        SDL_DestroyCondition(data->work_cond);
+        data->work_cond = NULL;
+    }
+    if (data->work_lock) {
+        SDL_DestroyMutex(data->work_lock);
+        data->work_lock = NULL;
+    }
+
     if (data->sem) {
         SDL_DestroySemaphore(data->sem);
         data->sem = NULL;
     }
 
     // Clean up the timer entries
-    while (data->timers) {
-        timer = data->timers;
-        data->timers = timer->next;
+    for (i = 0; i < data->num_timers; ++i) {
+        SDL_free(data->timers[i]);
+    }
+    SDL_free(data->timers);
+    data->timers = NULL;
+    data->num_timers = 0;
+    data->max_timers = 0;
+
+    while (data->work) {
+        timer = data->work;
+        data->work = timer->next;
+        SDL_free(timer);
+    }
+    data->work_tail = NULL;
+    while (data->pending) {
+        timer = data->pending;
+        data->pending = timer->next;
         SDL_free(timer);
     }
     while (data->freelist) {
@@ -276,10 +503,10 @@ void SDL_QuitTimers(void)
         data->freelist = timer->next;
         SDL_free(timer);
     }
-    while (data->timermap) {
-        entry = data->timermap;
-        data->timermap = entry->next;
-        SDL_free(entry);
+
+    if (data->timermap) {
+        SDL_DestroyHashTable(data->timermap);
+        data->timermap = NULL;
     }
 
     if (data->timermap_lock) {
@@ -299,7 +526,7 @@ static SDL_TimerID SDL_CreateTimer(Uint64 interval, SDL_TimerCallback callback_m
 {
     SDL_TimerData *data = &SDL_timer_data;
     SDL_Timer *timer;
-    SDL_TimerMap *entry;
+    bool reused;
 
     CHECK_PARAM(!callback_ms && !callback_ns) {
         SDL_InvalidParamError("callback");
@@ -317,15 +544,27 @@ static SDL_TimerID SDL_CreateTimer(Uint64 interval, SDL_TimerCallback callback_m
     }
     SDL_UnlockSpinlock(&data->lock);
 
-    if (timer) {
-        SDL_RemoveTimer(timer->timerID);
-    } else {
+    reused = (timer != NULL);
+    if (!timer) {
         timer = (SDL_Timer *)SDL_malloc(sizeof(*timer));
         if (!timer) {
             return 0;
         }
     }
+
+    SDL_LockMutex(data->timermap_lock);
+    if (reused) {
+        // Forget the timer this structure was last used for
+        SDL_RemoveFromHashTable(data->timermap, (const void *)(uintptr_t)timer->timerID);
+    }
     timer->timerID = SDL_GetNextObjectID();
+    if (!SDL_InsertIntoHashTable(data->timermap, (const void *)(uintptr_t)timer->timerID, timer, false)) {
+        SDL_UnlockMutex(data->timermap_lock);
+        SDL_free(timer);
+        return 0;
+    }
+    SDL_UnlockMutex(data->timermap_lock);
+
     timer->callback_ms = callback_ms;
     timer->callback_ns = callback_ns;
     timer->userdata = userdata;
@@ -333,19 +572,6 @@ static SDL_TimerID SDL_CreateTimer(Uint64 interval, SDL_TimerCallback callback_m
     timer->scheduled = SDL_GetTicksNS() + timer->interval;
     SDL_SetAtomicInt(&timer->canceled, 0);
 
-    entry = (SDL_TimerMap *)SDL_malloc(sizeof(*entry));
-    if (!entry) {
-        SDL_free(timer);
-        return 0;
-    }
-    entry->timer = timer;
-    entry->timerID = timer->timerID;
-
-    SDL_LockMutex(data->timermap_lock);
-    entry->next = data->timermap;
-    data->timermap = entry;
-    SDL_UnlockMutex(data->timermap_lock);
-
     // Add the timer to the pending list for the timer thread
     SDL_LockSpinlock(&data->lock);
     timer->next = data->pending;
@@ -355,7 +581,7 @@ static SDL_TimerID SDL_CreateTimer(Uint64 interval, SDL_TimerCallback callback_m
     // Wake up the timer thread if necessary
     SDL_SignalSemaphore(data->sem);
 
-    return entry->timerID;
+    return timer->timerID;
 }
 
 SDL_TimerID SDL_AddTimer(Uint32 interval, SDL_TimerCallback callback, void *userdata)
@@ -371,7 +597,8 @@ SDL_TimerID SDL_AddTimerNS(Uint64 interval, SDL_NSTimerCallback callback, void *
 bool SDL_RemoveTimer(SDL_TimerID id)
 {
     SDL_TimerData *data = &SDL_timer_data;
-    SDL_TimerMap *prev, *entry;
+    const void *key = (const void *)(uintptr_t)id;
+    SDL_Timer *timer = NULL;
     bool canceled = false;
 
     CHECK_PARAM(!id) {
@@ -380,25 +607,16 @@ bool SDL_RemoveTimer(SDL_TimerID id)
 
     // Find the timer
     SDL_LockMutex(data->timermap_lock);
-    prev = NULL;
-    for (entry = data->timermap; entry; prev = entry, entry = entry->next) {
-        if (entry->timerID == id) {
-            if (prev) {
-                prev->next = entry->next;
-            } else {
-                data->timermap = entry->next;
-            }
-            break;
-        }
+    if (data->timermap && SDL_FindInHashTable(data->timermap, key, (const void **)&timer)) {
+        SDL_RemoveFromHashTable(data->timermap, key);
     }
     SDL_UnlockMutex(data->timermap_lock);
 
-    if (entry) {
-        if (!SDL_GetAtomicInt(&entry->timer->canceled)) {
-            SDL_SetAtomicInt(&entry->timer->canceled, 1);
+    if (timer) {
+        if (!SDL_GetAtomicInt(&timer->canceled)) {
+            SDL_SetAtomicInt(&timer->canceled, 1);
             canceled = true;
         }
-        SDL_free(entry);
     }
     if (canceled) {
         return true;
@@ -754,3 +972,199 @@ void SDL_DelayPrecise(Uint64 ns)
         current_value = SDL_GetTicksNS();
     }
 }
+
+struct SDL_FramePacer
+{
+    Uint64 base;            // the time of frame 0
+    Uint64 frame;           // the last frame we waited for
+    Uint64 period_ns;       // whole nanoseconds per frame
+    Uint64 period_rem;      // leftover nanoseconds per frame, in units of 1/period_div
+    Uint64 period_div;
+    Uint64 sleep_overshoot;
+    Uint64 frames;
+    Uint64 missed_frames;
+    Uint64 waits;
+    Uint64 total_jitter;
+    Uint64 max_jitter;
+};
+
+// Start out assuming the OS oversleeps as much as SDL_DelayPrecise() assumes
+#define SDL_INITIAL_SLEEP_OVERSHOOT_NS  (1 * SDL_NS_PER_MS)
+
+static Uint64 SDL_GetFrameDeadline(const SDL_FramePacer *pacer, Uint64 frame)
+{
+    return pacer->base + frame * pacer->period_ns + (frame * pacer->period_rem) / pacer->period_div;
+}
+
+static bool SDL_SetFramePacerPeriodFraction(SDL_FramePacer *pacer, Uint64 ns, Uint64 div)
+{
+    if (ns / div == 0) {
+        return SDL_SetError("Frame period is less than a nanosecond");
+    }
+
+    // Keep the phase, the next deadline is one new period after the last one
+    pacer->base = SDL_GetFrameDeadline(pacer, pacer->frame);
+    pacer->frame = 0;
+    pacer->period_ns = ns / div;
+    pacer->period_rem = ns % div;
+    pacer->period_div = div;
+    return true;
+}
+
+SDL_FramePacer *SDL_CreateFramePacer(Uint64 period_ns)
+{
+    SDL_FramePacer *pacer;
+
+    CHECK_PARAM(period_ns == 0) {
+        SDL_InvalidParamError("period_ns");
+        return NULL;
+    }
+
+    pacer = (SDL_FramePacer *)SDL_calloc(1, sizeof(*pacer));
+    if (!pacer) {
+        return NULL;
+    }
+    pacer->base = SDL_GetTicksNS();
+    pacer->period_ns = period_ns;
+    pacer->period_div = 1;
+    pacer->sleep_overshoot = SDL_INITIAL_SLEEP_OVERSHOOT_NS;
+    return pacer;
+}
+
+bool SDL_SetFramePacerPeriod(SDL_FramePacer *pacer, Uint64 period_ns)
+{
+    CHECK_PARAM(!pacer) {
+        return SDL_InvalidParamError("pacer");
+    }
+    CHECK_PARAM(period_ns == 0) {
+        return SDL_InvalidParamError("period_ns");
+    }
+
+    return SDL_SetFramePacerPeriodFraction(pacer, period_ns, 1);
+}
+
+bool SDL_SetFramePacerRefreshRate(SDL_FramePacer *pacer, int numerator, int denominator)
+{
+    CHECK_PARAM(!pacer) {
+        return SDL_InvalidParamError("pacer");
+    }
+    CHECK_PARAM(numerator <= 0) {
+        return SDL_InvalidParamError("numerator");
+    }
+    CHECK_PARAM(denominator < 0) {
+        return SDL_InvalidParamError("denominator");
+    }
+
+    if (denominator == 0) {
+        denominator = 1;
+    }
+    return SDL_SetFramePacerPeriodFraction(pacer, SDL_NS_PER_SECOND * (Uint64)denominator, (Uint64)numerator);
+}
+
+static void SDL_WaitFrameDeadline(SDL_FramePacer *pacer, Uint64 deadline)
+{
+    Uint64 now = SDL_GetTicksNS();
+
+    // Sleep until the deadline, less the time the OS is expected to oversleep
+    while (now < deadline && deadline - now > pacer->sleep_overshoot) {
+        const Uint64 request = deadline - now - pacer->sleep_overshoot;
+        Uint64 elapsed, overshoot;
+
+        SDL_SYS_DelayNS(request);
+        elapsed = SDL_GetTicksNS() - now;
+        overshoot = (elapsed > request) ? (elapsed - request) : 0;
+        now += elapsed;
+
+        // Follow increases right away, and decreases slowly so an occasional quick wakeup doesn't make us late
+        if (overshoot > pacer->sleep_overshoot) {
+            pacer->sleep_overshoot = overshoot;
+        } else {
+            pacer->sleep_overshoot -= (pacer->sleep_overshoot - overshoot) / 16;
+        }
+    }
+
+    // Spin for any remaining time
+    while (now < deadline) {
+        SDL_CPUPauseInstruction();
+        now = SDL_GetTicksNS();
+    }
+
+    ++pacer->waits;
+    pacer->total_jitter += (now - deadline);
+    if ((now - deadline) > pacer->max_jitter) {
+        pacer->max_jitter = (now - deadline);
+    }
+}
+
+int SDL_WaitFramePacer(SDL_FramePacer *pacer)
+{
+    Uint64 now, frame, deadline, skip;
+    Uint64 last_frame;
+
+    CHECK_PARAM(!pacer) {
+        SDL_InvalidParamError("pacer");
+        return -1;
+    }
+
+    now = SDL_GetTicksNS();
+    last_frame = pacer->frame;
+    frame = last_frame + 1;
+    deadline = SDL_GetFrameDeadline(pacer, frame);
+
+    ++pacer->frames;
+
+    if (now < deadline) {
+        SDL_WaitFrameDeadline(pacer, deadline);
+        pacer->frame = frame;
+        return 1;
+    }
+
+    // We're late, move on to the latest deadline that has passed
+    skip = (now - deadline) / (pacer->period_ns + 1);
+    frame += skip;
+    while (SDL_GetFrameDeadline(pacer, frame + 1) <= now) {
+        ++frame;
+    }
+    pacer->missed_frames += (frame - last_frame);
+    pacer->frame = frame;
+
+    return (int)SDL_min(frame - last_frame, SDL_MAX_SINT32);
+}
+
+bool SDL_ResetFramePacer(SDL_FramePacer *pacer)
+{
+    CHECK_PARAM(!pacer) {
+        return SDL_InvalidParamError("pacer");
+    }
+
+    pacer->base = SDL_GetTicksNS();
+    pacer->frame = 0;
+    pacer->frames = 0;
+    pacer->missed_frames = 0;
+    pacer->waits = 0;
+    pacer->total_jitter = 0;
+    pacer->max_jitter = 0;
+    return true;
+}
+
+bool SDL_GetFramePacerStats(SDL_FramePacer *pacer, SDL_FramePacerStats *stats)
+{
+    CHECK_PARAM(!pacer) {
+        return SDL_InvalidParamError("pacer");
+    }
+    CHECK_PARAM(!stats) {
+        return SDL_InvalidParamError("stats");
+    }
+
+    stats->frames = pacer->frames;
+    stats->missed_frames = pacer->missed_frames;
+    stats->average_jitter_ns = pacer->waits ? (pacer->total_jitter / pacer->waits) : 0;
+    stats->max_jitter_ns = pacer->max_jitter;
+    stats->sleep_overshoot_ns = pacer->sleep_overshoot;
+    return true;
+}
+
+void SDL_DestroyFramePacer(SDL_FramePacer *pacer)
+{
+    SDL_free(pacer);
+}
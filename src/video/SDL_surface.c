@@ -28,6 +28,7 @@
 #include "SDL_stb_c.h"
 #include "SDL_yuv_c.h"
 #include "../render/SDL_sysrender.h"
+#include "../stdlib/SDL_malloc_c.h"
 
 #include "SDL_surface_c.h"
 
@@ -247,6 +248,8 @@ static SDL_Surface *SDL_CreateSurfaceInternal(int width, int height, SDL_PixelFo
             SDL_DestroySurface(surface);
             return NULL;
         }
+        surface->tracked_size = size;
+        SDL_TrackMemory(SDL_MEMORY_TAG_SURFACE, size);
     }
     return surface;
 }
@@ -3119,6 +3122,10 @@ void SDL_DestroySurface(SDL_Surface *surface)
 #endif
     SDL_SetSurfacePalette(surface, NULL);
 
+    if (surface->tracked_size) {
+        SDL_UntrackMemory(SDL_MEMORY_TAG_SURFACE, surface->tracked_size);
+    }
+
     if (surface->flags & SDL_SURFACE_PREALLOCATED) {
         // Don't free
     } else if (surface->flags & SDL_SURFACE_SIMD_ALIGNED) {
@@ -81,6 +81,9 @@ struct SDL_Surface
 
     /** Original pixels when RLE is enabled */
     void *saved_pixels;
+
+    /** Size of the pixels counted under SDL_MEMORY_TAG_SURFACE, 0 if they aren't counted */
+    size_t tracked_size;
 };
 
 // Surface functions
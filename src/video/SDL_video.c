@@ -284,6 +284,15 @@ typedef struct
     int bytes_per_pixel;
 } SDL_WindowTextureData;
 
+static SDL_AtomicU32 SDL_window_texturedata_atom;
+
+// This is looked up every time the window surface is updated, so skip hashing the name
+static SDL_WindowTextureData *SDL_GetWindowTextureData(SDL_Window *window)
+{
+    const SDL_PropertyAtom atom = SDL_GetCachedPropertyAtom(&SDL_window_texturedata_atom, SDL_PROP_WINDOW_TEXTUREDATA_POINTER);
+    return (SDL_WindowTextureData *)SDL_GetPointerPropertyByAtom(SDL_GetWindowProperties(window), atom, NULL);
+}
+
 static Uint32 SDL_DefaultGraphicsBackends(SDL_VideoDevice *_this)
 {
 #if (defined(SDL_VIDEO_OPENGL) && defined(SDL_PLATFORM_MACOS)) || (defined(SDL_PLATFORM_IOS) && !TARGET_OS_MACCATALYST) || defined(SDL_PLATFORM_QNXNTO)
@@ -465,7 +474,7 @@ bool SDL_SetWindowTextureVSync(SDL_VideoDevice *_this, SDL_Window *window, int v
 {
     SDL_WindowTextureData *data;
 
-    data = (SDL_WindowTextureData *)SDL_GetPointerProperty(SDL_GetWindowProperties(window), SDL_PROP_WINDOW_TEXTUREDATA_POINTER, NULL);
+    data = SDL_GetWindowTextureData(window);
     if (!data) {
         return false;
     }
@@ -479,7 +488,7 @@ static bool SDL_GetWindowTextureVSync(SDL_VideoDevice *_this, SDL_Window *window
 {
     SDL_WindowTextureData *data;
 
-    data = (SDL_WindowTextureData *)SDL_GetPointerProperty(SDL_GetWindowProperties(window), SDL_PROP_WINDOW_TEXTUREDATA_POINTER, NULL);
+    data = SDL_GetWindowTextureData(window);
     if (!data) {
         return false;
     }
@@ -498,7 +507,7 @@ static bool SDL_UpdateWindowTexture(SDL_VideoDevice *_this, SDL_Window *window,
 
     SDL_GetWindowSizeInPixels(window, &w, &h);
 
-    data = (SDL_WindowTextureData *)SDL_GetPointerProperty(SDL_GetWindowProperties(window), SDL_PROP_WINDOW_TEXTUREDATA_POINTER, NULL);
+    data = SDL_GetWindowTextureData(window);
     if (!data || !data->texture) {
         return SDL_SetError("No window texture data");
     }
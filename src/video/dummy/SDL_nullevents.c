@@ -30,9 +30,35 @@
 #include "SDL_nullvideo.h"
 #include "SDL_nullevents_c.h"
 
+// A scancode to press or release on the next pump, set by SDL's tests to feed keys through the keyboard state
+#define DUMMY_KEY_DOWN "SDL.internal.window.dummy.key_down"
+#define DUMMY_KEY_UP   "SDL.internal.window.dummy.key_up"
+
+static void DUMMY_PumpKey(SDL_PropertiesID props, const char *name, bool down)
+{
+    const SDL_Scancode scancode = (SDL_Scancode)SDL_GetNumberProperty(props, name, SDL_SCANCODE_UNKNOWN);
+
+    if (scancode != SDL_SCANCODE_UNKNOWN) {
+        SDL_ClearProperty(props, name);
+        SDL_SendKeyboardKey(0, SDL_DEFAULT_KEYBOARD_ID, 0, scancode, down);
+    }
+}
+
 void DUMMY_PumpEvents(SDL_VideoDevice *_this)
 {
     // do nothing.
 }
 
+void DUMMY_PumpEventsForTests(SDL_VideoDevice *_this)
+{
+    SDL_Window *window;
+
+    for (window = _this->windows; window; window = window->next) {
+        SDL_PropertiesID props = SDL_GetWindowProperties(window);
+
+        DUMMY_PumpKey(props, DUMMY_KEY_DOWN, true);
+        DUMMY_PumpKey(props, DUMMY_KEY_UP, false);
+    }
+}
+
 #endif // SDL_VIDEO_DRIVER_DUMMY
@@ -27,5 +27,6 @@
 #include "SDL_nullvideo.h"
 
 extern void DUMMY_PumpEvents(SDL_VideoDevice *_this);
+extern void DUMMY_PumpEventsForTests(SDL_VideoDevice *_this);
 
 #endif // SDL_nullevents_c_h_
@@ -28,6 +28,13 @@
 
 #define DUMMY_SURFACE "SDL.internal.window.surface"
 
+// The number of updates and the bounds of the last one, recorded for SDL's tests
+#define DUMMY_UPDATE_COUNT "SDL.internal.window.dummy.update_count"
+#define DUMMY_UPDATE_X "SDL.internal.window.dummy.update_x"
+#define DUMMY_UPDATE_Y "SDL.internal.window.dummy.update_y"
+#define DUMMY_UPDATE_W "SDL.internal.window.dummy.update_w"
+#define DUMMY_UPDATE_H "SDL.internal.window.dummy.update_h"
+
 
 bool SDL_DUMMY_CreateWindowFramebuffer(SDL_VideoDevice *_this, SDL_Window *window, SDL_PixelFormat *format, void **pixels, int *pitch)
 {
@@ -70,6 +77,25 @@ bool SDL_DUMMY_UpdateWindowFramebuffer(SDL_VideoDevice *_this, SDL_Window *windo
     return true;
 }
 
+bool SDL_DUMMY_UpdateWindowFramebufferForTests(SDL_VideoDevice *_this, SDL_Window *window, const SDL_Rect *rects, int numrects)
+{
+    SDL_PropertiesID props = SDL_GetWindowProperties(window);
+    SDL_Rect bounds;
+    int i;
+
+    SDL_zero(bounds);
+    for (i = 0; i < numrects; ++i) {
+        SDL_GetRectUnion(&bounds, &rects[i], &bounds);
+    }
+    SDL_SetNumberProperty(props, DUMMY_UPDATE_COUNT, SDL_GetNumberProperty(props, DUMMY_UPDATE_COUNT, 0) + 1);
+    SDL_SetNumberProperty(props, DUMMY_UPDATE_X, bounds.x);
+    SDL_SetNumberProperty(props, DUMMY_UPDATE_Y, bounds.y);
+    SDL_SetNumberProperty(props, DUMMY_UPDATE_W, bounds.w);
+    SDL_SetNumberProperty(props, DUMMY_UPDATE_H, bounds.h);
+
+    return SDL_DUMMY_UpdateWindowFramebuffer(_this, window, rects, numrects);
+}
+
 void SDL_DUMMY_DestroyWindowFramebuffer(SDL_VideoDevice *_this, SDL_Window *window)
 {
     SDL_ClearProperty(SDL_GetWindowProperties(window), DUMMY_SURFACE);
@@ -188,6 +188,10 @@ bool DUMMY_VideoInitCommon(SDL_VideoDevice *_this)
         return false;
     }
 
+    if (SDL_GetHintBoolean(SDL_HINT_VIDEO_DUMMY_TEST_HOOKS, false)) {
+        _this->UpdateWindowFramebuffer = SDL_DUMMY_UpdateWindowFramebufferForTests;
+    }
+
     return true;
 }
 
@@ -197,6 +201,10 @@ bool DUMMY_VideoInit(SDL_VideoDevice *_this)
         return false;
     }
 
+    if (SDL_GetHintBoolean(SDL_HINT_VIDEO_DUMMY_TEST_HOOKS, false)) {
+        _this->PumpEvents = DUMMY_PumpEventsForTests;
+    }
+
     SDL_GetMouse()->SetRelativeMouseMode = DUMMY_SetRelativeMouseMode;
     return true;
 }
@@ -25,4 +25,16 @@
 
 #include "../SDL_sysvideo.h"
 
+/**
+ * A variable that enables hooks in the dummy video driver for SDL's own tests.
+ *
+ * When enabled, the number and bounds of framebuffer updates are recorded in
+ * internal window properties, and the dummy driver (but not dummy_evdev)
+ * presses and releases the scancodes set in internal window properties when
+ * events are pumped.
+ *
+ * This hint should be set before the video subsystem is initialized.
+ */
+#define SDL_HINT_VIDEO_DUMMY_TEST_HOOKS "SDL_VIDEO_DUMMY_TEST_HOOKS"
+
 #endif // SDL_nullvideo_h_
@@ -121,6 +121,9 @@ int main(int argc, char *argv[])
         return 0;
     }
 
+    /* Let the dummy video driver record what the tests need to check */
+    SDL_SetHint("SDL_VIDEO_DUMMY_TEST_HOOKS", "1");
+
     /* Initialize common state */
     if (!SDLTest_CommonInit(state)) {
         quit(2);
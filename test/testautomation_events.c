@@ -203,6 +203,284 @@ static int SDLCALL events_addDelEventWatchWithUserdata(void *arg)
     return TEST_COMPLETED;
 }
 
+static int g_watcherCalls[3];
+
+static bool SDLCALL events_countingEventWatch(void *userdata, SDL_Event *event)
+{
+    ++g_watcherCalls[*(int *)userdata];
+    return true;
+}
+
+static int g_watcherIndex[3] = { 0, 1, 2 };
+
+/* Replaces the watchers while the event is being dispatched */
+static bool SDLCALL events_replacingEventWatch(void *userdata, SDL_Event *event)
+{
+    ++g_watcherCalls[0];
+    SDL_RemoveEventWatch(events_countingEventWatch, &g_watcherIndex[1]);
+    SDL_RemoveEventWatch(events_replacingEventWatch, userdata);
+    SDL_AddEventWatch(events_countingEventWatch, &g_watcherIndex[2]);
+    return true;
+}
+
+/**
+ * Adds and removes event watches from within an event watch.
+ *
+ * \sa SDL_AddEventWatch
+ * \sa SDL_RemoveEventWatch
+ */
+static int SDLCALL events_addDelEventWatchReentrant(void *arg)
+{
+    SDL_Event event;
+
+    SDL_zero(event);
+    event.type = SDL_EVENT_USER;
+    SDL_zeroa(g_watcherCalls);
+
+    SDL_AddEventWatch(events_replacingEventWatch, NULL);
+    SDL_AddEventWatch(events_countingEventWatch, &g_watcherIndex[1]);
+    SDLTest_AssertPass("Call to SDL_AddEventWatch()");
+
+    SDL_PushEvent(&event);
+    SDLTest_AssertPass("Call to SDL_PushEvent()");
+    SDLTest_AssertCheck(g_watcherCalls[0] == 1, "Check that the replacing watch was called once, got %d", g_watcherCalls[0]);
+    SDLTest_AssertCheck(g_watcherCalls[1] == 0, "Check that the watch removed during dispatch was NOT called, got %d", g_watcherCalls[1]);
+    SDLTest_AssertCheck(g_watcherCalls[2] == 0, "Check that the watch added during dispatch was NOT called yet, got %d", g_watcherCalls[2]);
+
+    SDL_PushEvent(&event);
+    SDLTest_AssertPass("Call to SDL_PushEvent()");
+    SDLTest_AssertCheck(g_watcherCalls[0] == 1, "Check that the removed replacing watch was NOT called again, got %d", g_watcherCalls[0]);
+    SDLTest_AssertCheck(g_watcherCalls[1] == 0, "Check that the removed watch was NOT called, got %d", g_watcherCalls[1]);
+    SDLTest_AssertCheck(g_watcherCalls[2] == 1, "Check that the added watch was called, got %d", g_watcherCalls[2]);
+
+    SDL_RemoveEventWatch(events_countingEventWatch, &g_watcherIndex[2]);
+    SDLTest_AssertPass("Call to SDL_RemoveEventWatch()");
+    SDL_PushEvent(&event);
+    SDLTest_AssertCheck(g_watcherCalls[2] == 1, "Check that the added watch was NOT called after removal, got %d", g_watcherCalls[2]);
+
+    SDL_FlushEvents(SDL_EVENT_FIRST, SDL_EVENT_LAST);
+    return TEST_COMPLETED;
+}
+
+#ifndef SDL_PLATFORM_EMSCRIPTEN /* Emscripten doesn't have threads */
+typedef struct SlowEventWatchData_t
+{
+    SDL_AtomicInt entered;
+    SDL_AtomicInt returned;
+} SlowEventWatchData_t;
+
+static bool SDLCALL events_slowEventWatch(void *userdata, SDL_Event *event)
+{
+    SlowEventWatchData_t *data = (SlowEventWatchData_t *)userdata;
+
+    SDL_SetAtomicInt(&data->entered, 1);
+    SDL_Delay(100);
+    SDL_SetAtomicInt(&data->returned, 1);
+    return true;
+}
+
+static int SDLCALL PushUserEventThread(void *userdata)
+{
+    SDL_Event event;
+
+    SDL_zero(event);
+    event.type = SDL_EVENT_USER;
+    SDL_PushEvent(&event);
+    return 0;
+}
+#endif /* !SDL_PLATFORM_EMSCRIPTEN */
+
+/**
+ * Removes an event watch while it's running on another thread.
+ *
+ * \sa SDL_RemoveEventWatch
+ */
+static int SDLCALL events_delEventWatchWhileRunning(void *arg)
+{
+#ifndef SDL_PLATFORM_EMSCRIPTEN
+    SlowEventWatchData_t data;
+    SDL_Thread *thread;
+
+    SDL_zero(data);
+    SDL_AddEventWatch(events_slowEventWatch, &data);
+    SDLTest_AssertPass("Call to SDL_AddEventWatch()");
+
+    thread = SDL_CreateThread(PushUserEventThread, NULL, NULL);
+    SDLTest_AssertCheck(thread != NULL, "Create thread, got %p", thread);
+    if (thread) {
+        while (!SDL_GetAtomicInt(&data.entered)) {
+            SDL_Delay(1);
+        }
+        /* The running dispatch keeps using the watchers it started with */
+        SDL_AddEventWatch(events_countingEventWatch, &g_watcherIndex[0]);
+        SDLTest_AssertPass("Call to SDL_AddEventWatch() while the watch is running");
+        SDL_RemoveEventWatch(events_slowEventWatch, &data);
+        SDLTest_AssertPass("Call to SDL_RemoveEventWatch()");
+        SDLTest_AssertCheck(SDL_GetAtomicInt(&data.returned) == 1, "Check that the running watch returned before removal finished");
+        SDL_WaitThread(thread, NULL);
+        SDL_RemoveEventWatch(events_countingEventWatch, &g_watcherIndex[0]);
+    } else {
+        SDL_RemoveEventWatch(events_slowEventWatch, &data);
+    }
+
+    SDL_FlushEvents(SDL_EVENT_FIRST, SDL_EVENT_LAST);
+#endif
+    return TEST_COMPLETED;
+}
+
+static bool SDLCALL events_rejectingEventFilter(void *userdata, SDL_Event *event)
+{
+    return !(event->type == SDL_EVENT_USER && event->user.code == 1);
+}
+
+/**
+ * Checks the event statistics.
+ *
+ * \sa SDL_GetEventStats
+ */
+static int SDLCALL events_getEventStats(void *arg)
+{
+    SDL_EventFilter old_filter = NULL;
+    void *old_userdata = NULL;
+    SDL_Event event, events[2];
+    SDL_PropertiesID props, all_props;
+    Sint64 pushed, filtered, popped, value;
+    Uint64 before;
+    int result;
+
+    SDL_FlushEvents(SDL_EVENT_FIRST, SDL_EVENT_LAST);
+
+    props = SDL_GetEventStats(SDL_EVENT_USER);
+    SDLTest_AssertPass("Call to SDL_GetEventStats(SDL_EVENT_USER)");
+    SDLTest_AssertCheck(props != 0, "Check result is a valid property ID, got %" SDL_PRIu32, props);
+    pushed = SDL_GetNumberProperty(props, SDL_PROP_EVENT_STATS_PUSHED_NUMBER, -1);
+    filtered = SDL_GetNumberProperty(props, SDL_PROP_EVENT_STATS_FILTERED_NUMBER, -1);
+    popped = SDL_GetNumberProperty(props, SDL_PROP_EVENT_STATS_POPPED_NUMBER, -1);
+    SDLTest_AssertCheck(pushed >= 0 && filtered >= 0 && popped >= 0, "Check counters are present");
+    SDL_DestroyProperties(props);
+
+    SDL_GetEventFilter(&old_filter, &old_userdata);
+    SDL_SetEventFilter(events_rejectingEventFilter, NULL);
+
+    SDL_zero(event);
+    event.type = SDL_EVENT_USER;
+    event.common.timestamp = 1;
+    SDL_PushEvent(&event);
+    event.common.timestamp = 0;
+    SDL_PushEvent(&event);
+    SDL_PushEvent(&event);
+    event.user.code = 1;
+    SDL_PushEvent(&event);
+    SDLTest_AssertPass("Call to SDL_PushEvent() 4 times, one of which is filtered");
+
+    SDL_SetEventFilter(old_filter, old_userdata);
+
+    before = SDL_GetTicksNS();
+    result = SDL_PeepEvents(events, SDL_arraysize(events), SDL_GETEVENT, SDL_EVENT_USER, SDL_EVENT_USER);
+    SDLTest_AssertCheck(result == 2, "Check SDL_PeepEvents() result, expected: 2, got: %d", result);
+
+    props = SDL_GetEventStats(SDL_EVENT_USER);
+    SDLTest_AssertPass("Call to SDL_GetEventStats(SDL_EVENT_USER)");
+    value = SDL_GetNumberProperty(props, SDL_PROP_EVENT_STATS_PUSHED_NUMBER, -1) - pushed;
+    SDLTest_AssertCheck(value == 3, "Check pushed events, expected: 3, got: %" SDL_PRIs64, value);
+    value = SDL_GetNumberProperty(props, SDL_PROP_EVENT_STATS_FILTERED_NUMBER, -1) - filtered;
+    SDLTest_AssertCheck(value == 1, "Check filtered events, expected: 1, got: %" SDL_PRIs64, value);
+    value = SDL_GetNumberProperty(props, SDL_PROP_EVENT_STATS_POPPED_NUMBER, -1) - popped;
+    SDLTest_AssertCheck(value == 2, "Check popped events, expected: 2, got: %" SDL_PRIs64, value);
+    value = SDL_GetNumberProperty(props, SDL_PROP_EVENT_STATS_LATENCY_MAX_NUMBER, -1);
+    SDLTest_AssertCheck(value >= (Sint64)before - 1, "Check maximum latency, expected at least: %" SDL_PRIu64 ", got: %" SDL_PRIs64, before - 1, value);
+    value = SDL_GetNumberProperty(props, SDL_PROP_EVENT_STATS_QUEUED_NUMBER, -1);
+    SDLTest_AssertCheck(value >= 1, "Check queued events, expected at least 1, got: %" SDL_PRIs64, value);
+    value = SDL_GetNumberProperty(props, SDL_PROP_EVENT_STATS_MAX_QUEUED_NUMBER, -1);
+    SDLTest_AssertCheck(value >= 1, "Check maximum queued events, expected at least 1, got: %" SDL_PRIs64, value);
+
+    all_props = SDL_GetEventStats(0);
+    SDLTest_AssertPass("Call to SDL_GetEventStats(0)");
+    SDLTest_AssertCheck(all_props != props, "Check every call returns a new group");
+    value = SDL_GetNumberProperty(all_props, SDL_PROP_EVENT_STATS_PUSHED_NUMBER, -1);
+    SDLTest_AssertCheck(value >= pushed + 3, "Check pushed events for all types, expected at least: %" SDL_PRIs64 ", got: %" SDL_PRIs64, pushed + 3, value);
+    value = SDL_GetNumberProperty(props, SDL_PROP_EVENT_STATS_PUSHED_NUMBER, -1) - pushed;
+    SDLTest_AssertCheck(value == 3, "Check earlier stats are unchanged by a later call, expected: 3, got: %" SDL_PRIs64, value);
+    SDL_DestroyProperties(all_props);
+    SDL_DestroyProperties(props);
+
+    SDL_FlushEvents(SDL_EVENT_FIRST, SDL_EVENT_LAST);
+    return TEST_COMPLETED;
+}
+
+/**
+ * Records events to a stream and replays them.
+ *
+ * \sa SDLTest_StartEventRecording
+ * \sa SDLTest_StartEventReplay
+ */
+static int SDLCALL events_recordAndReplay(void *arg)
+{
+    SDL_IOStream *io;
+    SDL_Event event, events[4];
+    Uint64 start;
+    bool result;
+    int count;
+
+    SDL_FlushEvents(SDL_EVENT_FIRST, SDL_EVENT_LAST);
+
+    io = SDL_IOFromDynamicMem();
+    SDLTest_AssertCheck(io != NULL, "Check SDL_IOFromDynamicMem() result");
+    if (!io) {
+        return TEST_ABORTED;
+    }
+
+    result = SDLTest_StartEventRecording(io, false);
+    SDLTest_AssertCheck(result, "Call to SDLTest_StartEventRecording(), got: %s", result ? "true" : SDL_GetError());
+
+    SDL_zero(event);
+    event.type = SDL_EVENT_USER;
+    event.user.code = 42;
+    event.user.data1 = &g_userdataValue1;
+    SDL_PushEvent(&event);
+    SDL_zero(event);
+    event.type = SDL_EVENT_TEXT_INPUT;
+    event.text.text = "replayed text";
+    SDL_PushEvent(&event);
+    SDL_zero(event);
+    event.type = SDL_EVENT_DROP_FILE;
+    event.drop.data = "file.txt";
+    SDL_PushEvent(&event);
+    SDLTest_AssertPass("Call to SDL_PushEvent() 3 times");
+
+    result = SDLTest_StopEventRecording();
+    SDLTest_AssertCheck(result, "Call to SDLTest_StopEventRecording(), got: %s", result ? "true" : SDL_GetError());
+
+    SDL_FlushEvents(SDL_EVENT_FIRST, SDL_EVENT_LAST);
+    SDL_SeekIO(io, 0, SDL_IO_SEEK_SET);
+
+    result = SDLTest_StartEventReplay(io, true, 100.0f);
+    SDLTest_AssertCheck(result, "Call to SDLTest_StartEventReplay(), got: %s", result ? "true" : SDL_GetError());
+    start = SDL_GetTicks();
+    while (!SDLTest_IsEventReplayDone() && SDL_GetTicks() - start < 5000) {
+        SDL_Delay(1);
+    }
+    SDLTest_AssertCheck(SDLTest_IsEventReplayDone(), "Check the replay is done");
+
+    count = SDL_PeepEvents(events, SDL_arraysize(events), SDL_GETEVENT, SDL_EVENT_FIRST, SDL_EVENT_LAST);
+    SDLTest_AssertCheck(count == 3, "Check replayed events, expected: 3, got: %d", count);
+    if (count == 3) {
+        SDLTest_AssertCheck(events[0].type == SDL_EVENT_USER && events[0].user.code == 42 && events[0].user.data1 == NULL,
+                            "Check the user event was replayed without its data pointer");
+        SDLTest_AssertCheck(events[1].type == SDL_EVENT_TEXT_INPUT && events[1].text.text && SDL_strcmp(events[1].text.text, "replayed text") == 0,
+                            "Check the text input event was replayed with its text");
+        SDLTest_AssertCheck(events[2].type == SDL_EVENT_DROP_FILE && !events[2].drop.source && events[2].drop.data && SDL_strcmp(events[2].drop.data, "file.txt") == 0,
+                            "Check the drop event was replayed with its file name");
+        SDLTest_AssertCheck(events[0].common.timestamp <= events[1].common.timestamp && events[1].common.timestamp <= events[2].common.timestamp,
+                            "Check the replayed events are in order");
+    }
+
+    SDLTest_StopEventReplay();
+    SDLTest_AssertPass("Call to SDLTest_StopEventReplay()");
+
+    return TEST_COMPLETED;
+}
+
 /**
  * Runs callbacks on the main thread.
  *
@@ -308,6 +586,152 @@ static int SDLCALL events_mainThreadCallbacks(void *arg)
     return TEST_COMPLETED;
 }
 
+static void PushTestMotionEvents(void)
+{
+    SDL_Event event;
+
+    SDL_zero(event);
+    event.type = SDL_EVENT_MOUSE_MOTION;
+    event.motion.which = 1;
+    event.motion.xrel = 1.0f;
+    event.motion.yrel = -1.0f;
+    SDL_PushEvent(&event);
+    event.motion.xrel = 2.0f;
+    SDL_PushEvent(&event);
+
+    SDL_zero(event);
+    event.type = SDL_EVENT_GAMEPAD_AXIS_MOTION;
+    event.gaxis.which = 5;
+    event.gaxis.axis = SDL_GAMEPAD_AXIS_LEFTX;
+    event.gaxis.value = 100;
+    SDL_PushEvent(&event);
+    event.gaxis.axis = SDL_GAMEPAD_AXIS_LEFTY;
+    event.gaxis.value = 7;
+    SDL_PushEvent(&event);
+    event.gaxis.axis = SDL_GAMEPAD_AXIS_LEFTX;
+    event.gaxis.value = 200;
+    SDL_PushEvent(&event);
+
+    SDL_zero(event);
+    event.type = SDL_EVENT_MOUSE_MOTION;
+    event.motion.which = 1;
+    event.motion.x = 30.0f;
+    event.motion.xrel = 3.0f;
+    SDL_PushEvent(&event);
+
+    SDL_zero(event);
+    event.type = SDL_EVENT_MOUSE_BUTTON_DOWN;
+    event.button.which = 1;
+    event.button.button = SDL_BUTTON_LEFT;
+    event.button.down = true;
+    SDL_PushEvent(&event);
+
+    SDL_zero(event);
+    event.type = SDL_EVENT_MOUSE_MOTION;
+    event.motion.which = 1;
+    event.motion.xrel = 4.0f;
+    SDL_PushEvent(&event);
+
+    SDL_zero(event);
+    event.type = SDL_EVENT_USER;
+    SDL_PushEvent(&event);
+}
+
+/**
+ * Retrieves several events at once with SDL_PollEvents()
+ *
+ * \sa SDL_PollEvents
+ */
+static int SDLCALL events_pollEvents(void *arg)
+{
+    static const SDL_EventTypeRange ranges[] = {
+        { SDL_EVENT_MOUSE_MOTION, SDL_EVENT_MOUSE_BUTTON_DOWN },
+        { SDL_EVENT_GAMEPAD_AXIS_MOTION, SDL_EVENT_GAMEPAD_AXIS_MOTION },
+        { SDL_EVENT_USER, SDL_EVENT_USER }
+    };
+    static const SDL_EventTypeRange user_range = { SDL_EVENT_USER, SDL_EVENT_USER };
+    static const SDL_EventTypeRange motion_range = { SDL_EVENT_MOUSE_MOTION, SDL_EVENT_MOUSE_MOTION };
+    SDL_Event events[16];
+    SDL_Event event;
+    int result;
+
+    SDL_FlushEvents(SDL_EVENT_FIRST, SDL_EVENT_LAST);
+
+    /* Without coalescing, events come out in order, a limited number at a time */
+    PushTestMotionEvents();
+    result = SDL_PollEvents(events, 3, ranges, SDL_arraysize(ranges), 0);
+    SDLTest_AssertPass("Call to SDL_PollEvents(events, 3, ranges, 3, 0)");
+    SDLTest_AssertCheck(result == 3, "Check result, expected: 3, got: %d", result);
+    SDLTest_AssertCheck(events[0].type == SDL_EVENT_MOUSE_MOTION && events[0].motion.xrel == 1.0f, "Check first event is the first mouse motion");
+    SDLTest_AssertCheck(events[1].type == SDL_EVENT_MOUSE_MOTION && events[1].motion.xrel == 2.0f, "Check second event is the second mouse motion");
+    SDLTest_AssertCheck(events[2].type == SDL_EVENT_GAMEPAD_AXIS_MOTION && events[2].gaxis.value == 100, "Check third event is the first gamepad axis motion");
+    result = SDL_PollEvents(events, SDL_arraysize(events), ranges, SDL_arraysize(ranges), 0);
+    SDLTest_AssertPass("Call to SDL_PollEvents(events, 16, ranges, 3, 0)");
+    SDLTest_AssertCheck(result == 6, "Check result, expected: 6, got: %d", result);
+
+    /* Only the requested types are taken out of the queue */
+    PushTestMotionEvents();
+    result = SDL_PollEvents(events, SDL_arraysize(events), &user_range, 1, 0);
+    SDLTest_AssertPass("Call to SDL_PollEvents(events, 16, &user_range, 1, 0)");
+    SDLTest_AssertCheck(result == 1 && events[0].type == SDL_EVENT_USER, "Check only the user event was retrieved, got %d events", result);
+    SDLTest_AssertCheck(SDL_HasEvent(SDL_EVENT_MOUSE_BUTTON_DOWN), "Check the other events are still queued");
+    SDL_FlushEvents(SDL_EVENT_FIRST, SDL_EVENT_LAST);
+
+    /* Motion is merged, but not across other events */
+    PushTestMotionEvents();
+    result = SDL_PollEvents(events, SDL_arraysize(events), ranges, SDL_arraysize(ranges), SDL_POLLEVENTS_COALESCE_MOTION);
+    SDLTest_AssertPass("Call to SDL_PollEvents(events, 16, ranges, 3, SDL_POLLEVENTS_COALESCE_MOTION)");
+    SDLTest_AssertCheck(result == 6, "Check result, expected: 6, got: %d", result);
+    if (result == 6) {
+        SDLTest_AssertCheck(events[0].type == SDL_EVENT_MOUSE_MOTION, "Check event 0 is mouse motion, got 0x%" SDL_PRIx32, events[0].type);
+        SDLTest_AssertCheck(events[0].motion.x == 30.0f && events[0].motion.xrel == 6.0f && events[0].motion.yrel == -2.0f,
+                            "Check mouse motion is merged, expected x: 30, xrel: 6, yrel: -2, got x: %g, xrel: %g, yrel: %g",
+                            events[0].motion.x, events[0].motion.xrel, events[0].motion.yrel);
+        SDLTest_AssertCheck(events[1].type == SDL_EVENT_GAMEPAD_AXIS_MOTION && events[1].gaxis.axis == SDL_GAMEPAD_AXIS_LEFTX && events[1].gaxis.value == 200,
+                            "Check event 1 is the latest motion of the first axis");
+        SDLTest_AssertCheck(events[2].type == SDL_EVENT_GAMEPAD_AXIS_MOTION && events[2].gaxis.axis == SDL_GAMEPAD_AXIS_LEFTY && events[2].gaxis.value == 7,
+                            "Check event 2 is the motion of the second axis");
+        SDLTest_AssertCheck(events[3].type == SDL_EVENT_MOUSE_BUTTON_DOWN, "Check event 3 is the mouse button press, got 0x%" SDL_PRIx32, events[3].type);
+        SDLTest_AssertCheck(events[4].type == SDL_EVENT_MOUSE_MOTION && events[4].motion.xrel == 4.0f, "Check event 4 is the mouse motion after the button press");
+        SDLTest_AssertCheck(events[5].type == SDL_EVENT_USER, "Check event 5 is the user event, got 0x%" SDL_PRIx32, events[5].type);
+    }
+
+    /* Merging continues once the buffer is full */
+    PushTestMotionEvents();
+    result = SDL_PollEvents(events, 1, ranges, SDL_arraysize(ranges), SDL_POLLEVENTS_COALESCE_MOTION);
+    SDLTest_AssertPass("Call to SDL_PollEvents(events, 1, ranges, 3, SDL_POLLEVENTS_COALESCE_MOTION)");
+    SDLTest_AssertCheck(result == 1 && events[0].motion.xrel == 3.0f, "Check result, expected: 1 event with xrel 3, got: %d", result);
+    SDLTest_AssertCheck(SDL_HasEvent(SDL_EVENT_GAMEPAD_AXIS_MOTION), "Check the gamepad events are still queued");
+    SDL_FlushEvents(SDL_EVENT_FIRST, SDL_EVENT_LAST);
+
+    /* Events left in the queue still end a run of motion */
+    PushTestMotionEvents();
+    result = SDL_PollEvents(events, SDL_arraysize(events), &motion_range, 1, SDL_POLLEVENTS_COALESCE_MOTION);
+    SDLTest_AssertPass("Call to SDL_PollEvents(events, 16, &motion_range, 1, SDL_POLLEVENTS_COALESCE_MOTION)");
+    SDLTest_AssertCheck(result == 3, "Check result, expected: 3, got: %d", result);
+    if (result == 3) {
+        SDLTest_AssertCheck(events[0].motion.xrel == 3.0f, "Check the motion before the gamepad events is merged, expected xrel: 3, got: %g", events[0].motion.xrel);
+        SDLTest_AssertCheck(events[1].motion.xrel == 3.0f, "Check the motion after the gamepad events is separate, expected xrel: 3, got: %g", events[1].motion.xrel);
+        SDLTest_AssertCheck(events[2].motion.xrel == 4.0f, "Check the motion after the button press is separate, expected xrel: 4, got: %g", events[2].motion.xrel);
+    }
+    SDLTest_AssertCheck(SDL_HasEvent(SDL_EVENT_MOUSE_BUTTON_DOWN), "Check the button press is still queued");
+    SDL_FlushEvents(SDL_EVENT_FIRST, SDL_EVENT_LAST);
+
+    /* A pending SDL_PollEvent() cycle is left alone */
+    SDL_zero(event);
+    event.type = SDL_EVENT_USER;
+    SDL_PushEvent(&event);
+    SDL_PollEvent(&event);
+    SDL_PushEvent(&event);
+    result = SDL_PollEvents(events, SDL_arraysize(events), NULL, 0, 0);
+    SDLTest_AssertPass("Call to SDL_PollEvents(events, 16, NULL, 0, 0)");
+    SDLTest_AssertCheck(result == 1 && events[0].type == SDL_EVENT_USER, "Check the sentinel isn't returned, got %d events", result);
+    SDLTest_AssertCheck(SDL_HasEvent(SDL_EVENT_POLL_SENTINEL), "Check the sentinel is still queued");
+
+    SDL_FlushEvents(SDL_EVENT_FIRST, SDL_EVENT_LAST);
+    return TEST_COMPLETED;
+}
+
 /* ================= Test References ================== */
 
 /* Events test cases */
@@ -328,11 +752,36 @@ static const SDLTest_TestCaseReference eventsTest_mainThreadCallbacks = {
 };
 
 /* Sequence of Events test cases */
+static const SDLTest_TestCaseReference eventsTest_addDelEventWatchReentrant = {
+    events_addDelEventWatchReentrant, "events_addDelEventWatchReentrant", "Adds and removes event watches from within an event watch", TEST_ENABLED
+};
+
+static const SDLTest_TestCaseReference eventsTest_delEventWatchWhileRunning = {
+    events_delEventWatchWhileRunning, "events_delEventWatchWhileRunning", "Removes an event watch while it's running on another thread", TEST_ENABLED
+};
+
+static const SDLTest_TestCaseReference eventsTest_getEventStats = {
+    events_getEventStats, "events_getEventStats", "Checks the event statistics", TEST_ENABLED
+};
+
+static const SDLTest_TestCaseReference eventsTest_recordAndReplay = {
+    events_recordAndReplay, "events_recordAndReplay", "Records events to a stream and replays them", TEST_ENABLED
+};
+
+static const SDLTest_TestCaseReference eventsTest_pollEvents = {
+    events_pollEvents, "events_pollEvents", "Retrieve several events at once with SDL_PollEvents", TEST_ENABLED
+};
+
 static const SDLTest_TestCaseReference *eventsTests[] = {
     &eventsTest_pushPumpAndPollUserevent,
     &eventsTest_addDelEventWatch,
     &eventsTest_addDelEventWatchWithUserdata,
     &eventsTest_mainThreadCallbacks,
+    &eventsTest_pollEvents,
+    &eventsTest_addDelEventWatchReentrant,
+    &eventsTest_delEventWatchWhileRunning,
+    &eventsTest_getEventStats,
+    &eventsTest_recordAndReplay,
     NULL
 };
 
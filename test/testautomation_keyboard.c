@@ -35,6 +35,124 @@ static int SDLCALL keyboard_getKeyboardState(void *arg)
     return TEST_COMPLETED;
 }
 
+/**
+ * Check call to SDL_GetKeyboardSnapshot and that it matches SDL_GetKeyboardState.
+ *
+ * \sa SDL_GetKeyboardSnapshot
+ */
+static int SDLCALL keyboard_getKeyboardSnapshot(void *arg)
+{
+    SDL_KeyboardSnapshot snapshot;
+    const bool *state;
+    int numkeys, i, mismatches = 0, changes = 0;
+    bool result;
+
+    SDL_ResetKeyboard();
+    SDLTest_AssertPass("Call to SDL_ResetKeyboard()");
+
+    /* Clear anything pressed or released before this test */
+    result = SDL_GetKeyboardSnapshot(&snapshot);
+    SDLTest_AssertPass("Call to SDL_GetKeyboardSnapshot()");
+    SDLTest_AssertCheck(result == true, "Validate result value, expected: true, got: %i", result);
+
+    result = SDL_GetKeyboardSnapshot(&snapshot);
+    SDLTest_AssertPass("Call to SDL_GetKeyboardSnapshot()");
+    SDLTest_AssertCheck(result == true, "Validate result value, expected: true, got: %i", result);
+
+    state = SDL_GetKeyboardState(&numkeys);
+    for (i = 0; i < numkeys; ++i) {
+        if (SDL_KEYBOARD_SNAPSHOT_TEST(snapshot.down, i) != state[i]) {
+            ++mismatches;
+        }
+        if (SDL_KEYBOARD_SNAPSHOT_TEST(snapshot.pressed, i) || SDL_KEYBOARD_SNAPSHOT_TEST(snapshot.released, i)) {
+            ++changes;
+        }
+    }
+    SDLTest_AssertCheck(mismatches == 0, "Validate that snapshot matches SDL_GetKeyboardState(), got %d mismatches", mismatches);
+    SDLTest_AssertCheck(changes == 0, "Validate that no keys changed since the previous snapshot, got %d changes", changes);
+
+    result = SDL_GetKeyboardSnapshot(NULL);
+    SDLTest_AssertPass("Call to SDL_GetKeyboardSnapshot(NULL)");
+    SDLTest_AssertCheck(result == false, "Validate result value, expected: false, got: %i", result);
+
+    return TEST_COMPLETED;
+}
+
+/**
+ * Check that SDL_GetKeyboardSnapshot reports keys pressed and released in between.
+ *
+ * This relies on the dummy video driver pressing and releasing the keys set in
+ * internal window properties when events are pumped, which testautomation
+ * enables with the SDL_VIDEO_DUMMY_TEST_HOOKS hint.
+ *
+ * \sa SDL_GetKeyboardSnapshot
+ */
+static int SDLCALL keyboard_getKeyboardSnapshotKeys(void *arg)
+{
+    SDL_KeyboardSnapshot snapshot;
+    SDL_PropertiesID props;
+    SDL_Window *window;
+    const bool *state;
+
+    if (SDL_strcmp(SDL_GetCurrentVideoDriver(), "dummy") != 0 ||
+        !SDL_GetHintBoolean("SDL_VIDEO_DUMMY_TEST_HOOKS", false)) {
+        SDLTest_Log("Skipping test, it needs the dummy video driver test hooks");
+        return TEST_SKIPPED;
+    }
+
+    window = SDL_CreateWindow("keyboard_getKeyboardSnapshotKeys", 320, 240, 0);
+    SDLTest_AssertCheck(window != NULL, "Check SDL_CreateWindow result");
+    if (!window) {
+        return TEST_ABORTED;
+    }
+    props = SDL_GetWindowProperties(window);
+    state = SDL_GetKeyboardState(NULL);
+
+    SDL_ResetKeyboard();
+    SDL_GetKeyboardSnapshot(&snapshot);
+
+    /* Press a key */
+    SDL_SetNumberProperty(props, "SDL.internal.window.dummy.key_down", SDL_SCANCODE_A);
+    SDL_PumpEvents();
+    SDL_GetKeyboardSnapshot(&snapshot);
+    SDLTest_AssertPass("Call to SDL_GetKeyboardSnapshot() after pressing A");
+    SDLTest_AssertCheck(state[SDL_SCANCODE_A], "Validate that A is down in SDL_GetKeyboardState()");
+    SDLTest_AssertCheck(SDL_KEYBOARD_SNAPSHOT_TEST(snapshot.down, SDL_SCANCODE_A), "Validate that A is down in the snapshot");
+    SDLTest_AssertCheck(SDL_KEYBOARD_SNAPSHOT_TEST(snapshot.pressed, SDL_SCANCODE_A), "Validate that A is pressed in the snapshot");
+    SDLTest_AssertCheck(!SDL_KEYBOARD_SNAPSHOT_TEST(snapshot.released, SDL_SCANCODE_A), "Validate that A isn't released in the snapshot");
+
+    /* The next snapshot only has what changed since the previous one */
+    SDL_GetKeyboardSnapshot(&snapshot);
+    SDLTest_AssertCheck(SDL_KEYBOARD_SNAPSHOT_TEST(snapshot.down, SDL_SCANCODE_A), "Validate that A is still down in the next snapshot");
+    SDLTest_AssertCheck(!SDL_KEYBOARD_SNAPSHOT_TEST(snapshot.pressed, SDL_SCANCODE_A), "Validate that A isn't pressed again in the next snapshot");
+
+    /* Release it */
+    SDL_SetNumberProperty(props, "SDL.internal.window.dummy.key_up", SDL_SCANCODE_A);
+    SDL_PumpEvents();
+    SDL_GetKeyboardSnapshot(&snapshot);
+    SDLTest_AssertPass("Call to SDL_GetKeyboardSnapshot() after releasing A");
+    SDLTest_AssertCheck(!state[SDL_SCANCODE_A], "Validate that A is up in SDL_GetKeyboardState()");
+    SDLTest_AssertCheck(!SDL_KEYBOARD_SNAPSHOT_TEST(snapshot.down, SDL_SCANCODE_A), "Validate that A is up in the snapshot");
+    SDLTest_AssertCheck(!SDL_KEYBOARD_SNAPSHOT_TEST(snapshot.pressed, SDL_SCANCODE_A), "Validate that A isn't pressed in the snapshot");
+    SDLTest_AssertCheck(SDL_KEYBOARD_SNAPSHOT_TEST(snapshot.released, SDL_SCANCODE_A), "Validate that A is released in the snapshot");
+
+    /* Press and release between two snapshots */
+    SDL_SetNumberProperty(props, "SDL.internal.window.dummy.key_down", SDL_SCANCODE_B);
+    SDL_SetNumberProperty(props, "SDL.internal.window.dummy.key_up", SDL_SCANCODE_B);
+    SDL_PumpEvents();
+    SDL_GetKeyboardSnapshot(&snapshot);
+    SDLTest_AssertPass("Call to SDL_GetKeyboardSnapshot() after pressing and releasing B");
+    SDLTest_AssertCheck(!SDL_KEYBOARD_SNAPSHOT_TEST(snapshot.down, SDL_SCANCODE_B), "Validate that B is up in the snapshot");
+    SDLTest_AssertCheck(SDL_KEYBOARD_SNAPSHOT_TEST(snapshot.pressed, SDL_SCANCODE_B), "Validate that B is pressed in the snapshot");
+    SDLTest_AssertCheck(SDL_KEYBOARD_SNAPSHOT_TEST(snapshot.released, SDL_SCANCODE_B), "Validate that B is released in the snapshot");
+    SDLTest_AssertCheck(!SDL_KEYBOARD_SNAPSHOT_TEST(snapshot.released, SDL_SCANCODE_A), "Validate that A isn't released again in the snapshot");
+
+    SDL_DestroyWindow(window);
+    SDL_FlushEvents(SDL_EVENT_FIRST, SDL_EVENT_LAST);
+
+    return TEST_COMPLETED;
+}
+
 /**
  * Check call to SDL_GetKeyboardFocus
  *
@@ -615,6 +733,14 @@ static const SDLTest_TestCaseReference keyboardTestGetKeyboardState = {
     keyboard_getKeyboardState, "keyboard_getKeyboardState", "Check call to SDL_GetKeyboardState with and without numkeys reference", TEST_ENABLED
 };
 
+static const SDLTest_TestCaseReference keyboardTestGetKeyboardSnapshot = {
+    keyboard_getKeyboardSnapshot, "keyboard_getKeyboardSnapshot", "Check call to SDL_GetKeyboardSnapshot", TEST_ENABLED
+};
+
+static const SDLTest_TestCaseReference keyboardTestGetKeyboardSnapshotKeys = {
+    keyboard_getKeyboardSnapshotKeys, "keyboard_getKeyboardSnapshotKeys", "Check that SDL_GetKeyboardSnapshot reports pressed and released keys", TEST_ENABLED
+};
+
 static const SDLTest_TestCaseReference keyboardTestGetKeyboardFocus = {
     keyboard_getKeyboardFocus, "keyboard_getKeyboardFocus", "Check call to SDL_GetKeyboardFocus", TEST_ENABLED
 };
@@ -666,6 +792,8 @@ static const SDLTest_TestCaseReference keyboardTestGetScancodeNameNegative = {
 /* Sequence of Keyboard test cases */
 static const SDLTest_TestCaseReference *keyboardTests[] = {
     &keyboardTestGetKeyboardState,
+    &keyboardTestGetKeyboardSnapshot,
+    &keyboardTestGetKeyboardSnapshotKeys,
     &keyboardTestGetKeyboardFocus,
     &keyboardTestGetKeyFromName,
     &keyboardTestGetKeyFromScancode,
@@ -612,6 +612,32 @@ static int SDLCALL mouse_getGlobalMouseState(void *arg)
     return TEST_COMPLETED;
 }
 
+/**
+ * Check call to SDL_GetMouseSamples
+ *
+ * \sa SDL_GetMouseSamples
+ */
+static int SDLCALL mouse_getMouseSamples(void *arg)
+{
+    SDL_MouseSample samples[16];
+    int result;
+
+    /* Without SDL_HINT_MOUSE_SAMPLE_BUFFER_SIZE no samples are kept */
+    result = SDL_GetMouseSamples(NULL, 0);
+    SDLTest_AssertPass("Call to SDL_GetMouseSamples(NULL, 0)");
+    SDLTest_AssertCheck(result >= 0, "Validate result value is >= 0, got: %d", result);
+
+    result = SDL_GetMouseSamples(samples, SDL_arraysize(samples));
+    SDLTest_AssertPass("Call to SDL_GetMouseSamples(samples, 16)");
+    SDLTest_AssertCheck(result >= 0 && result <= (int)SDL_arraysize(samples), "Validate result value is in [0, 16], got: %d", result);
+
+    result = SDL_GetMouseSamples(samples, -1);
+    SDLTest_AssertPass("Call to SDL_GetMouseSamples(samples, -1)");
+    SDLTest_AssertCheck(result == -1, "Validate result value is -1, got: %d", result);
+
+    return TEST_COMPLETED;
+}
+
 /* ================= Test References ================== */
 
 /* Mouse test cases */
@@ -663,6 +689,10 @@ static const SDLTest_TestCaseReference mouseTestGetGlobalMouseState = {
     mouse_getGlobalMouseState, "mouse_getGlobalMouseState", "Check call to SDL_GetGlobalMouseState", TEST_ENABLED
 };
 
+static const SDLTest_TestCaseReference mouseTestGetMouseSamples = {
+    mouse_getMouseSamples, "mouse_getMouseSamples", "Check call to SDL_GetMouseSamples", TEST_ENABLED
+};
+
 /* Sequence of Mouse test cases */
 static const SDLTest_TestCaseReference *mouseTests[] = {
     &mouseTestGetMouseState,
@@ -677,6 +707,7 @@ static const SDLTest_TestCaseReference *mouseTests[] = {
     &mouseTestGetSetRelativeMouseMode,
     &mouseTestGetDefaultCursor,
     &mouseTestGetGlobalMouseState,
+    &mouseTestGetMouseSamples,
     NULL
 };
 
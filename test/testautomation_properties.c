@@ -382,6 +382,107 @@ static int SDLCALL properties_testLocking(void *arg)
     return TEST_COMPLETED;
 }
 
+/**
+ * Test interned property names
+ */
+static int SDLCALL properties_testAtoms(void *arg)
+{
+    SDL_PropertiesID props;
+    SDL_PropertyAtom foo, bar;
+    const char *name;
+    int count;
+
+    foo = SDL_GetPropertyAtom("foo");
+    SDLTest_AssertPass("Call to SDL_GetPropertyAtom(\"foo\")");
+    SDLTest_AssertCheck(foo != 0,
+        "Verify atom is not 0, got: %" SDL_PRIu32, foo);
+    SDLTest_AssertCheck(SDL_GetPropertyAtom("foo") == foo,
+        "Verify the same name gives the same atom");
+    bar = SDL_GetPropertyAtom("bar");
+    SDLTest_AssertCheck(bar != 0 && bar != foo,
+        "Verify a different name gives a different atom, got: %" SDL_PRIu32 " and %" SDL_PRIu32, foo, bar);
+    SDLTest_AssertCheck(SDL_GetPropertyAtom(NULL) == 0,
+        "Verify a NULL name gives no atom");
+    SDLTest_AssertCheck(SDL_GetPropertyAtom("") == 0,
+        "Verify an empty name gives no atom");
+
+    name = SDL_GetPropertyAtomName(foo);
+    SDLTest_AssertCheck(name && SDL_strcmp(name, "foo") == 0,
+        "Verify atom name, expected \"foo\", got: %s", name ? name : "NULL");
+    name = SDL_GetPropertyAtomName(0);
+    SDLTest_AssertCheck(name == NULL,
+        "Verify atom 0 has no name");
+
+    props = SDL_CreateProperties();
+    SDLTest_AssertPass("Call to SDL_CreateProperties()");
+    SDLTest_AssertCheck(props != 0,
+        "Verify props were created, got: %" SDL_PRIu32, props);
+
+    /* Values set by atom can be read by name, and the other way around */
+    SDL_SetNumberPropertyByAtom(props, foo, 1);
+    SDLTest_AssertCheck(SDL_GetNumberProperty(props, "foo", 0) == 1,
+        "Verify number property set by atom can be read by name");
+    SDL_SetNumberProperty(props, "bar", 2);
+    SDLTest_AssertCheck(SDL_GetNumberPropertyByAtom(props, bar, 0) == 2,
+        "Verify number property set by name can be read by atom");
+    SDLTest_AssertCheck(SDL_GetPropertyTypeByAtom(props, bar) == SDL_PROPERTY_TYPE_NUMBER,
+        "Verify property type by atom");
+
+    SDL_SetStringPropertyByAtom(props, foo, "1.5");
+    SDLTest_AssertCheck(SDL_strcmp(SDL_GetStringPropertyByAtom(props, foo, ""), "1.5") == 0,
+        "Verify string property by atom");
+    SDLTest_AssertCheck(SDL_GetFloatPropertyByAtom(props, foo, 0.0f) == 1.5f,
+        "Verify string property by atom converts to float");
+    SDL_SetFloatPropertyByAtom(props, foo, 2.5f);
+    SDLTest_AssertCheck(SDL_GetFloatProperty(props, "foo", 0.0f) == 2.5f,
+        "Verify float property by atom");
+    SDL_SetBooleanPropertyByAtom(props, foo, true);
+    SDLTest_AssertCheck(SDL_GetBooleanPropertyByAtom(props, foo, false) == true,
+        "Verify boolean property by atom");
+    SDL_SetPointerPropertyByAtom(props, foo, &count);
+    SDLTest_AssertCheck(SDL_GetPointerPropertyByAtom(props, foo, NULL) == &count,
+        "Verify pointer property by atom");
+    SDLTest_AssertCheck(SDL_GetPointerPropertyByAtom(props, 0, &props) == &props,
+        "Verify atom 0 returns the default value");
+
+    /* Enumeration still gives out the names */
+    count = 0;
+    SDL_EnumerateProperties(props, count_foo_properties, &count);
+    SDLTest_AssertCheck(count == 1,
+        "Verify foo property is enumerated by name, got: %d", count);
+
+    SDL_ClearPropertyByAtom(props, foo);
+    SDLTest_AssertCheck(!SDL_HasProperty(props, "foo"),
+        "Verify property cleared by atom is gone");
+    SDLTest_AssertCheck(SDL_GetNumProperties(props) == 1,
+        "Verify property count after clear, got: %d", SDL_GetNumProperties(props));
+
+    /* Looking up a name that was never set doesn't make it exist */
+    SDLTest_AssertCheck(!SDL_HasProperty(props, "properties_testAtoms.unset"),
+        "Verify unset property doesn't exist");
+    SDLTest_AssertCheck(SDL_ClearProperty(props, "properties_testAtoms.unset"),
+        "Verify clearing an unset property succeeds");
+    SDLTest_AssertCheck(SDL_GetNumProperties(props) == 1,
+        "Verify property count after clearing an unset property, got: %d", SDL_GetNumProperties(props));
+
+    /* A property set by name before the name is interned is found by its atom afterwards */
+    SDL_SetNumberProperty(props, "properties_testAtoms.late", 3);
+    SDLTest_AssertCheck(SDL_GetNumberProperty(props, "properties_testAtoms.late", 0) == 3,
+        "Verify property set by a name that isn't interned");
+    foo = SDL_GetPropertyAtom("properties_testAtoms.late");
+    SDLTest_AssertCheck(SDL_GetNumberPropertyByAtom(props, foo, 0) == 3,
+        "Verify property set before its name was interned can be read by atom");
+    SDL_SetNumberPropertyByAtom(props, foo, 4);
+    SDLTest_AssertCheck(SDL_GetNumberProperty(props, "properties_testAtoms.late", 0) == 4,
+        "Verify property set by atom replaces the one set by name");
+    SDLTest_AssertCheck(SDL_GetNumProperties(props) == 2,
+        "Verify property count after replacing by atom, got: %d", SDL_GetNumProperties(props));
+
+    SDL_DestroyProperties(props);
+
+    return TEST_COMPLETED;
+}
+
 /* ================= Test References ================== */
 
 /* Properties test cases */
@@ -401,12 +502,17 @@ static const SDLTest_TestCaseReference propertiesTestLocking = {
     properties_testLocking, "properties_testLocking", "Test property locking functionality", TEST_ENABLED
 };
 
+static const SDLTest_TestCaseReference propertiesTestAtoms = {
+    properties_testAtoms, "properties_testAtoms", "Test interned property names", TEST_ENABLED
+};
+
 /* Sequence of Properties test cases */
 static const SDLTest_TestCaseReference *propertiesTests[] = {
     &propertiesTestBasic,
     &propertiesTestCopy,
     &propertiesTestCleanup,
     &propertiesTestLocking,
+    &propertiesTestAtoms,
     NULL
 };
 
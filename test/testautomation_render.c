@@ -1331,6 +1331,273 @@ static int SDLCALL render_testRGBSurfaceNoAlpha(void* arg)
     return TEST_COMPLETED;
 }
 
+/**
+ * Tests the anti-aliased drawing mode of the software renderer.
+ *
+ * \sa SDL_CreateRendererWithProperties
+ * \sa SDL_RenderGeometry
+ * \sa SDL_RenderLine
+ */
+static int SDLCALL render_testSoftwareAntialias(void *arg)
+{
+    static const int quad_indices[] = { 0, 1, 2, 0, 2, 3 };
+    SDL_Vertex vertices[4];
+    SDL_Surface *surface;
+    SDL_Renderer *software_renderer;
+    SDL_PropertiesID props;
+    bool result;
+    Uint8 r, g, b, a;
+    int i;
+
+    SDLTest_AssertPass("About to call SDL_CreateSurface(64, 32, SDL_PIXELFORMAT_XRGB8888)");
+    surface = SDL_CreateSurface(64, 32, SDL_PIXELFORMAT_XRGB8888);
+    SDLTest_AssertCheck(surface != NULL, "Returned surface must be not NULL");
+    if (surface == NULL) {
+        return TEST_ABORTED;
+    }
+
+    props = SDL_CreateProperties();
+    SDL_SetPointerProperty(props, SDL_PROP_RENDERER_CREATE_SURFACE_POINTER, surface);
+    SDL_SetBooleanProperty(props, SDL_PROP_RENDERER_CREATE_SOFTWARE_ANTIALIAS_BOOLEAN, true);
+    SDLTest_AssertPass("About to call SDL_CreateRendererWithProperties() with anti-aliasing");
+    software_renderer = SDL_CreateRendererWithProperties(props);
+    SDL_DestroyProperties(props);
+    SDLTest_AssertCheck(software_renderer != NULL, "Returned renderer must be not NULL");
+    if (software_renderer == NULL) {
+        SDL_DestroySurface(surface);
+        return TEST_ABORTED;
+    }
+
+    SDL_SetRenderDrawColor(software_renderer, 0, 0, 0, SDL_ALPHA_OPAQUE);
+    SDL_RenderClear(software_renderer);
+
+    // A triangle whose hypotenuse goes through the centers of the pixels with x + y = 31
+    SDL_zeroa(vertices);
+    for (i = 0; i < 4; i++) {
+        vertices[i].color.r = vertices[i].color.g = vertices[i].color.b = vertices[i].color.a = 1.0f;
+    }
+    vertices[0].position.x = 0.0f;
+    vertices[0].position.y = 0.0f;
+    vertices[1].position.x = 32.0f;
+    vertices[1].position.y = 0.0f;
+    vertices[2].position.x = 0.0f;
+    vertices[2].position.y = 32.0f;
+    SDLTest_AssertPass("About to call SDL_RenderGeometry() with a triangle");
+    result = SDL_RenderGeometry(software_renderer, NULL, vertices, 3, NULL, 0);
+    SDLTest_AssertCheck(result == true, "Result is %d, should be %d", result, true);
+
+    // A quad made of two triangles sharing a diagonal
+    vertices[0].position.x = 40.0f;
+    vertices[0].position.y = 8.0f;
+    vertices[1].position.x = 56.0f;
+    vertices[1].position.y = 8.0f;
+    vertices[2].position.x = 56.0f;
+    vertices[2].position.y = 24.0f;
+    vertices[3].position.x = 40.0f;
+    vertices[3].position.y = 24.0f;
+    SDLTest_AssertPass("About to call SDL_RenderGeometry() with a quad");
+    result = SDL_RenderGeometry(software_renderer, NULL, vertices, 4, quad_indices, SDL_arraysize(quad_indices));
+    SDLTest_AssertCheck(result == true, "Result is %d, should be %d", result, true);
+
+    // A line with a slope of 1/2
+    SDL_SetRenderDrawColor(software_renderer, 0xFF, 0xFF, 0xFF, SDL_ALPHA_OPAQUE);
+    SDLTest_AssertPass("About to call SDL_RenderLine()");
+    result = SDL_RenderLine(software_renderer, 40.0f, 0.0f, 50.0f, 5.0f);
+    SDLTest_AssertCheck(result == true, "Result is %d, should be %d", result, true);
+
+    SDL_RenderPresent(software_renderer);
+
+    SDL_ReadSurfacePixel(surface, 4, 4, &r, &g, &b, &a);
+    SDLTest_AssertCheck(r == 0xFF && g == 0xFF && b == 0xFF, "Pixel inside the triangle is {0x%02x,0x%02x,0x%02x}, should be white", r, g, b);
+    SDL_ReadSurfacePixel(surface, 24, 24, &r, &g, &b, &a);
+    SDLTest_AssertCheck(r == 0x00 && g == 0x00 && b == 0x00, "Pixel outside the triangle is {0x%02x,0x%02x,0x%02x}, should be black", r, g, b);
+    SDL_ReadSurfacePixel(surface, 15, 16, &r, &g, &b, &a);
+    SDLTest_AssertCheck(r > 0x40 && r < 0xC0 && r == g && g == b, "Pixel on the edge of the triangle is {0x%02x,0x%02x,0x%02x}, should be gray", r, g, b);
+
+    SDL_ReadSurfacePixel(surface, 48, 16, &r, &g, &b, &a);
+    SDLTest_AssertCheck(r == 0xFF && g == 0xFF && b == 0xFF, "Pixel on the diagonal of the quad is {0x%02x,0x%02x,0x%02x}, should be white", r, g, b);
+
+    SDL_ReadSurfacePixel(surface, 41, 0, &r, &g, &b, &a);
+    SDLTest_AssertCheck(r > 0x40 && r < 0xC0, "Pixel above the line is {0x%02x,0x%02x,0x%02x}, should be gray", r, g, b);
+    SDL_ReadSurfacePixel(surface, 41, 1, &r, &g, &b, &a);
+    SDLTest_AssertCheck(r > 0x40 && r < 0xC0, "Pixel below the line is {0x%02x,0x%02x,0x%02x}, should be gray", r, g, b);
+    SDL_ReadSurfacePixel(surface, 42, 1, &r, &g, &b, &a);
+    SDLTest_AssertCheck(r == 0xFF, "Pixel on the line is {0x%02x,0x%02x,0x%02x}, should be white", r, g, b);
+
+    // The same triangle in red at half opacity, blended over the white one
+    for (i = 0; i < 3; i++) {
+        vertices[i].color.g = vertices[i].color.b = 0.0f;
+        vertices[i].color.a = 0.5f;
+    }
+    vertices[0].position.x = 0.0f;
+    vertices[0].position.y = 0.0f;
+    vertices[1].position.x = 32.0f;
+    vertices[1].position.y = 0.0f;
+    vertices[2].position.x = 0.0f;
+    vertices[2].position.y = 32.0f;
+    SDL_SetRenderDrawBlendMode(software_renderer, SDL_BLENDMODE_BLEND);
+    SDLTest_AssertPass("About to call SDL_RenderGeometry() with a blended triangle");
+    result = SDL_RenderGeometry(software_renderer, NULL, vertices, 3, NULL, 0);
+    SDLTest_AssertCheck(result == true, "Result is %d, should be %d", result, true);
+    SDL_RenderPresent(software_renderer);
+
+    SDL_ReadSurfacePixel(surface, 4, 4, &r, &g, &b, &a);
+    SDLTest_AssertCheck(r == 0xFF && g >= 0x7E && g <= 0x81 && g == b, "Pixel inside the blended triangle is {0x%02x,0x%02x,0x%02x}, should be pink", r, g, b);
+    SDL_ReadSurfacePixel(surface, 24, 24, &r, &g, &b, &a);
+    SDLTest_AssertCheck(r == 0x00 && g == 0x00 && b == 0x00, "Pixel outside the blended triangle is {0x%02x,0x%02x,0x%02x}, should be black", r, g, b);
+
+    SDL_DestroyRenderer(software_renderer);
+    SDL_DestroySurface(surface);
+    return TEST_COMPLETED;
+}
+
+/**
+ * Tests rotated, flipped and color modulated copies with the software renderer
+ */
+static int SDLCALL render_testSoftwareCopyEx(void *arg)
+{
+    SDL_Surface *surface, *sprite;
+    SDL_Renderer *software_renderer;
+    SDL_Texture *texture;
+    SDL_Rect fill;
+    SDL_FRect rect;
+    bool result;
+    Uint8 r, g, b, a;
+
+    SDLTest_AssertPass("About to call SDL_CreateSurface(32, 32, SDL_PIXELFORMAT_XRGB8888)");
+    surface = SDL_CreateSurface(32, 32, SDL_PIXELFORMAT_XRGB8888);
+    SDLTest_AssertCheck(surface != NULL, "Returned surface must be not NULL");
+    if (surface == NULL) {
+        return TEST_ABORTED;
+    }
+
+    SDLTest_AssertPass("About to call SDL_CreateSoftwareRenderer()");
+    software_renderer = SDL_CreateSoftwareRenderer(surface);
+    SDLTest_AssertCheck(software_renderer != NULL, "Returned renderer must be not NULL");
+    if (software_renderer == NULL) {
+        SDL_DestroySurface(surface);
+        return TEST_ABORTED;
+    }
+
+    // A sprite in a different pixel format than the target, red on the left and green on the right
+    sprite = SDL_CreateSurface(4, 2, SDL_PIXELFORMAT_ABGR8888);
+    SDLTest_AssertCheck(sprite != NULL, "Returned surface must be not NULL");
+    if (sprite == NULL) {
+        SDL_DestroyRenderer(software_renderer);
+        SDL_DestroySurface(surface);
+        return TEST_ABORTED;
+    }
+    fill.x = 2;
+    fill.y = 0;
+    fill.w = 2;
+    fill.h = 2;
+    SDL_FillSurfaceRect(sprite, NULL, SDL_MapSurfaceRGBA(sprite, 0xFF, 0x00, 0x00, 0xFF));
+    SDL_FillSurfaceRect(sprite, &fill, SDL_MapSurfaceRGBA(sprite, 0x00, 0xFF, 0x00, 0xFF));
+    texture = SDL_CreateTextureFromSurface(software_renderer, sprite);
+    SDL_DestroySurface(sprite);
+    SDLTest_AssertCheck(texture != NULL, "Returned texture must be not NULL");
+    if (texture == NULL) {
+        SDL_DestroyRenderer(software_renderer);
+        SDL_DestroySurface(surface);
+        return TEST_ABORTED;
+    }
+    SDL_SetTextureScaleMode(texture, SDL_SCALEMODE_NEAREST);
+    SDL_SetTextureBlendMode(texture, SDL_BLENDMODE_BLEND);
+    SDL_SetTextureColorMod(texture, 0xFF, 0x80, 0xFF);
+    SDL_SetTextureAlphaMod(texture, 0x80);
+
+    SDL_SetRenderDrawColor(software_renderer, 0, 0, 0, SDL_ALPHA_OPAQUE);
+    SDL_RenderClear(software_renderer);
+
+    // Scaled up twice and rotated clockwise, the left half ends up on top
+    rect.x = 4.0f;
+    rect.y = 8.0f;
+    rect.w = 8.0f;
+    rect.h = 4.0f;
+    SDLTest_AssertPass("About to call SDL_RenderTextureRotated() with a rotation of 90 degrees");
+    result = SDL_RenderTextureRotated(software_renderer, texture, NULL, &rect, 90.0, NULL, SDL_FLIP_NONE);
+    SDLTest_AssertCheck(result == true, "Result is %d, should be %d", result, true);
+
+    // The same, flipped horizontally first
+    rect.x = 20.0f;
+    SDLTest_AssertPass("About to call SDL_RenderTextureRotated() with a rotation of 90 degrees and a horizontal flip");
+    result = SDL_RenderTextureRotated(software_renderer, texture, NULL, &rect, 90.0, NULL, SDL_FLIP_HORIZONTAL);
+    SDLTest_AssertCheck(result == true, "Result is %d, should be %d", result, true);
+
+    SDL_RenderPresent(software_renderer);
+
+    // Red and green are blended at half opacity, green is also halved by the color modulation
+    SDL_ReadSurfacePixel(surface, 8, 7, &r, &g, &b, &a);
+    SDLTest_AssertCheck(r == 0x80 && g == 0x00 && b == 0x00, "Pixel at the top of the rotated copy is {0x%02x,0x%02x,0x%02x}, should be {0x80,0x00,0x00}", r, g, b);
+    SDL_ReadSurfacePixel(surface, 8, 12, &r, &g, &b, &a);
+    SDLTest_AssertCheck(r == 0x00 && g == 0x40 && b == 0x00, "Pixel at the bottom of the rotated copy is {0x%02x,0x%02x,0x%02x}, should be {0x00,0x40,0x00}", r, g, b);
+    SDL_ReadSurfacePixel(surface, 24, 7, &r, &g, &b, &a);
+    SDLTest_AssertCheck(r == 0x00 && g == 0x40 && b == 0x00, "Pixel at the top of the flipped copy is {0x%02x,0x%02x,0x%02x}, should be {0x00,0x40,0x00}", r, g, b);
+    SDL_ReadSurfacePixel(surface, 24, 12, &r, &g, &b, &a);
+    SDLTest_AssertCheck(r == 0x80 && g == 0x00 && b == 0x00, "Pixel at the bottom of the flipped copy is {0x%02x,0x%02x,0x%02x}, should be {0x80,0x00,0x00}", r, g, b);
+    SDL_ReadSurfacePixel(surface, 4, 10, &r, &g, &b, &a);
+    SDLTest_AssertCheck(r == 0x00 && g == 0x00 && b == 0x00, "Pixel outside of the rotated copy is {0x%02x,0x%02x,0x%02x}, should be black", r, g, b);
+
+    SDL_DestroyTexture(texture);
+    SDL_DestroyRenderer(software_renderer);
+    SDL_DestroySurface(surface);
+    return TEST_COMPLETED;
+}
+
+/**
+ * Tests that the software renderer only presents the parts of the window that were drawn to
+ *
+ * This relies on the dummy video driver keeping track of the window updates,
+ * which testautomation enables with the SDL_VIDEO_DUMMY_TEST_HOOKS hint.
+ */
+static int SDLCALL render_testSoftwareDirtyRects(void *arg)
+{
+    SDL_PropertiesID props;
+    Sint64 count;
+    SDL_FRect rect;
+
+    if (SDL_strcmp(SDL_GetCurrentVideoDriver(), "dummy") != 0 ||
+        SDL_strcmp(SDL_GetRendererName(renderer), SDL_SOFTWARE_RENDERER) != 0 ||
+        !SDL_GetHintBoolean("SDL_VIDEO_DUMMY_TEST_HOOKS", false)) {
+        SDLTest_Log("Skipping test, it needs the software renderer with the dummy video driver test hooks");
+        return TEST_SKIPPED;
+    }
+    props = SDL_GetWindowProperties(window);
+
+    SDL_SetRenderDrawColor(renderer, 0, 0, 0, SDL_ALPHA_OPAQUE);
+    CHECK_FUNC(SDL_RenderClear, (renderer));
+    CHECK_FUNC(SDL_RenderPresent, (renderer));
+    count = SDL_GetNumberProperty(props, "SDL.internal.window.dummy.update_count", 0);
+    SDLTest_AssertCheck(count > 0, "Clearing the window updates it");
+    SDLTest_AssertCheck(SDL_GetNumberProperty(props, "SDL.internal.window.dummy.update_w", 0) == TESTRENDER_WINDOW_W &&
+                        SDL_GetNumberProperty(props, "SDL.internal.window.dummy.update_h", 0) == TESTRENDER_WINDOW_H,
+                        "Clearing the window updates all of it");
+
+    rect.x = 10.0f;
+    rect.y = 20.0f;
+    rect.w = 30.0f;
+    rect.h = 40.0f;
+    SDL_SetRenderDrawColor(renderer, 0, 0xFF, 0, SDL_ALPHA_OPAQUE);
+    CHECK_FUNC(SDL_RenderFillRect, (renderer, &rect));
+    CHECK_FUNC(SDL_RenderPresent, (renderer));
+    SDLTest_AssertCheck(SDL_GetNumberProperty(props, "SDL.internal.window.dummy.update_count", 0) == count + 1, "Filling a rect updates the window once");
+    SDLTest_AssertCheck(SDL_GetNumberProperty(props, "SDL.internal.window.dummy.update_x", 0) == 10 &&
+                        SDL_GetNumberProperty(props, "SDL.internal.window.dummy.update_y", 0) == 20 &&
+                        SDL_GetNumberProperty(props, "SDL.internal.window.dummy.update_w", 0) == 30 &&
+                        SDL_GetNumberProperty(props, "SDL.internal.window.dummy.update_h", 0) == 40,
+                        "Only the filled rect is updated, got {%d,%d,%d,%d}",
+                        (int)SDL_GetNumberProperty(props, "SDL.internal.window.dummy.update_x", 0),
+                        (int)SDL_GetNumberProperty(props, "SDL.internal.window.dummy.update_y", 0),
+                        (int)SDL_GetNumberProperty(props, "SDL.internal.window.dummy.update_w", 0),
+                        (int)SDL_GetNumberProperty(props, "SDL.internal.window.dummy.update_h", 0));
+
+    count = SDL_GetNumberProperty(props, "SDL.internal.window.dummy.update_count", 0);
+    CHECK_FUNC(SDL_RenderPresent, (renderer));
+    SDLTest_AssertCheck(SDL_GetNumberProperty(props, "SDL.internal.window.dummy.update_count", 0) == count, "Presenting without drawing doesn't update the window");
+
+    return TEST_COMPLETED;
+}
+
 /**
  * Test clip rect
  */
@@ -1600,6 +1867,132 @@ static int SDLCALL render_testGetSetTextureScaleMode(void *arg)
     return TEST_COMPLETED;
 }
 
+/**
+ * Tests packing, drawing and removing images in a texture atlas.
+ *
+ * \sa SDL_CreateTextureAtlas
+ * \sa SDL_AddTextureAtlasEntry
+ * \sa SDL_GetTextureAtlasEntry
+ * \sa SDL_RemoveTextureAtlasEntry
+ */
+static int SDLCALL render_testTextureAtlas(void *arg)
+{
+    SDL_TextureAtlas *atlas;
+    SDL_TextureAtlasEntryID entries[12];
+    SDL_FRect rects[SDL_arraysize(entries)];
+    SDL_Texture *textures[SDL_arraysize(entries)];
+    SDL_Surface *surface;
+    SDL_TextureAtlasEntryID big;
+    int num_textures = 0, num_entries = 0;
+    float occupancy = 0.0f, previous_occupancy;
+    int i, j;
+
+    atlas = SDL_CreateTextureAtlas(renderer, SDL_PIXELFORMAT_ARGB8888, 32, 32);
+    SDLTest_AssertCheck(atlas != NULL, "Check SDL_CreateTextureAtlas result: %s", atlas != NULL ? "success" : SDL_GetError());
+    if (!atlas) {
+        return TEST_ABORTED;
+    }
+
+    /* Add a set of uniformly colored images of different sizes */
+    for (i = 0; i < (int)SDL_arraysize(entries); i++) {
+        surface = SDL_CreateSurface(3 + (i % 4) * 2, 2 + (i % 3) * 3, SDL_PIXELFORMAT_RGBA8888);
+        SDLTest_AssertCheck(surface != NULL, "Verify surface creation");
+        if (!surface) {
+            SDL_DestroyTextureAtlas(atlas);
+            return TEST_ABORTED;
+        }
+        SDL_FillSurfaceRect(surface, NULL, SDL_MapSurfaceRGB(surface, (Uint8)(i * 20), 0xFF, (Uint8)(0xFF - i * 20)));
+        entries[i] = SDL_AddTextureAtlasEntry(atlas, surface);
+        SDLTest_AssertCheck(entries[i] != 0, "Check SDL_AddTextureAtlasEntry result: %s", entries[i] != 0 ? "success" : SDL_GetError());
+        CHECK_FUNC(SDL_GetTextureAtlasEntry, (atlas, entries[i], &textures[i], &rects[i]));
+        SDLTest_AssertCheck(rects[i].w == (float)surface->w && rects[i].h == (float)surface->h, "Verify entry %d has the surface size", i);
+        SDL_DestroySurface(surface);
+    }
+
+    /* Images on the same texture must not overlap */
+    for (i = 0; i < (int)SDL_arraysize(entries); i++) {
+        SDLTest_AssertCheck(rects[i].x >= 0.0f && rects[i].y >= 0.0f && rects[i].x + rects[i].w <= 32.0f && rects[i].y + rects[i].h <= 32.0f,
+                            "Verify entry %d is inside the atlas texture", i);
+        for (j = i + 1; j < (int)SDL_arraysize(entries); j++) {
+            SDLTest_AssertCheck(textures[i] != textures[j] || !SDL_HasRectIntersectionFloat(&rects[i], &rects[j]),
+                                "Verify entries %d and %d don't overlap", i, j);
+        }
+    }
+
+    /* Draw the images and read back their colors */
+    for (i = 0; i < (int)SDL_arraysize(entries); i++) {
+        SDL_FRect dst = { 0.0f, 0.0f, rects[i].w, rects[i].h };
+        SDL_Surface *readback;
+        Uint8 r, g, b, a;
+
+        CHECK_FUNC(SDL_SetRenderDrawColor, (renderer, 0, 0, 0, SDL_ALPHA_OPAQUE));
+        CHECK_FUNC(SDL_RenderClear, (renderer));
+        CHECK_FUNC(SDL_RenderTexture, (renderer, textures[i], &rects[i], &dst));
+        readback = SDL_RenderReadPixels(renderer, NULL);
+        SDLTest_AssertCheck(readback != NULL, "Validate result from SDL_RenderReadPixels, got NULL, %s", SDL_GetError());
+        if (readback) {
+            SDL_ReadSurfacePixel(readback, (int)rects[i].w - 1, (int)rects[i].h - 1, &r, &g, &b, &a);
+            SDLTest_AssertCheck(r == (Uint8)(i * 20) && g == 0xFF && b == (Uint8)(0xFF - i * 20),
+                                "Verify color of entry %d, got %d,%d,%d", i, r, g, b);
+            SDL_DestroySurface(readback);
+        }
+    }
+
+    CHECK_FUNC(SDL_GetTextureAtlasOccupancy, (atlas, &num_textures, &num_entries, &occupancy));
+    SDLTest_AssertCheck(num_entries == (int)SDL_arraysize(entries), "Verify number of entries, expected %d, got %d", (int)SDL_arraysize(entries), num_entries);
+    SDLTest_AssertCheck(occupancy > 0.0f && occupancy <= 1.0f, "Verify occupancy is in range, got %f", occupancy);
+
+    /* Removing entries frees their space */
+    previous_occupancy = occupancy;
+    for (i = 0; i < (int)SDL_arraysize(entries); i += 2) {
+        CHECK_FUNC(SDL_RemoveTextureAtlasEntry, (atlas, entries[i]));
+    }
+    SDLTest_AssertCheck(!SDL_RemoveTextureAtlasEntry(atlas, entries[0]), "Verify removing an entry twice fails");
+    SDLTest_AssertCheck(!SDL_GetTextureAtlasEntry(atlas, entries[0], NULL, NULL), "Verify a removed entry can't be queried");
+    CHECK_FUNC(SDL_GetTextureAtlasOccupancy, (atlas, NULL, &num_entries, &occupancy));
+    SDLTest_AssertCheck(num_entries == (int)SDL_arraysize(entries) / 2, "Verify number of entries, expected %d, got %d", (int)SDL_arraysize(entries) / 2, num_entries);
+    SDLTest_AssertCheck(occupancy < previous_occupancy, "Verify occupancy dropped, got %f, previously %f", occupancy, previous_occupancy);
+
+    /* The space of a removed image is cleared, so nothing placed next to it later picks up its pixels */
+    {
+        SDL_FRect dst = { 0.0f, 0.0f, rects[0].w, rects[0].h };
+        SDL_Surface *readback;
+        Uint8 r, g, b, a;
+
+        CHECK_FUNC(SDL_SetRenderDrawColor, (renderer, 0, 0, 0, SDL_ALPHA_OPAQUE));
+        CHECK_FUNC(SDL_RenderClear, (renderer));
+        CHECK_FUNC(SDL_RenderTexture, (renderer, textures[0], &rects[0], &dst));
+        readback = SDL_RenderReadPixels(renderer, NULL);
+        SDLTest_AssertCheck(readback != NULL, "Validate result from SDL_RenderReadPixels, got NULL, %s", SDL_GetError());
+        if (readback) {
+            SDL_ReadSurfacePixel(readback, 0, 0, &r, &g, &b, &a);
+            SDLTest_AssertCheck(r == 0 && g == 0 && b == 0, "Verify removed entry was cleared, got %d,%d,%d", r, g, b);
+            SDL_DestroySurface(readback);
+        }
+    }
+
+    /* An image as large as the atlas needs its own texture, a larger one is rejected */
+    surface = SDL_CreateSurface(32, 32, SDL_PIXELFORMAT_ARGB8888);
+    SDLTest_AssertCheck(surface != NULL, "Verify surface creation");
+    if (surface) {
+        big = SDL_AddTextureAtlasEntry(atlas, surface);
+        SDLTest_AssertCheck(big != 0, "Check SDL_AddTextureAtlasEntry result: %s", big != 0 ? "success" : SDL_GetError());
+        CHECK_FUNC(SDL_GetTextureAtlasOccupancy, (atlas, &j, NULL, NULL));
+        SDLTest_AssertCheck(j == num_textures + 1, "Verify a texture was added, expected %d, got %d", num_textures + 1, j);
+        SDL_DestroySurface(surface);
+    }
+    surface = SDL_CreateSurface(33, 8, SDL_PIXELFORMAT_ARGB8888);
+    SDLTest_AssertCheck(surface != NULL, "Verify surface creation");
+    if (surface) {
+        SDLTest_AssertCheck(SDL_AddTextureAtlasEntry(atlas, surface) == 0, "Verify oversized surface is rejected");
+        SDL_DestroySurface(surface);
+    }
+
+    SDL_DestroyTextureAtlas(atlas);
+
+    return TEST_COMPLETED;
+}
+
 /* Helper functions */
 
 /**
@@ -2385,10 +2778,26 @@ static const SDLTest_TestCaseReference renderTestGetSetTextureScaleMode = {
     render_testGetSetTextureScaleMode, "render_testGetSetTextureScaleMode", "Tests setting/getting texture scale mode", TEST_ENABLED
 };
 
+static const SDLTest_TestCaseReference renderTestTextureAtlas = {
+    render_testTextureAtlas, "render_testTextureAtlas", "Tests packing images into a texture atlas", TEST_ENABLED
+};
+
 static const SDLTest_TestCaseReference renderTestRGBSurfaceNoAlpha = {
     render_testRGBSurfaceNoAlpha, "render_testRGBSurfaceNoAlpha", "Tests RGB surface with no alpha using software renderer", TEST_ENABLED
 };
 
+static const SDLTest_TestCaseReference renderTestSoftwareAntialias = {
+    render_testSoftwareAntialias, "render_testSoftwareAntialias", "Tests anti-aliased drawing with the software renderer", TEST_ENABLED
+};
+
+static const SDLTest_TestCaseReference renderTestSoftwareCopyEx = {
+    render_testSoftwareCopyEx, "render_testSoftwareCopyEx", "Tests rotated and modulated copies with the software renderer", TEST_ENABLED
+};
+
+static const SDLTest_TestCaseReference renderTestSoftwareDirtyRects = {
+    render_testSoftwareDirtyRects, "render_testSoftwareDirtyRects", "Tests that the software renderer only presents what was drawn", TEST_ENABLED
+};
+
 static const SDLTest_TestCaseReference renderTestColorspaceLinear = {
     render_testColorspaceLinear, "render_testColorspaceLinear", "Tests colorspace support (sRGB -> linear)", TEST_ENABLED
 };
@@ -2415,7 +2824,11 @@ static const SDLTest_TestCaseReference *renderTests[] = {
     &renderTestUVWrapping,
     &renderTestTextureState,
     &renderTestGetSetTextureScaleMode,
+    &renderTestTextureAtlas,
     &renderTestRGBSurfaceNoAlpha,
+    &renderTestSoftwareAntialias,
+    &renderTestSoftwareCopyEx,
+    &renderTestSoftwareDirtyRects,
     &renderTestColorspaceLinear,
     &renderTestColorspaceSRGB,
     NULL
@@ -1471,6 +1471,193 @@ static int SDLCALL stdlib_strtod(void *arg)
     return TEST_COMPLETED;
 }
 
+/* Reference CRC-32, one bit at a time */
+static Uint32 crc32_bitwise(Uint32 crc, const Uint8 *data, size_t len)
+{
+    size_t i;
+    int bit;
+
+    crc = ~crc;
+    for (i = 0; i < len; ++i) {
+        crc ^= data[i];
+        for (bit = 0; bit < 8; ++bit) {
+            crc = (crc & 1) ? ((crc >> 1) ^ 0xEDB88320) : (crc >> 1);
+        }
+    }
+    return ~crc;
+}
+
+static int SDLCALL stdlib_crc32(void *arg)
+{
+    const size_t size = 16 * 1024 * 1024;
+    Uint8 pattern[1000];
+    Uint8 *data;
+    Uint32 crc, expected;
+    Uint64 start, elapsed;
+    size_t i, split;
+    int mismatches = 0;
+
+    crc = SDL_crc32(0, NULL, 0);
+    SDLTest_AssertCheck(crc == 0, "Check CRC of nothing, expected: 0x00000000, got: 0x%08" SDL_PRIx32, crc);
+
+    crc = SDL_crc32(0, "123456789", 9);
+    SDLTest_AssertCheck(crc == 0xCBF43926, "Check CRC of \"123456789\", expected: 0xCBF43926, got: 0x%08" SDL_PRIx32, crc);
+
+    crc = SDL_crc32(SDL_crc32(0, "1234", 4), "56789", 5);
+    SDLTest_AssertCheck(crc == 0xCBF43926, "Check chained CRC of \"123456789\", expected: 0xCBF43926, got: 0x%08" SDL_PRIx32, crc);
+
+    for (i = 0; i < SDL_arraysize(pattern); ++i) {
+        pattern[i] = (Uint8)(i * 7 + 3);
+    }
+    crc = SDL_crc32(0, pattern, sizeof(pattern));
+    SDLTest_AssertCheck(crc == 0x17BC2A46, "Check CRC of 1000 byte pattern, expected: 0x17BC2A46, got: 0x%08" SDL_PRIx32, crc);
+
+    /* Every length and alignment around the block sizes of the fast paths */
+    for (i = 0; i < 300; ++i) {
+        for (split = 0; split < 16; ++split) {
+            if (SDL_crc32(0x12345678, pattern + split, i) != crc32_bitwise(0x12345678, pattern + split, i)) {
+                ++mismatches;
+            }
+        }
+    }
+    SDLTest_AssertCheck(mismatches == 0, "Check CRC of lengths 0-299 at offsets 0-15 against bitwise CRC, got %d mismatches", mismatches);
+
+    /* Splitting a buffer anywhere gives the same result */
+    mismatches = 0;
+    expected = SDL_crc32(0, pattern, sizeof(pattern));
+    for (split = 0; split <= sizeof(pattern); ++split) {
+        crc = SDL_crc32(SDL_crc32(0, pattern, split), pattern + split, sizeof(pattern) - split);
+        if (crc != expected) {
+            ++mismatches;
+        }
+    }
+    SDLTest_AssertCheck(mismatches == 0, "Check CRC chained at every split point, got %d mismatches", mismatches);
+
+    data = (Uint8 *)SDL_malloc(size);
+    SDLTest_AssertCheck(data != NULL, "Allocate %d MB for throughput test", (int)(size / (1024 * 1024)));
+    if (data) {
+        for (i = 0; i < size; ++i) {
+            data[i] = (Uint8)(i ^ (i >> 8) ^ (i >> 16));
+        }
+
+        start = SDL_GetTicksNS();
+        crc = SDL_crc32(0, data, size);
+        elapsed = SDL_GetTicksNS() - start;
+        SDLTest_Log("SDL_crc32() of %d MB took %.3f ms, %.1f MB/s", (int)(size / (1024 * 1024)), elapsed / 1000000.0,
+                    elapsed ? (size / (1024.0 * 1024.0)) / (elapsed / 1000000000.0) : 0.0);
+
+        expected = crc32_bitwise(0, data, 4096);
+        crc = SDL_crc32(0, data, 4096);
+        SDLTest_AssertCheck(crc == expected, "Check CRC of first 4096 bytes, expected: 0x%08" SDL_PRIx32 ", got: 0x%08" SDL_PRIx32, expected, crc);
+
+        SDL_free(data);
+    }
+
+    return TEST_COMPLETED;
+}
+
+/**
+ * Call to SDL_murmur3_32 and SDL_murmur3_64
+ */
+static int SDLCALL stdlib_murmur3(void *arg)
+{
+    static const char fox[] = "The quick brown fox jumps over the lazy dog";
+    Uint8 buffer[64 + 8];
+    Uint64 hash64, expected64;
+    Uint32 hash32;
+    size_t i;
+
+    /* Reference values from the original MurmurHash3 implementation */
+    hash32 = SDL_murmur3_32("", 0, 0);
+    SDLTest_AssertCheck(hash32 == 0, "Check murmur3_32 of empty string, expected: 0x00000000, got: 0x%08" SDL_PRIx32, hash32);
+    hash32 = SDL_murmur3_32("", 0, 1);
+    SDLTest_AssertCheck(hash32 == 0x514e28b7, "Check murmur3_32 of empty string with seed 1, expected: 0x514e28b7, got: 0x%08" SDL_PRIx32, hash32);
+    hash32 = SDL_murmur3_32("hello", 5, 0);
+    SDLTest_AssertCheck(hash32 == 0x248bfa47, "Check murmur3_32 of \"hello\", expected: 0x248bfa47, got: 0x%08" SDL_PRIx32, hash32);
+    hash32 = SDL_murmur3_32(fox, SDL_strlen(fox), 0x9747b28c);
+    SDLTest_AssertCheck(hash32 == 0x2fa826cd, "Check murmur3_32 of \"%s\", expected: 0x2fa826cd, got: 0x%08" SDL_PRIx32, fox, hash32);
+
+    hash64 = SDL_murmur3_64("", 0, 0);
+    SDLTest_AssertCheck(hash64 == 0, "Check murmur3_64 of empty string, expected: 0x0000000000000000, got: 0x%016" SDL_PRIx64, hash64);
+    hash64 = SDL_murmur3_64("hello", 5, 0);
+    SDLTest_AssertCheck(hash64 == 0xcbd8a7b341bd9b02ULL, "Check murmur3_64 of \"hello\", expected: 0xcbd8a7b341bd9b02, got: 0x%016" SDL_PRIx64, hash64);
+    hash64 = SDL_murmur3_64(fox, SDL_strlen(fox), 0);
+    SDLTest_AssertCheck(hash64 == 0xe34bbc7bbc071b6cULL, "Check murmur3_64 of \"%s\", expected: 0xe34bbc7bbc071b6c, got: 0x%016" SDL_PRIx64, fox, hash64);
+    hash64 = SDL_murmur3_64(fox, SDL_strlen(fox), 0x12345678);
+    SDLTest_AssertCheck(hash64 == 0x95f6dd9e04994ff7ULL, "Check murmur3_64 of \"%s\" with seed 0x12345678, expected: 0x95f6dd9e04994ff7, got: 0x%016" SDL_PRIx64, fox, hash64);
+    hash64 = SDL_murmur3_64("0123456789abcdef", 16, 1);
+    SDLTest_AssertCheck(hash64 == 0xfdff0577812ebb41ULL, "Check murmur3_64 of a full block with seed 1, expected: 0xfdff0577812ebb41, got: 0x%016" SDL_PRIx64, hash64);
+
+    /* The result shouldn't depend on how the data is aligned */
+    for (i = 0; i < 64; ++i) {
+        buffer[i] = (Uint8)(i * 37);
+    }
+    expected64 = SDL_murmur3_64(buffer, 64, 42);
+    for (i = 1; i < 8; ++i) {
+        SDL_memmove(buffer + i, buffer + i - 1, 64);
+        hash64 = SDL_murmur3_64(buffer + i, 64, 42);
+        SDLTest_AssertCheck(hash64 == expected64, "Check murmur3_64 at offset %d, expected: 0x%016" SDL_PRIx64 ", got: 0x%016" SDL_PRIx64, (int)i, expected64, hash64);
+    }
+
+    return TEST_COMPLETED;
+}
+
+/**
+ * Call to SDL_GetMemoryStats
+ */
+static int SDLCALL stdlib_memory_stats(void *arg)
+{
+    SDL_MemoryStats before, during, after;
+    SDL_Surface *surface;
+    SDL_PropertiesID props;
+    bool result;
+
+    SDLTest_AssertPass("Call to SDL_GetMemoryStats(SDL_MEMORY_TAG_COUNT, ...)");
+    result = SDL_GetMemoryStats(SDL_MEMORY_TAG_COUNT, &before);
+    SDLTest_AssertCheck(!result, "Check that an invalid tag is rejected");
+    SDLTest_AssertPass("Call to SDL_GetMemoryStats(SDL_MEMORY_TAG_SURFACE, NULL)");
+    result = SDL_GetMemoryStats(SDL_MEMORY_TAG_SURFACE, NULL);
+    SDLTest_AssertCheck(!result, "Check that NULL stats are rejected");
+
+    result = SDL_GetMemoryStats(SDL_MEMORY_TAG_SURFACE, &before);
+    SDLTest_AssertCheck(result, "Call to SDL_GetMemoryStats(SDL_MEMORY_TAG_SURFACE, ...)");
+    surface = SDL_CreateSurface(64, 64, SDL_PIXELFORMAT_RGBA32);
+    SDLTest_AssertCheck(surface != NULL, "Call to SDL_CreateSurface(64, 64, SDL_PIXELFORMAT_RGBA32)");
+    if (surface) {
+        SDL_GetMemoryStats(SDL_MEMORY_TAG_SURFACE, &during);
+        SDLTest_AssertCheck(during.live_bytes == before.live_bytes + 64 * 64 * 4,
+                            "Check live bytes, expected %" SDL_PRIu64 ", got %" SDL_PRIu64, before.live_bytes + 64 * 64 * 4, during.live_bytes);
+        SDLTest_AssertCheck(during.live_allocations == before.live_allocations + 1,
+                            "Check live allocations, expected %" SDL_PRIu64 ", got %" SDL_PRIu64, before.live_allocations + 1, during.live_allocations);
+        SDLTest_AssertCheck(during.total_allocations == before.total_allocations + 1,
+                            "Check total allocations, expected %" SDL_PRIu64 ", got %" SDL_PRIu64, before.total_allocations + 1, during.total_allocations);
+        SDL_DestroySurface(surface);
+
+        SDL_GetMemoryStats(SDL_MEMORY_TAG_SURFACE, &after);
+        SDLTest_AssertCheck(after.live_bytes == before.live_bytes,
+                            "Check live bytes after freeing, expected %" SDL_PRIu64 ", got %" SDL_PRIu64, before.live_bytes, after.live_bytes);
+        SDLTest_AssertCheck(after.live_allocations == before.live_allocations,
+                            "Check live allocations after freeing, expected %" SDL_PRIu64 ", got %" SDL_PRIu64, before.live_allocations, after.live_allocations);
+        SDLTest_AssertCheck(after.total_bytes == during.total_bytes,
+                            "Check total bytes after freeing, expected %" SDL_PRIu64 ", got %" SDL_PRIu64, during.total_bytes, after.total_bytes);
+    }
+
+    SDL_GetMemoryStats(SDL_MEMORY_TAG_HASHTABLE, &before);
+    props = SDL_CreateProperties();
+    SDLTest_AssertCheck(props != 0, "Call to SDL_CreateProperties()");
+    if (props) {
+        SDL_GetMemoryStats(SDL_MEMORY_TAG_HASHTABLE, &during);
+        SDLTest_AssertCheck(during.live_bytes > before.live_bytes, "Check that the properties' hash table is counted");
+        SDL_DestroyProperties(props);
+
+        SDL_GetMemoryStats(SDL_MEMORY_TAG_HASHTABLE, &after);
+        SDLTest_AssertCheck(after.live_bytes == before.live_bytes,
+                            "Check live bytes after freeing, expected %" SDL_PRIu64 ", got %" SDL_PRIu64, before.live_bytes, after.live_bytes);
+    }
+
+    return TEST_COMPLETED;
+}
+
 /* ================= Test References ================== */
 
 /* Standard C routine test cases */
@@ -1530,6 +1717,18 @@ static const SDLTest_TestCaseReference stdlibTest_strtod = {
     stdlib_strtod, "stdlib_strtod", "Calls to SDL_strtod", TEST_ENABLED
 };
 
+static const SDLTest_TestCaseReference stdlibTest_crc32 = {
+    stdlib_crc32, "stdlib_crc32", "Calls to SDL_crc32", TEST_ENABLED
+};
+
+static const SDLTest_TestCaseReference stdlibTest_murmur3 = {
+    stdlib_murmur3, "stdlib_murmur3", "Calls to SDL_murmur3_32 and SDL_murmur3_64", TEST_ENABLED
+};
+
+static const SDLTest_TestCaseReference stdlibTest_memory_stats = {
+    stdlib_memory_stats, "stdlib_memory_stats", "Calls to SDL_GetMemoryStats", TEST_ENABLED
+};
+
 /* Sequence of Standard C routine test cases */
 static const SDLTest_TestCaseReference *stdlibTests[] = {
     &stdlibTest_strnlen,
@@ -1546,6 +1745,9 @@ static const SDLTest_TestCaseReference *stdlibTests[] = {
     &stdlibTest_wcstox,
     &stdlibTest_strtox,
     &stdlibTest_strtod,
+    &stdlibTest_crc32,
+    &stdlibTest_murmur3,
+    &stdlibTest_memory_stats,
     NULL
 };
 
@@ -174,6 +174,161 @@ static int SDLCALL timer_addRemoveTimer(void *arg)
 #endif
 }
 
+#ifndef SDL_PLATFORM_EMSCRIPTEN
+
+#define NUM_MANY_TIMERS 2000
+
+static SDL_AtomicInt g_manyTimersFired[NUM_MANY_TIMERS];
+static SDL_AtomicInt g_manyTimersCount;
+
+static Uint32 SDLCALL timerManyCallback(void *param, SDL_TimerID timerID, Uint32 interval)
+{
+    SDL_AtomicIncRef(&g_manyTimersFired[(intptr_t)param]);
+    SDL_AtomicIncRef(&g_manyTimersCount);
+    return 0;
+}
+
+#endif
+
+/**
+ * Call to SDL_AddTimer and SDL_RemoveTimer with many timers at once
+ */
+static int SDLCALL timer_manyTimers(void *arg)
+{
+#ifdef SDL_PLATFORM_EMSCRIPTEN
+    SDLTest_Log("Timer callbacks on Emscripten require a main loop to handle events");
+    return TEST_SKIPPED;
+#else
+    SDL_TimerID ids[NUM_MANY_TIMERS];
+    Uint64 start;
+    int i, expected = 0, failed = 0;
+
+    SDL_SetAtomicInt(&g_manyTimersCount, 0);
+    for (i = 0; i < NUM_MANY_TIMERS; ++i) {
+        SDL_SetAtomicInt(&g_manyTimersFired[i], 0);
+    }
+
+    /* Add timers due in random order, and remove every fourth one before it fires */
+    for (i = 0; i < NUM_MANY_TIMERS; ++i) {
+        ids[i] = SDL_AddTimer((Uint32)SDLTest_RandomIntegerInRange(20, 100), timerManyCallback, (void *)(intptr_t)i);
+        if (!ids[i]) {
+            ++failed;
+        }
+    }
+    SDLTest_AssertPass("Call to SDL_AddTimer() %d times", NUM_MANY_TIMERS);
+    SDLTest_AssertCheck(failed == 0, "Check all timers were added, expected: 0 failures, got: %d", failed);
+
+    failed = 0;
+    for (i = 0; i < NUM_MANY_TIMERS; i += 4) {
+        if (!SDL_RemoveTimer(ids[i])) {
+            ++failed;
+        }
+    }
+    SDLTest_AssertPass("Call to SDL_RemoveTimer() on every fourth timer");
+    SDLTest_AssertCheck(failed == 0, "Check all timers were removed, expected: 0 failures, got: %d", failed);
+
+    expected = NUM_MANY_TIMERS - (NUM_MANY_TIMERS + 3) / 4;
+
+    /* Wait for the rest of them to fire */
+    start = SDL_GetTicks();
+    while (SDL_GetAtomicInt(&g_manyTimersCount) < expected && SDL_GetTicks() - start < 5000) {
+        SDL_Delay(10);
+    }
+    SDL_Delay(50);
+
+    SDLTest_AssertCheck(SDL_GetAtomicInt(&g_manyTimersCount) == expected, "Check callback count, expected: %d, got: %d", expected, SDL_GetAtomicInt(&g_manyTimersCount));
+
+    failed = 0;
+    for (i = 0; i < NUM_MANY_TIMERS; ++i) {
+        const int fired = SDL_GetAtomicInt(&g_manyTimersFired[i]);
+        if (fired != ((i % 4) ? 1 : 0)) {
+            ++failed;
+        }
+    }
+    SDLTest_AssertCheck(failed == 0, "Check each remaining timer fired once and removed timers didn't, expected: 0 mismatches, got: %d", failed);
+
+    return TEST_COMPLETED;
+#endif
+}
+
+/**
+ * Call to SDL_CreateFramePacer, SDL_WaitFramePacer and SDL_GetFramePacerStats
+ */
+static int SDLCALL timer_framePacer(void *arg)
+{
+    const Uint64 period = 5 * SDL_NS_PER_MS;
+    SDL_FramePacer *pacer;
+    SDL_FramePacerStats stats;
+    Uint64 start, elapsed;
+    bool result;
+    int i, frames, total = 0;
+
+    pacer = SDL_CreateFramePacer(0);
+    SDLTest_AssertPass("Call to SDL_CreateFramePacer(0)");
+    SDLTest_AssertCheck(pacer == NULL, "Check result value, expected: NULL, got: %p", (void *)pacer);
+
+    pacer = SDL_CreateFramePacer(period);
+    SDLTest_AssertPass("Call to SDL_CreateFramePacer(5 ms)");
+    SDLTest_AssertCheck(pacer != NULL, "Check result value, expected: non-NULL, got: NULL");
+    if (!pacer) {
+        return TEST_ABORTED;
+    }
+
+    /* Each wait lands on the next deadline, without drifting */
+    start = SDL_GetTicksNS();
+    for (i = 0; i < 20; ++i) {
+        frames = SDL_WaitFramePacer(pacer);
+        total += frames;
+    }
+    elapsed = SDL_GetTicksNS() - start;
+    SDLTest_AssertPass("Call to SDL_WaitFramePacer() 20 times");
+    SDLTest_AssertCheck(total >= 20, "Check frame count, expected: >=20, got: %d", total);
+    SDLTest_AssertCheck(elapsed >= 19 * period, "Check elapsed time, expected: >=%" SDL_PRIu64 ", got: %" SDL_PRIu64, 19 * period, elapsed);
+
+    /* Missing deadlines reports the frames that passed */
+    SDL_Delay(30);
+    frames = SDL_WaitFramePacer(pacer);
+    SDLTest_AssertPass("Call to SDL_WaitFramePacer() after a 30 ms delay");
+    SDLTest_AssertCheck(frames >= 5, "Check result value, expected: >=5, got: %d", frames);
+
+    result = SDL_GetFramePacerStats(pacer, &stats);
+    SDLTest_AssertPass("Call to SDL_GetFramePacerStats()");
+    SDLTest_AssertCheck(result == true, "Check result value, expected: true, got: %i", result);
+    SDLTest_AssertCheck(stats.frames == 21, "Check frames, expected: 21, got: %" SDL_PRIu64, stats.frames);
+    SDLTest_AssertCheck(stats.missed_frames >= 5, "Check missed frames, expected: >=5, got: %" SDL_PRIu64, stats.missed_frames);
+    SDLTest_AssertCheck(stats.max_jitter_ns >= stats.average_jitter_ns, "Check max jitter %" SDL_PRIu64 " >= average jitter %" SDL_PRIu64, stats.max_jitter_ns, stats.average_jitter_ns);
+
+    /* Resetting starts over from now */
+    result = SDL_ResetFramePacer(pacer);
+    SDLTest_AssertPass("Call to SDL_ResetFramePacer()");
+    SDLTest_AssertCheck(result == true, "Check result value, expected: true, got: %i", result);
+    frames = SDL_WaitFramePacer(pacer);
+    SDLTest_AssertCheck(frames == 1, "Check result value, expected: 1, got: %d", frames);
+    SDL_GetFramePacerStats(pacer, &stats);
+    SDLTest_AssertCheck(stats.frames == 1, "Check frames, expected: 1, got: %" SDL_PRIu64, stats.frames);
+
+    /* Refresh rates are fractions, like in SDL_DisplayMode */
+    result = SDL_SetFramePacerRefreshRate(pacer, 60000, 1001);
+    SDLTest_AssertPass("Call to SDL_SetFramePacerRefreshRate(60000, 1001)");
+    SDLTest_AssertCheck(result == true, "Check result value, expected: true, got: %i", result);
+    result = SDL_SetFramePacerRefreshRate(pacer, 0, 1);
+    SDLTest_AssertPass("Call to SDL_SetFramePacerRefreshRate(0, 1)");
+    SDLTest_AssertCheck(result == false, "Check result value, expected: false, got: %i", result);
+    start = SDL_GetTicksNS();
+    SDL_WaitFramePacer(pacer);
+    SDL_WaitFramePacer(pacer);
+    elapsed = SDL_GetTicksNS() - start;
+    SDLTest_AssertCheck(elapsed >= 16683333, "Check elapsed time at 59.94 Hz, expected: >=16683333, got: %" SDL_PRIu64, elapsed);
+
+    SDL_DestroyFramePacer(pacer);
+    SDLTest_AssertPass("Call to SDL_DestroyFramePacer()");
+
+    frames = SDL_WaitFramePacer(NULL);
+    SDLTest_AssertCheck(frames == -1, "Check SDL_WaitFramePacer(NULL), expected: -1, got: %d", frames);
+
+    return TEST_COMPLETED;
+}
+
 /* ================= Test References ================== */
 
 /* Timer test cases */
@@ -193,9 +348,17 @@ static const SDLTest_TestCaseReference timerTest4 = {
     timer_addRemoveTimer, "timer_addRemoveTimer", "Call to SDL_AddTimer and SDL_RemoveTimer", TEST_ENABLED
 };
 
+static const SDLTest_TestCaseReference timerTest5 = {
+    timer_manyTimers, "timer_manyTimers", "Call to SDL_AddTimer and SDL_RemoveTimer with many timers", TEST_ENABLED
+};
+
+static const SDLTest_TestCaseReference timerTest6 = {
+    timer_framePacer, "timer_framePacer", "Call to SDL_CreateFramePacer and SDL_WaitFramePacer", TEST_ENABLED
+};
+
 /* Sequence of Timer test cases */
 static const SDLTest_TestCaseReference *timerTests[] = {
-    &timerTest1, &timerTest2, &timerTest3, &timerTest4, NULL
+    &timerTest1, &timerTest2, &timerTest3, &timerTest4, &timerTest5, &timerTest6, NULL
 };
 
 /* Timer test suite (global) */
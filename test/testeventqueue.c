@@ -0,0 +1,264 @@
+/*
+  Copyright (C) 1997-2026 Sam Lantinga <slouken@libsdl.org>
+
+  This software is provided 'as-is', without any express or implied
+  warranty.  In no event will the authors be held liable for any damages
+  arising from the use of this software.
+
+  Permission is granted to anyone to use this software for any purpose,
+  including commercial applications, and to alter it and redistribute it
+  freely.
+*/
+
+/* Measures how the SDL event queue holds up with several threads pushing events
+   at the same time, while the main thread drains it. It also checks that no event
+   gets lost and that the events of each thread come out in the order they went in.
+*/
+
+#include <SDL3/SDL.h>
+#include <SDL3/SDL_main.h>
+#include <SDL3/SDL_test.h>
+
+#define MAX_WRITERS 64
+
+typedef struct
+{
+    int index;
+    int num_events;
+    int waits;
+    SDL_Thread *thread;
+} WriterData;
+
+static Uint32 event_type;
+static SDL_AtomicInt writers_started;
+static SDL_AtomicInt go;
+
+static int SDLCALL Writer(void *_data)
+{
+    WriterData *data = (WriterData *)_data;
+    SDL_Event event;
+    int i;
+
+    SDL_zero(event);
+    event.type = event_type;
+    event.user.code = data->index;
+
+    SDL_AtomicIncRef(&writers_started);
+    while (!SDL_GetAtomicInt(&go)) {
+        SDL_CPUPauseInstruction();
+    }
+
+    for (i = 0; i < data->num_events; ++i) {
+        event.user.data1 = (void *)(intptr_t)i;
+        while (!SDL_PushEvent(&event)) {
+            /* The queue is full, give the reader a chance to catch up */
+            ++data->waits;
+            SDL_Delay(0);
+        }
+    }
+    return 0;
+}
+
+static bool RunContentionTest(int num_writers, int events_per_writer, int batch_size)
+{
+    WriterData writers[MAX_WRITERS];
+    int next_expected[MAX_WRITERS];
+    SDL_Event events[256];
+    Uint64 start, end;
+    int total = num_writers * events_per_writer;
+    int received = 0, polls = 0, i;
+    bool result = true;
+
+    SDL_SetAtomicInt(&writers_started, 0);
+    SDL_SetAtomicInt(&go, 0);
+
+    SDL_zeroa(writers);
+    SDL_zeroa(next_expected);
+    for (i = 0; i < num_writers; ++i) {
+        char name[64];
+        (void)SDL_snprintf(name, sizeof(name), "EventWriter%d", i);
+        writers[i].index = i;
+        writers[i].num_events = events_per_writer;
+        writers[i].thread = SDL_CreateThread(Writer, name, &writers[i]);
+        if (!writers[i].thread) {
+            SDL_Log("Couldn't create thread: %s", SDL_GetError());
+            SDL_SetAtomicInt(&go, 1);
+            while (--i >= 0) {
+                SDL_WaitThread(writers[i].thread, NULL);
+            }
+            return false;
+        }
+    }
+    while (SDL_GetAtomicInt(&writers_started) < num_writers) {
+        SDL_Delay(0);
+    }
+
+    start = SDL_GetTicksNS();
+    SDL_SetAtomicInt(&go, 1);
+
+    while (received < total) {
+        int count = SDL_PeepEvents(events, batch_size, SDL_GETEVENT, event_type, event_type);
+        if (count < 0) {
+            SDL_Log("SDL_PeepEvents() failed: %s", SDL_GetError());
+            result = false;
+            break;
+        }
+        ++polls;
+        for (i = 0; i < count; ++i) {
+            const int writer = events[i].user.code;
+            const int sequence = (int)(intptr_t)events[i].user.data1;
+            if (writer < 0 || writer >= num_writers || sequence != next_expected[writer]) {
+                SDL_Log("Event %d from writer %d arrived out of order, expected event %d", sequence, writer, (writer >= 0 && writer < num_writers) ? next_expected[writer] : -1);
+                result = false;
+            } else {
+                ++next_expected[writer];
+            }
+        }
+        received += count;
+    }
+
+    end = SDL_GetTicksNS();
+
+    for (i = 0; i < num_writers; ++i) {
+        SDL_WaitThread(writers[i].thread, NULL);
+    }
+
+    if (result && SDL_HasEvent(event_type)) {
+        SDL_Log("There are more events in the queue than were sent");
+        result = false;
+    }
+
+    {
+        const double seconds = (end - start) / 1000000000.0;
+        int waits = 0;
+        for (i = 0; i < num_writers; ++i) {
+            waits += writers[i].waits;
+        }
+        SDL_Log("%2d writers, batches of %3d: %d events in %f sec, %.0f events/sec, %d polls, %d writer waits",
+                num_writers, batch_size, total, seconds, seconds > 0.0 ? total / seconds : 0.0, polls, waits);
+    }
+    return result;
+}
+
+/* Without threads, the main thread takes turns filling and draining the queue */
+static bool RunSingleThreadTest(int num_events)
+{
+    SDL_Event event, events[128];
+    Uint64 start, end;
+    int sent = 0, received = 0, i;
+    bool result = true;
+
+    SDL_zero(event);
+    event.type = event_type;
+
+    start = SDL_GetTicksNS();
+    while (received < num_events) {
+        const int chunk = SDL_min(num_events - sent, (int)SDL_arraysize(events));
+        int count;
+
+        for (i = 0; i < chunk; ++i) {
+            event.user.data1 = (void *)(intptr_t)sent++;
+            if (!SDL_PushEvent(&event)) {
+                SDL_Log("SDL_PushEvent() failed: %s", SDL_GetError());
+                return false;
+            }
+        }
+        count = SDL_PeepEvents(events, SDL_arraysize(events), SDL_GETEVENT, event_type, event_type);
+        if (count != chunk) {
+            SDL_Log("Got %d events back, expected %d", count, chunk);
+            return false;
+        }
+        for (i = 0; i < count; ++i) {
+            if ((int)(intptr_t)events[i].user.data1 != received + i) {
+                result = false;
+            }
+        }
+        received += count;
+    }
+    end = SDL_GetTicksNS();
+
+    SDL_Log("No threads: %d events in %f sec, %.0f events/sec%s", num_events, (end - start) / 1000000000.0,
+            end > start ? num_events / ((end - start) / 1000000000.0) : 0.0, result ? "" : ", OUT OF ORDER");
+    return result;
+}
+
+int main(int argc, char *argv[])
+{
+    SDLTest_CommonState *state;
+    int num_writers = 0;
+    int events_per_writer = 0;
+    int i;
+    bool enable_threads = true;
+    bool result = true;
+
+    /* Initialize test framework */
+    state = SDLTest_CommonCreateState(argv, 0);
+    if (!state) {
+        return 1;
+    }
+
+    /* Parse commandline */
+    for (i = 1; i < argc;) {
+        int consumed;
+
+        consumed = SDLTest_CommonArg(state, i);
+        if (consumed == 0) {
+            consumed = -1;
+            if (SDL_strcasecmp(argv[i], "--no-threads") == 0) {
+                enable_threads = false;
+                consumed = 1;
+            } else if (SDL_strcasecmp(argv[i], "--writers") == 0 && argv[i + 1]) {
+                num_writers = SDL_atoi(argv[i + 1]);
+                consumed = 2;
+            } else if (SDL_strcasecmp(argv[i], "--events") == 0 && argv[i + 1]) {
+                events_per_writer = SDL_atoi(argv[i + 1]);
+                consumed = 2;
+            }
+        }
+        if (consumed < 0 || num_writers < 0 || num_writers > MAX_WRITERS || events_per_writer < 0) {
+            static const char *options[] = {
+                "[--no-threads]",
+                "[--writers N]",
+                "[--events N]",
+                NULL
+            };
+            SDLTest_CommonLogUsage(state, argv[0], options);
+            return 1;
+        }
+        i += consumed;
+    }
+
+    if (events_per_writer == 0) {
+        if (SDL_GetEnvironmentVariable(SDL_GetEnvironment(), "SDL_TESTS_QUICK") != NULL) {
+            events_per_writer = 10000;
+        } else {
+            events_per_writer = 100000;
+        }
+    }
+
+    if (!SDL_Init(SDL_INIT_EVENTS)) {
+        SDL_Log("Couldn't initialize SDL: %s", SDL_GetError());
+        return 1;
+    }
+
+    event_type = SDL_RegisterEvents(1);
+
+    result = RunSingleThreadTest(events_per_writer);
+
+    if (!enable_threads) {
+        /* That's all we can do */
+    } else if (num_writers > 0) {
+        result = RunContentionTest(num_writers, events_per_writer, 1) && result;
+        result = RunContentionTest(num_writers, events_per_writer, 64) && result;
+    } else {
+        static const int writer_counts[] = { 1, 2, 4, 8 };
+        for (i = 0; i < SDL_arraysize(writer_counts); ++i) {
+            result = RunContentionTest(writer_counts[i], events_per_writer, 1) && result;
+            result = RunContentionTest(writer_counts[i], events_per_writer, 64) && result;
+        }
+    }
+
+    SDL_Quit();
+    SDLTest_CommonDestroyState(state);
+    return result ? 0 : 1;
+}
@@ -0,0 +1,724 @@
+/*
+  Copyright (C) 1997-2026 Sam Lantinga <slouken@libsdl.org>
+
+  This software is provided 'as-is', without any express or implied
+  warranty.  In no event will the authors be held liable for any damages
+  arising from the use of this software.
+
+  Permission is granted to anyone to use this software for any purpose,
+  including commercial applications, and to alter it and redistribute it
+  freely.
+*/
+
+/* Standalone driver for src/SDL_hashtable.c: checks the table against a plain
+   array with a random mix of operations, checks that lookups from other threads
+   are safe while the table changes, then measures insert and lookup throughput
+   and the memory used per entry for integer and string keys.
+*/
+
+/* Hack #1: avoid inclusion of SDL_main.h by SDL_internal.h */
+#define SDL_main_h_
+
+/* Hack #2: avoid dynapi renaming (must be done before #include <SDL3/SDL.h>) */
+#include "../src/dynapi/SDL_dynapi.h"
+#ifdef SDL_DYNAMIC_API
+#undef SDL_DYNAMIC_API
+#endif
+#define SDL_DYNAMIC_API 0
+
+#include "../src/SDL_internal.h"
+
+/* Hack #3: undo Hack #1 */
+#ifdef SDL_main_h_
+#undef SDL_main_h_
+#endif
+#ifdef SDL_MAIN_NOIMPL
+#undef SDL_MAIN_NOIMPL
+#endif
+
+#include <SDL3/SDL_main.h>
+#include <SDL3/SDL_test.h>
+
+#include "../src/SDL_hashtable.c"
+
+/* Hack #4: SDL doesn't export the functions that count its memory under a tag */
+void *SDL_malloc_tagged(SDL_MemoryTag tag, size_t size)
+{
+    (void)tag;
+    return SDL_malloc(size);
+}
+
+void *SDL_calloc_tagged(SDL_MemoryTag tag, size_t nmemb, size_t size)
+{
+    (void)tag;
+    return SDL_calloc(nmemb, size);
+}
+
+void SDL_free_tagged(SDL_MemoryTag tag, void *mem, size_t size)
+{
+    (void)tag;
+    (void)size;
+    SDL_free(mem);
+}
+
+static int num_destroyed;
+
+static void SDLCALL CountDestroy(void *unused, const void *key, const void *value)
+{
+    (void)unused;
+    (void)key;
+    (void)value;
+    ++num_destroyed;
+}
+
+static bool CheckItem(SDL_HashTable *table, Uint32 key, bool present, Uint32 expected)
+{
+    const void *value = NULL;
+    const bool found = SDL_FindInHashTable(table, (const void *)(uintptr_t)key, &value);
+    if (found != present) {
+        SDL_Log("Key %" SDL_PRIu32 " should%s be in the table", key, present ? "" : " not");
+        return false;
+    }
+    if (found && (Uint32)(uintptr_t)value != expected) {
+        SDL_Log("Key %" SDL_PRIu32 " has value %" SDL_PRIu32 ", expected %" SDL_PRIu32, key, (Uint32)(uintptr_t)value, expected);
+        return false;
+    }
+    return true;
+}
+
+static bool SDLCALL CountItem(void *userdata, const SDL_HashTable *table, const void *key, const void *value)
+{
+    (void)table;
+    (void)key;
+    (void)value;
+    ++*(int *)userdata;
+    return true;
+}
+
+/* Random inserts, replacements and removals, to exercise tombstones and rehashing */
+static bool RunConsistencyTest(Uint64 seed, int num_ops, bool lockfree)
+{
+    enum { NUM_KEYS = 4096 };
+    static Uint32 values[NUM_KEYS];
+    static bool present[NUM_KEYS];
+    SDL_HashTable *table;
+    int num_present = 0, num_iterated = 0, expected_destroyed = 0;
+    bool result = true;
+    int i;
+
+    SDL_zeroa(present);
+    num_destroyed = 0;
+
+    if (lockfree) {
+        table = SDL_CreateLockFreeHashTable(0, SDL_HashID, SDL_KeyMatchID, CountDestroy, NULL);
+    } else {
+        table = SDL_CreateHashTable(0, false, SDL_HashID, SDL_KeyMatchID, CountDestroy, NULL);
+    }
+    if (!table) {
+        SDL_Log("SDL_CreateHashTable() failed: %s", SDL_GetError());
+        return false;
+    }
+
+    for (i = 0; i < num_ops && result; ++i) {
+        /* Keep the working set small at first, so the table grows and shrinks around it */
+        const Uint32 range = (i < num_ops / 2) ? 64 : NUM_KEYS;
+        const Uint32 key = SDL_rand_r(&seed, range);
+        const Uint32 value = SDL_rand_bits_r(&seed);
+
+        switch (SDL_rand_r(&seed, 3)) {
+        case 0:
+            if (SDL_InsertIntoHashTable(table, (const void *)(uintptr_t)key, (const void *)(uintptr_t)value, false) == present[key]) {
+                SDL_Log("Inserting key %" SDL_PRIu32 " without replace gave the wrong result", key);
+                result = false;
+            }
+            if (!present[key]) {
+                values[key] = value;
+                present[key] = true;
+                ++num_present;
+            }
+            break;
+        case 1:
+            if (!SDL_InsertIntoHashTable(table, (const void *)(uintptr_t)key, (const void *)(uintptr_t)value, true)) {
+                SDL_Log("Replacing key %" SDL_PRIu32 " failed: %s", key, SDL_GetError());
+                result = false;
+            }
+            if (present[key]) {
+                ++expected_destroyed;
+            } else {
+                present[key] = true;
+                ++num_present;
+            }
+            values[key] = value;
+            break;
+        default:
+            if (SDL_RemoveFromHashTable(table, (const void *)(uintptr_t)key) != present[key]) {
+                SDL_Log("Removing key %" SDL_PRIu32 " gave the wrong result", key);
+                result = false;
+            }
+            if (present[key]) {
+                present[key] = false;
+                --num_present;
+                ++expected_destroyed;
+            }
+            break;
+        }
+
+        if (!CheckItem(table, key, present[key], values[key])) {
+            result = false;
+        }
+    }
+
+    for (i = 0; i < NUM_KEYS && result; ++i) {
+        result = CheckItem(table, (Uint32)i, present[i], values[i]);
+    }
+
+    SDL_IterateHashTable(table, CountItem, &num_iterated);
+    if (num_iterated != num_present || SDL_GetNumHashTableItems(table) != num_present) {
+        SDL_Log("Table has %d items and iterated %d, expected %d", SDL_GetNumHashTableItems(table), num_iterated, num_present);
+        result = false;
+    }
+    /* Lock-free tables may hold on to removed items for a little while */
+    if (lockfree ? (num_destroyed > expected_destroyed) : (num_destroyed != expected_destroyed)) {
+        SDL_Log("%d items were destroyed, expected %d", num_destroyed, expected_destroyed);
+        result = false;
+    }
+
+    SDL_ClearHashTable(table);
+    if (!SDL_HashTableEmpty(table) || (!lockfree && num_destroyed != expected_destroyed + num_present)) {
+        SDL_Log("SDL_ClearHashTable() left %d items behind", SDL_GetNumHashTableItems(table));
+        result = false;
+    }
+    result = CheckItem(table, 0, false, 0) && result;
+
+    SDL_DestroyHashTable(table);
+    if (num_destroyed != expected_destroyed + num_present) {
+        SDL_Log("%d items were destroyed in the end, expected %d", num_destroyed, expected_destroyed + num_present);
+        result = false;
+    }
+
+    SDL_Log("Consistency%s: %d operations, %d keys left before clearing: %s", lockfree ? " (lock-free)" : "", num_ops, num_present, result ? "passed" : "FAILED");
+    return result;
+}
+
+static double MillionsPerSecond(int count, Uint64 start, Uint64 end)
+{
+    return (end > start) ? (count / ((end - start) / 1000000000.0)) / 1000000.0 : 0.0;
+}
+
+/* Keys for the concurrent test are allocated and freed along with their item, and
+   poisoned when they are freed. The table compares them while looking things up,
+   so a reader would notice if a key got freed while it was still looking at it. */
+typedef struct
+{
+    Uint32 id;
+    Uint32 check;
+} ConcurrentKey;
+
+#define CONCURRENT_KEYS 1024
+#define CONCURRENT_CHECK(id) ((id) * 0x9E3779B1u)
+
+typedef struct
+{
+    SDL_HashTable *table;
+    SDL_Thread *thread;
+    int lookups;
+    int found;
+} ReaderData;
+
+static SDL_AtomicInt readers_done;
+static SDL_AtomicInt bad_keys;
+
+static Uint32 SDLCALL HashConcurrentKey(void *unused, const void *key)
+{
+    (void)unused;
+    return ((const ConcurrentKey *)key)->id;
+}
+
+static bool SDLCALL MatchConcurrentKey(void *unused, const void *a, const void *b)
+{
+    const ConcurrentKey *key_a = (const ConcurrentKey *)a;
+    const ConcurrentKey *key_b = (const ConcurrentKey *)b;
+    (void)unused;
+    if (key_a->check != CONCURRENT_CHECK(key_a->id) || key_b->check != CONCURRENT_CHECK(key_b->id)) {
+        SDL_AddAtomicInt(&bad_keys, 1);
+    }
+    return key_a->id == key_b->id;
+}
+
+static void SDLCALL DestroyConcurrentKey(void *unused, const void *key, const void *value)
+{
+    ConcurrentKey *item = (ConcurrentKey *)key;
+    (void)unused;
+    (void)value;
+    item->check = ~item->check;
+    SDL_free(item);
+}
+
+static int SDLCALL Reader(void *_data)
+{
+    ReaderData *data = (ReaderData *)_data;
+    Uint64 seed = (Uint64)(uintptr_t)data;
+    ConcurrentKey key;
+
+    while (!SDL_GetAtomicInt(&readers_done)) {
+        key.id = SDL_rand_r(&seed, CONCURRENT_KEYS);
+        key.check = CONCURRENT_CHECK(key.id);
+        if (SDL_FindInHashTable(data->table, &key, NULL)) {
+            ++data->found;
+        }
+        ++data->lookups;
+        if ((data->lookups % 1024) == 0) {
+            SDL_Delay(0);  /* let the writer in, the RW lock would starve it otherwise */
+        }
+    }
+    return 0;
+}
+
+/* Readers look up keys while the main thread keeps replacing, removing and
+   inserting them, which also makes the table resize and purge tombstones.
+   The writes stop early after max_ns, in case the readers keep the writer out. */
+static bool RunConcurrentTest(bool lockfree, int num_readers, int num_writes, Uint64 max_ns)
+{
+    ReaderData readers[8];
+    SDL_HashTable *table;
+    Uint64 seed = 1, start, end;
+    int lookups = 0, found = 0;
+    bool result = true;
+    int i;
+
+    if (lockfree) {
+        table = SDL_CreateLockFreeHashTable(0, HashConcurrentKey, MatchConcurrentKey, DestroyConcurrentKey, NULL);
+    } else {
+        table = SDL_CreateHashTable(0, true, HashConcurrentKey, MatchConcurrentKey, DestroyConcurrentKey, NULL);
+    }
+    if (!table) {
+        SDL_Log("SDL_CreateHashTable() failed: %s", SDL_GetError());
+        return false;
+    }
+
+    SDL_SetAtomicInt(&readers_done, 0);
+    SDL_SetAtomicInt(&bad_keys, 0);
+    SDL_zeroa(readers);
+    for (i = 0; i < num_readers; ++i) {
+        readers[i].table = table;
+        readers[i].thread = SDL_CreateThread(Reader, "HashReader", &readers[i]);
+        if (!readers[i].thread) {
+            SDL_Log("Couldn't create thread: %s", SDL_GetError());
+            num_readers = i;
+            result = false;
+            break;
+        }
+    }
+
+    start = SDL_GetTicksNS();
+    for (i = 0; i < num_writes && result; ++i) {
+        const Uint32 id = SDL_rand_r(&seed, CONCURRENT_KEYS);
+        ConcurrentKey *key = (ConcurrentKey *)SDL_malloc(sizeof(*key));
+        if (!key) {
+            result = false;
+            break;
+        }
+        key->id = id;
+        key->check = CONCURRENT_CHECK(id);
+        if (SDL_rand_r(&seed, 4) == 0) {
+            SDL_RemoveFromHashTable(table, key);
+            SDL_free(key);
+        } else {
+            SDL_InsertIntoHashTable(table, key, NULL, true);
+        }
+        if ((i % 1024) == 0) {
+            SDL_Delay(0);  /* let the readers in, even on a single core */
+            if (SDL_GetTicksNS() - start >= max_ns) {
+                ++i;
+                break;
+            }
+        }
+    }
+    num_writes = i;
+    SDL_SetAtomicInt(&readers_done, 1);
+
+    for (i = 0; i < num_readers; ++i) {
+        SDL_WaitThread(readers[i].thread, NULL);
+        lookups += readers[i].lookups;
+        found += readers[i].found;
+    }
+    end = SDL_GetTicksNS();
+
+    SDL_DestroyHashTable(table);
+
+    SDL_Log("%s, %d readers: %d writes in %f sec, %d lookups (%d found), %d bad keys seen",
+            lockfree ? "Lock-free" : "RW lock  ", num_readers, num_writes, (end - start) / 1000000000.0,
+            lookups, found, SDL_GetAtomicInt(&bad_keys));
+    return result && SDL_GetAtomicInt(&bad_keys) == 0;
+}
+
+typedef struct
+{
+    SDL_HashTable *table;
+    SDL_Thread *thread;
+    int lookups;
+    int found;
+} LookupData;
+
+static int SDLCALL LookupThread(void *_data)
+{
+    LookupData *data = (LookupData *)_data;
+    int i;
+
+    for (i = 0; i < data->lookups; ++i) {
+        if (SDL_FindInHashTable(data->table, (const void *)(uintptr_t)(i & (CONCURRENT_KEYS - 1)), NULL)) {
+            ++data->found;
+        }
+    }
+    return 0;
+}
+
+/* Lookups only, from several threads at once, in a table that doesn't change */
+static bool RunReadBenchmark(bool lockfree, int num_threads, int lookups_per_thread)
+{
+    LookupData threads[8];
+    SDL_HashTable *table;
+    Uint64 start, end;
+    bool result = true;
+    int i;
+
+    if (lockfree) {
+        table = SDL_CreateLockFreeHashTable(CONCURRENT_KEYS, SDL_HashID, SDL_KeyMatchID, NULL, NULL);
+    } else {
+        table = SDL_CreateHashTable(CONCURRENT_KEYS, true, SDL_HashID, SDL_KeyMatchID, NULL, NULL);
+    }
+    if (!table) {
+        SDL_Log("SDL_CreateHashTable() failed: %s", SDL_GetError());
+        return false;
+    }
+    for (i = 0; i < CONCURRENT_KEYS; ++i) {
+        SDL_InsertIntoHashTable(table, (const void *)(uintptr_t)i, NULL, false);
+    }
+
+    SDL_zeroa(threads);
+    start = SDL_GetTicksNS();
+    for (i = 0; i < num_threads; ++i) {
+        threads[i].table = table;
+        threads[i].lookups = lookups_per_thread;
+        threads[i].thread = SDL_CreateThread(LookupThread, "HashLookup", &threads[i]);
+        if (!threads[i].thread) {
+            SDL_Log("Couldn't create thread: %s", SDL_GetError());
+            num_threads = i;
+            result = false;
+            break;
+        }
+    }
+    for (i = 0; i < num_threads; ++i) {
+        SDL_WaitThread(threads[i].thread, NULL);
+        if (threads[i].found != lookups_per_thread) {
+            result = false;
+        }
+    }
+    end = SDL_GetTicksNS();
+
+    SDL_DestroyHashTable(table);
+
+    SDL_Log("%s, %d threads: %.1f M lookups/s", lockfree ? "Lock-free" : "RW lock  ", num_threads,
+            MillionsPerSecond(num_threads * lookups_per_thread, start, end));
+    return result;
+}
+
+static size_t GetTableMemory(const SDL_HashTable *table)
+{
+    const Uint32 capacity = table->slots->capacity;
+    return sizeof(*table) + sizeof(SDL_HashSlots) + SDL_max(capacity, GROUP_WIDTH) + 2 * sizeof(void *) * capacity;
+}
+
+static bool RunBenchmark(const char *name, const void **keys, const void **misses, int num_keys,
+                         SDL_HashCallback hash, SDL_HashKeyMatchCallback keymatch)
+{
+    SDL_HashTable *table;
+    Uint64 start, insert_time, hit_time, miss_time, remove_time;
+    size_t memory;
+    int hits = 0, i;
+
+    table = SDL_CreateHashTable(0, false, hash, keymatch, NULL, NULL);
+    if (!table) {
+        SDL_Log("SDL_CreateHashTable() failed: %s", SDL_GetError());
+        return false;
+    }
+
+    start = SDL_GetTicksNS();
+    for (i = 0; i < num_keys; ++i) {
+        SDL_InsertIntoHashTable(table, keys[i], keys[i], false);
+    }
+    insert_time = SDL_GetTicksNS();
+
+    for (i = 0; i < num_keys; ++i) {
+        const void *value;
+        if (SDL_FindInHashTable(table, keys[i], &value) && value == keys[i]) {
+            ++hits;
+        }
+    }
+    hit_time = SDL_GetTicksNS();
+
+    for (i = 0; i < num_keys; ++i) {
+        if (SDL_FindInHashTable(table, misses[i], NULL)) {
+            --hits;
+        }
+    }
+    miss_time = SDL_GetTicksNS();
+
+    memory = GetTableMemory(table);
+
+    for (i = 0; i < num_keys; ++i) {
+        SDL_RemoveFromHashTable(table, keys[i]);
+    }
+    remove_time = SDL_GetTicksNS();
+
+    SDL_Log("%-6s %7d keys: insert %6.1f M/s, hit %6.1f M/s, miss %6.1f M/s, remove %6.1f M/s, %5.1f bytes/entry",
+            name, num_keys,
+            MillionsPerSecond(num_keys, start, insert_time),
+            MillionsPerSecond(num_keys, insert_time, hit_time),
+            MillionsPerSecond(num_keys, hit_time, miss_time),
+            MillionsPerSecond(num_keys, miss_time, remove_time),
+            (double)memory / num_keys);
+
+    SDL_DestroyHashTable(table);
+
+    if (hits != num_keys) {
+        SDL_Log("Only %d of %d lookups gave the right answer", hits, num_keys);
+        return false;
+    }
+    return true;
+}
+
+static bool RunBenchmarks(int num_keys)
+{
+    const void **keys = (const void **)SDL_malloc(2 * num_keys * sizeof(*keys));
+    char *strings = (char *)SDL_malloc(2 * num_keys * 16);
+    bool result = true;
+    int size, i;
+
+    if (!keys || !strings) {
+        SDL_free(keys);
+        SDL_free(strings);
+        return false;
+    }
+
+    for (size = 16; size <= num_keys && result; size *= 16) {
+        /* Spread out IDs like the ones used for windows, properties and joysticks */
+        for (i = 0; i < 2 * size; ++i) {
+            keys[i] = (const void *)(uintptr_t)(1 + i * 7);
+        }
+        result = RunBenchmark("ID", keys, keys + size, size, SDL_HashID, SDL_KeyMatchID) && result;
+
+        for (i = 0; i < 2 * size; ++i) {
+            char *string = strings + i * 16;
+            /* Multiplying by an odd number keeps the names unique but scrambles their order */
+            (void)SDL_snprintf(string, 16, "prop.%08" SDL_PRIx32, (Uint32)i * 0x2545F491u);
+            string[4] = (i < size) ? '.' : ':';  /* make sure misses miss */
+            keys[i] = string;
+        }
+        result = RunBenchmark("string", keys, keys + size, size, SDL_HashString, SDL_KeyMatchString) && result;
+    }
+
+    SDL_free(keys);
+    SDL_free(strings);
+    return result;
+}
+
+/* Counts how evenly hashes of similar names spread over 2^bits buckets, taking
+   either the low or the high bits, and fails if the chi-squared value is more than
+   six standard deviations above what a uniform hash would give. */
+static bool CheckDistribution(const char *name, const Uint32 *hashes, int count, int bits, bool high_bits)
+{
+    const int num_buckets = 1 << bits;
+    int *buckets = (int *)SDL_calloc(num_buckets, sizeof(*buckets));
+    const double expected = (double)count / num_buckets;
+    const double df = num_buckets - 1;
+    double chi2 = 0.0;
+    int i;
+
+    if (!buckets) {
+        return false;
+    }
+    for (i = 0; i < count; ++i) {
+        const Uint32 bucket = high_bits ? (hashes[i] >> (32 - bits)) : (hashes[i] & (num_buckets - 1));
+        ++buckets[bucket];
+    }
+    for (i = 0; i < num_buckets; ++i) {
+        chi2 += (buckets[i] - expected) * (buckets[i] - expected) / expected;
+    }
+    SDL_free(buckets);
+
+    if (chi2 > df + 6.0 * SDL_sqrt(2.0 * df)) {
+        SDL_Log("%s: %s %d bits are poorly distributed, chi-squared %.1f for %d degrees of freedom",
+                name, high_bits ? "high" : "low", bits, chi2, (int)df);
+        return false;
+    }
+    return true;
+}
+
+static int SDLCALL CompareHashes(const void *a, const void *b)
+{
+    const Uint32 A = *(const Uint32 *)a;
+    const Uint32 B = *(const Uint32 *)b;
+    return (A < B) ? -1 : (A > B);
+}
+
+static bool RunStringHashTest(void)
+{
+    enum { NUM_NAMES = 65536 };
+    static const char *formats[] = {
+        "SDL.window.create.%d",
+        "%d",
+        "SDL.texture.create.%08x.number",
+        "SDL.a.really.long.property.name.like.the.ones.used.by.gpu.backends.%d",
+    };
+    Uint32 *hashes = (Uint32 *)SDL_malloc(NUM_NAMES * sizeof(*hashes));
+    size_t total_length = 0;
+    bool result = true;
+    int f, i;
+
+    if (!hashes) {
+        return false;
+    }
+
+    for (f = 0; f < SDL_arraysize(formats); ++f) {
+        int collisions = 0;
+
+        for (i = 0; i < NUM_NAMES; ++i) {
+            char name[128];
+            const size_t length = (size_t)SDL_snprintf(name, sizeof(name), formats[f], i);
+            hashes[i] = SDL_HashString(NULL, name);
+            total_length += length;
+        }
+
+        result = CheckDistribution(formats[f], hashes, NUM_NAMES, 10, false) && result;
+        result = CheckDistribution(formats[f], hashes, NUM_NAMES, 7, true) && result;
+
+        /* With 2^16 names, a 32-bit hash should only collide about once on average */
+        SDL_qsort(hashes, NUM_NAMES, sizeof(*hashes), CompareHashes);
+        for (i = 1; i < NUM_NAMES; ++i) {
+            if (hashes[i] == hashes[i - 1]) {
+                ++collisions;
+            }
+        }
+        if (collisions > 8) {
+            SDL_Log("%s: %d full hash collisions", formats[f], collisions);
+            result = false;
+        }
+    }
+    SDL_free(hashes);
+
+    SDL_Log("String hash: %d names of %.1f bytes on average, distribution %s", (int)(NUM_NAMES * SDL_arraysize(formats)),
+            (double)total_length / (NUM_NAMES * SDL_arraysize(formats)), result ? "passed" : "FAILED");
+    return result;
+}
+
+/* The kind of lookup that most string hashing is for */
+static bool RunPropertyBenchmark(int num_lookups)
+{
+    static const char *names[] = {
+        SDL_PROP_WINDOW_CREATE_ALWAYS_ON_TOP_BOOLEAN,
+        SDL_PROP_WINDOW_CREATE_BORDERLESS_BOOLEAN,
+        SDL_PROP_WINDOW_CREATE_FOCUSABLE_BOOLEAN,
+        SDL_PROP_WINDOW_CREATE_FLAGS_NUMBER,
+        SDL_PROP_WINDOW_CREATE_FULLSCREEN_BOOLEAN,
+        SDL_PROP_WINDOW_CREATE_HEIGHT_NUMBER,
+        SDL_PROP_WINDOW_CREATE_HIDDEN_BOOLEAN,
+        SDL_PROP_WINDOW_CREATE_HIGH_PIXEL_DENSITY_BOOLEAN,
+        SDL_PROP_WINDOW_CREATE_MAXIMIZED_BOOLEAN,
+        SDL_PROP_WINDOW_CREATE_OPENGL_BOOLEAN,
+        SDL_PROP_WINDOW_CREATE_RESIZABLE_BOOLEAN,
+        SDL_PROP_WINDOW_CREATE_TITLE_STRING,
+        SDL_PROP_WINDOW_CREATE_WIDTH_NUMBER,
+        SDL_PROP_WINDOW_CREATE_X_NUMBER,
+        SDL_PROP_WINDOW_CREATE_Y_NUMBER,
+        SDL_PROP_WINDOW_CREATE_WAYLAND_CREATE_EGL_WINDOW_BOOLEAN,
+    };
+    SDL_PropertiesID props = SDL_CreateProperties();
+    Uint64 start, end;
+    int found = 0, i;
+
+    if (!props) {
+        SDL_Log("SDL_CreateProperties() failed: %s", SDL_GetError());
+        return false;
+    }
+    for (i = 0; i < SDL_arraysize(names); ++i) {
+        SDL_SetStringProperty(props, names[i], names[i]);
+    }
+
+    start = SDL_GetTicksNS();
+    for (i = 0; i < num_lookups; ++i) {
+        const char *name = names[i & (SDL_arraysize(names) - 1)];
+        if (SDL_GetStringProperty(props, name, NULL) != NULL) {
+            ++found;
+        }
+    }
+    end = SDL_GetTicksNS();
+
+    SDL_DestroyProperties(props);
+
+    SDL_Log("SDL_GetStringProperty(): %.1f M lookups/s", MillionsPerSecond(num_lookups, start, end));
+    return found == num_lookups;
+}
+
+int main(int argc, char *argv[])
+{
+    SDLTest_CommonState *state;
+    int num_keys = 0;
+    int num_ops, num_writes;
+    Uint64 max_ns;
+    bool quick = false;
+    int i;
+    bool result = true;
+
+    /* Initialize test framework */
+    state = SDLTest_CommonCreateState(argv, 0);
+    if (!state) {
+        return 1;
+    }
+
+    /* Parse commandline */
+    for (i = 1; i < argc;) {
+        int consumed;
+
+        consumed = SDLTest_CommonArg(state, i);
+        if (consumed == 0) {
+            consumed = -1;
+            if (SDL_strcasecmp(argv[i], "--keys") == 0 && argv[i + 1]) {
+                num_keys = SDL_atoi(argv[i + 1]);
+                consumed = 2;
+            }
+        }
+        if (consumed < 0 || num_keys < 0) {
+            static const char *options[] = { "[--keys N]", NULL };
+            SDLTest_CommonLogUsage(state, argv[0], options);
+            return 1;
+        }
+        i += consumed;
+    }
+
+    if (SDL_GetEnvironmentVariable(SDL_GetEnvironment(), "SDL_TESTS_QUICK") != NULL) {
+        quick = true;
+    }
+    if (num_keys == 0) {
+        num_keys = quick ? 4096 : (1 << 20);
+    }
+    num_ops = quick ? 10000 : 100000;
+    num_writes = quick ? 5000 : 50000;
+    max_ns = quick ? SDL_NS_PER_SECOND / 2 : 2 * SDL_NS_PER_SECOND;
+
+    result = RunConsistencyTest(0, num_ops, false) && result;
+    result = RunConsistencyTest(SDL_GetPerformanceCounter(), num_ops, false) && result;
+    result = RunConsistencyTest(0, num_ops, true) && result;
+    result = RunConcurrentTest(false, 4, num_writes, max_ns) && result;
+    result = RunConcurrentTest(true, 4, num_writes, max_ns) && result;
+    for (i = 1; i <= 4; i *= 2) {
+        result = RunReadBenchmark(false, i, num_keys * 4) && result;
+        result = RunReadBenchmark(true, i, num_keys * 4) && result;
+    }
+    result = RunStringHashTest() && result;
+    result = RunPropertyBenchmark(num_keys * 4) && result;
+    result = RunBenchmarks(num_keys) && result;
+
+    SDLTest_CommonDestroyState(state);
+    return result ? 0 : 1;
+}
@@ -0,0 +1,324 @@
+/*
+  Copyright (C) 1997-2026 Sam Lantinga <slouken@libsdl.org>
+
+  This software is provided 'as-is', without any express or implied
+  warranty.  In no event will the authors be held liable for any damages
+  arising from the use of this software.
+
+  Permission is granted to anyone to use this software for any purpose,
+  including commercial applications, and to alter it and redistribute it
+  freely.
+*/
+
+/* Measures how fast several threads can allocate and free small blocks at
+   once, with and without SDL_HINT_MALLOC_THREAD_CACHE. Each thread keeps a
+   window of live blocks, and hands every other block it frees to the next
+   thread, so blocks are also freed by threads that didn't allocate them.
+   The contents of every block are checked before it is freed.
+
+   The hint only changes anything when SDL uses its built-in allocator.
+*/
+
+#include <SDL3/SDL.h>
+#include <SDL3/SDL_main.h>
+#include <SDL3/SDL_test.h>
+
+#define MAX_THREADS 64
+#define NUM_LIVE_BLOCKS 256
+#define MAX_BLOCK_SIZE 240
+
+typedef struct
+{
+    Uint8 *block;
+    size_t size;
+} Block;
+
+typedef struct
+{
+    int index;
+    int num_allocations;
+    int errors;
+    Uint64 seed;
+    Block live[NUM_LIVE_BLOCKS];
+    SDL_Mutex *handoff_lock;
+    Block handoff[NUM_LIVE_BLOCKS];
+    int num_handoff;
+    SDL_Thread *thread;
+} WorkerData;
+
+static WorkerData workers[MAX_THREADS];
+static int num_workers;
+static SDL_AtomicInt workers_started;
+static SDL_AtomicInt go;
+
+static bool CheckBlock(const Block *block)
+{
+    size_t i;
+
+    for (i = 0; i < block->size; ++i) {
+        if (block->block[i] != (Uint8)(block->size + i)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+static void FreeBlock(WorkerData *data, Block *block)
+{
+    if (block->block) {
+        if (!CheckBlock(block)) {
+            ++data->errors;
+        }
+        SDL_free(block->block);
+        block->block = NULL;
+    }
+}
+
+static void HandOffBlock(WorkerData *data, Block *block)
+{
+    WorkerData *next = &workers[(data->index + 1) % num_workers];
+    bool handed_off = false;
+
+    SDL_LockMutex(next->handoff_lock);
+    if (next->num_handoff < NUM_LIVE_BLOCKS) {
+        next->handoff[next->num_handoff++] = *block;
+        handed_off = true;
+    }
+    SDL_UnlockMutex(next->handoff_lock);
+
+    if (handed_off) {
+        block->block = NULL;
+    } else {
+        FreeBlock(data, block);
+    }
+}
+
+static void FreeHandedOffBlocks(WorkerData *data)
+{
+    Block blocks[NUM_LIVE_BLOCKS];
+    int i, count;
+
+    SDL_LockMutex(data->handoff_lock);
+    count = data->num_handoff;
+    SDL_memcpy(blocks, data->handoff, count * sizeof(*blocks));
+    data->num_handoff = 0;
+    SDL_UnlockMutex(data->handoff_lock);
+
+    for (i = 0; i < count; ++i) {
+        FreeBlock(data, &blocks[i]);
+    }
+}
+
+static int SDLCALL Worker(void *_data)
+{
+    WorkerData *data = (WorkerData *)_data;
+    int i;
+
+    SDL_AtomicIncRef(&workers_started);
+    while (!SDL_GetAtomicInt(&go)) {
+        SDL_CPUPauseInstruction();
+    }
+
+    for (i = 0; i < data->num_allocations; ++i) {
+        Block *block = &data->live[i % NUM_LIVE_BLOCKS];
+
+        if (block->block) {
+            if ((i & 1) && num_workers > 1) {
+                HandOffBlock(data, block);
+            } else {
+                FreeBlock(data, block);
+            }
+        }
+        if ((i % NUM_LIVE_BLOCKS) == 0) {
+            FreeHandedOffBlocks(data);
+        }
+
+        block->size = 1 + SDL_rand_r(&data->seed, MAX_BLOCK_SIZE);
+        block->block = (Uint8 *)SDL_malloc(block->size);
+        if (block->block) {
+            size_t j;
+            for (j = 0; j < block->size; ++j) {
+                block->block[j] = (Uint8)(block->size + j);
+            }
+        } else {
+            ++data->errors;
+        }
+    }
+    return 0;
+}
+
+static void CleanupWorkers(int count)
+{
+    int i, j;
+
+    for (i = 0; i < count; ++i) {
+        for (j = 0; j < NUM_LIVE_BLOCKS; ++j) {
+            FreeBlock(&workers[i], &workers[i].live[j]);
+        }
+        FreeHandedOffBlocks(&workers[i]);
+        SDL_DestroyMutex(workers[i].handoff_lock);
+    }
+}
+
+static bool RunAllocationTest(int num_threads, int allocations_per_thread, bool cached)
+{
+    Uint64 start, end;
+    int total = num_threads * allocations_per_thread;
+    int errors = 0, i;
+
+    SDL_SetHint(SDL_HINT_MALLOC_THREAD_CACHE, cached ? "1" : "0");
+
+    SDL_SetAtomicInt(&workers_started, 0);
+    SDL_SetAtomicInt(&go, 0);
+
+    SDL_zeroa(workers);
+    num_workers = num_threads;
+    for (i = 0; i < num_threads; ++i) {
+        workers[i].index = i;
+        workers[i].num_allocations = allocations_per_thread;
+        workers[i].seed = i + 1;
+        workers[i].handoff_lock = SDL_CreateMutex();
+        if (!workers[i].handoff_lock) {
+            SDL_Log("Couldn't create mutex: %s", SDL_GetError());
+            CleanupWorkers(i);
+            return false;
+        }
+    }
+    for (i = 0; i < num_threads; ++i) {
+        char name[64];
+        (void)SDL_snprintf(name, sizeof(name), "MallocWorker%d", i);
+        workers[i].thread = SDL_CreateThread(Worker, name, &workers[i]);
+        if (!workers[i].thread) {
+            SDL_Log("Couldn't create thread: %s", SDL_GetError());
+            SDL_SetAtomicInt(&go, 1);
+            while (--i >= 0) {
+                SDL_WaitThread(workers[i].thread, NULL);
+            }
+            CleanupWorkers(num_threads);
+            return false;
+        }
+    }
+    while (SDL_GetAtomicInt(&workers_started) < num_threads) {
+        SDL_Delay(0);
+    }
+
+    start = SDL_GetTicksNS();
+    SDL_SetAtomicInt(&go, 1);
+
+    for (i = 0; i < num_threads; ++i) {
+        SDL_WaitThread(workers[i].thread, NULL);
+    }
+
+    end = SDL_GetTicksNS();
+
+    CleanupWorkers(num_threads);
+    for (i = 0; i < num_threads; ++i) {
+        errors += workers[i].errors;
+    }
+    if (errors > 0) {
+        SDL_Log("Workers found %d bad blocks", errors);
+    }
+
+    {
+        const double seconds = (end - start) / 1000000000.0;
+        SDL_Log("%2d threads%s: %d allocations in %f sec, %.0f allocations/sec",
+                num_threads, cached ? ", cached" : "", total, seconds, seconds > 0.0 ? total / seconds : 0.0);
+    }
+    return errors == 0;
+}
+
+int main(int argc, char *argv[])
+{
+    SDLTest_CommonState *state;
+    int num_threads = 0;
+    int allocations_per_thread = 0;
+    int i;
+    bool enable_threads = true;
+    bool result = true;
+
+    /* Initialize test framework */
+    state = SDLTest_CommonCreateState(argv, 0);
+    if (!state) {
+        return 1;
+    }
+
+    /* Parse commandline */
+    for (i = 1; i < argc;) {
+        int consumed;
+
+        consumed = SDLTest_CommonArg(state, i);
+        if (consumed == 0) {
+            consumed = -1;
+            if (SDL_strcasecmp(argv[i], "--no-threads") == 0) {
+                enable_threads = false;
+                consumed = 1;
+            } else if (SDL_strcasecmp(argv[i], "--threads") == 0 && argv[i + 1]) {
+                num_threads = SDL_atoi(argv[i + 1]);
+                consumed = 2;
+            } else if (SDL_strcasecmp(argv[i], "--allocations") == 0 && argv[i + 1]) {
+                allocations_per_thread = SDL_atoi(argv[i + 1]);
+                consumed = 2;
+            }
+        }
+        if (consumed < 0 || num_threads < 0 || num_threads > MAX_THREADS || allocations_per_thread < 0) {
+            static const char *options[] = {
+                "[--no-threads]",
+                "[--threads N]",
+                "[--allocations N]",
+                NULL
+            };
+            SDLTest_CommonLogUsage(state, argv[0], options);
+            return 1;
+        }
+        i += consumed;
+    }
+
+    if (allocations_per_thread == 0) {
+        if (SDL_GetEnvironmentVariable(SDL_GetEnvironment(), "SDL_TESTS_QUICK") != NULL) {
+            allocations_per_thread = 100000;
+        } else {
+            allocations_per_thread = 500000;
+        }
+    }
+
+    if (!SDL_Init(0)) {
+        SDL_Log("Couldn't initialize SDL: %s", SDL_GetError());
+        return 1;
+    }
+
+    if (!enable_threads) {
+        for (i = 0; i < 2; ++i) {
+            const bool cached = (i == 1);
+            Uint64 start, end;
+            int j;
+
+            SDL_SetHint(SDL_HINT_MALLOC_THREAD_CACHE, cached ? "1" : "0");
+            SDL_zeroa(workers);
+            num_workers = 1;
+            workers[0].num_allocations = allocations_per_thread;
+            workers[0].seed = 1;
+            SDL_SetAtomicInt(&go, 1);
+            start = SDL_GetTicksNS();
+            Worker(&workers[0]);
+            end = SDL_GetTicksNS();
+            for (j = 0; j < NUM_LIVE_BLOCKS; ++j) {
+                FreeBlock(&workers[0], &workers[0].live[j]);
+            }
+            SDL_Log("No threads%s: %d allocations in %f sec", cached ? ", cached" : "", allocations_per_thread, (end - start) / 1000000000.0);
+            result = (workers[0].errors == 0) && result;
+        }
+    } else if (num_threads > 0) {
+        result = RunAllocationTest(num_threads, allocations_per_thread, false) && result;
+        result = RunAllocationTest(num_threads, allocations_per_thread, true) && result;
+    } else {
+        static const int thread_counts[] = { 1, 2, 4, 8 };
+        for (i = 0; i < SDL_arraysize(thread_counts); ++i) {
+            result = RunAllocationTest(thread_counts[i], allocations_per_thread, false) && result;
+            result = RunAllocationTest(thread_counts[i], allocations_per_thread, true) && result;
+        }
+    }
+
+    SDL_Quit();
+    SDLTest_CommonDestroyState(state);
+    return result ? 0 : 1;
+}
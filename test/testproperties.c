@@ -0,0 +1,251 @@
+/*
+  Copyright (C) 1997-2026 Sam Lantinga <slouken@libsdl.org>
+
+  This software is provided 'as-is', without any express or implied
+  warranty.  In no event will the authors be held liable for any damages
+  arising from the use of this software.
+
+  Permission is granted to anyone to use this software for any purpose,
+  including commercial applications, and to alter it and redistribute it
+  freely.
+*/
+
+/* Measures how property lookups hold up when several threads read the same
+   group of properties at once, with and without another thread changing a
+   property in that group at the same time. It also checks that the readers
+   always get back the values that were set.
+*/
+
+#include <SDL3/SDL.h>
+#include <SDL3/SDL_main.h>
+#include <SDL3/SDL_test.h>
+
+#define MAX_READERS 64
+#define NUM_PROPERTIES 16
+
+typedef struct
+{
+    int num_lookups;
+    int errors;
+    SDL_Thread *thread;
+} ReaderData;
+
+static SDL_PropertiesID props;
+static char number_names[NUM_PROPERTIES][64];
+static char pointer_names[NUM_PROPERTIES][64];
+static int pointers[NUM_PROPERTIES];
+static SDL_AtomicInt readers_started;
+static SDL_AtomicInt go;
+static SDL_AtomicInt stop_writer;
+
+static int SDLCALL Reader(void *_data)
+{
+    ReaderData *data = (ReaderData *)_data;
+    int i;
+
+    SDL_AtomicIncRef(&readers_started);
+    while (!SDL_GetAtomicInt(&go)) {
+        SDL_CPUPauseInstruction();
+    }
+
+    for (i = 0; i < data->num_lookups; ++i) {
+        const int index = i % NUM_PROPERTIES;
+        if (i & 1) {
+            if (SDL_GetPointerProperty(props, pointer_names[index], NULL) != &pointers[index]) {
+                ++data->errors;
+            }
+        } else {
+            if (SDL_GetNumberProperty(props, number_names[index], -1) != index) {
+                ++data->errors;
+            }
+        }
+    }
+    return 0;
+}
+
+static int SDLCALL Writer(void *unused)
+{
+    Sint64 value = 0;
+
+    while (!SDL_GetAtomicInt(&go)) {
+        SDL_CPUPauseInstruction();
+    }
+
+    while (!SDL_GetAtomicInt(&stop_writer)) {
+        SDL_SetNumberProperty(props, "writer.counter", ++value);
+        SDL_ClearProperty(props, "writer.temporary");
+        SDL_SetStringProperty(props, "writer.temporary", "temporary");
+    }
+    return 0;
+}
+
+static bool RunContentionTest(int num_readers, int lookups_per_reader, bool with_writer)
+{
+    ReaderData readers[MAX_READERS];
+    SDL_Thread *writer = NULL;
+    Uint64 start, end;
+    int total = num_readers * lookups_per_reader;
+    int errors = 0, i;
+    bool result = true;
+
+    SDL_SetAtomicInt(&readers_started, 0);
+    SDL_SetAtomicInt(&go, 0);
+    SDL_SetAtomicInt(&stop_writer, 0);
+
+    SDL_zeroa(readers);
+    for (i = 0; i < num_readers; ++i) {
+        char name[64];
+        (void)SDL_snprintf(name, sizeof(name), "PropertyReader%d", i);
+        readers[i].num_lookups = lookups_per_reader;
+        readers[i].thread = SDL_CreateThread(Reader, name, &readers[i]);
+        if (!readers[i].thread) {
+            SDL_Log("Couldn't create thread: %s", SDL_GetError());
+            SDL_SetAtomicInt(&go, 1);
+            while (--i >= 0) {
+                SDL_WaitThread(readers[i].thread, NULL);
+            }
+            return false;
+        }
+    }
+    if (with_writer) {
+        writer = SDL_CreateThread(Writer, "PropertyWriter", NULL);
+        if (!writer) {
+            SDL_Log("Couldn't create thread: %s", SDL_GetError());
+            result = false;
+        }
+    }
+    while (SDL_GetAtomicInt(&readers_started) < num_readers) {
+        SDL_Delay(0);
+    }
+
+    start = SDL_GetTicksNS();
+    SDL_SetAtomicInt(&go, 1);
+
+    for (i = 0; i < num_readers; ++i) {
+        SDL_WaitThread(readers[i].thread, NULL);
+        errors += readers[i].errors;
+    }
+
+    end = SDL_GetTicksNS();
+
+    SDL_SetAtomicInt(&stop_writer, 1);
+    SDL_WaitThread(writer, NULL);
+
+    if (errors > 0) {
+        SDL_Log("Readers got %d wrong values", errors);
+        result = false;
+    }
+
+    {
+        const double seconds = (end - start) / 1000000000.0;
+        SDL_Log("%2d readers%s: %d lookups in %f sec, %.0f lookups/sec",
+                num_readers, with_writer ? " and a writer" : "", total, seconds, seconds > 0.0 ? total / seconds : 0.0);
+    }
+    return result;
+}
+
+int main(int argc, char *argv[])
+{
+    SDLTest_CommonState *state;
+    int num_readers = 0;
+    int lookups_per_reader = 0;
+    int i;
+    bool enable_threads = true;
+    bool result = true;
+
+    /* Initialize test framework */
+    state = SDLTest_CommonCreateState(argv, 0);
+    if (!state) {
+        return 1;
+    }
+
+    /* Parse commandline */
+    for (i = 1; i < argc;) {
+        int consumed;
+
+        consumed = SDLTest_CommonArg(state, i);
+        if (consumed == 0) {
+            consumed = -1;
+            if (SDL_strcasecmp(argv[i], "--no-threads") == 0) {
+                enable_threads = false;
+                consumed = 1;
+            } else if (SDL_strcasecmp(argv[i], "--readers") == 0 && argv[i + 1]) {
+                num_readers = SDL_atoi(argv[i + 1]);
+                consumed = 2;
+            } else if (SDL_strcasecmp(argv[i], "--lookups") == 0 && argv[i + 1]) {
+                lookups_per_reader = SDL_atoi(argv[i + 1]);
+                consumed = 2;
+            }
+        }
+        if (consumed < 0 || num_readers < 0 || num_readers > MAX_READERS || lookups_per_reader < 0) {
+            static const char *options[] = {
+                "[--no-threads]",
+                "[--readers N]",
+                "[--lookups N]",
+                NULL
+            };
+            SDLTest_CommonLogUsage(state, argv[0], options);
+            return 1;
+        }
+        i += consumed;
+    }
+
+    if (lookups_per_reader == 0) {
+        if (SDL_GetEnvironmentVariable(SDL_GetEnvironment(), "SDL_TESTS_QUICK") != NULL) {
+            lookups_per_reader = 20000;
+        } else {
+            lookups_per_reader = 200000;
+        }
+    }
+
+    if (!SDL_Init(0)) {
+        SDL_Log("Couldn't initialize SDL: %s", SDL_GetError());
+        return 1;
+    }
+
+    props = SDL_CreateProperties();
+    if (!props) {
+        SDL_Log("Couldn't create properties: %s", SDL_GetError());
+        SDL_Quit();
+        return 1;
+    }
+    for (i = 0; i < NUM_PROPERTIES; ++i) {
+        (void)SDL_snprintf(number_names[i], sizeof(number_names[i]), "testproperties.number.%d", i);
+        (void)SDL_snprintf(pointer_names[i], sizeof(pointer_names[i]), "testproperties.pointer.%d", i);
+        if (!SDL_SetNumberProperty(props, number_names[i], i) ||
+            !SDL_SetPointerProperty(props, pointer_names[i], &pointers[i])) {
+            SDL_Log("Couldn't set properties: %s", SDL_GetError());
+            SDL_DestroyProperties(props);
+            SDL_Quit();
+            return 1;
+        }
+    }
+
+    if (!enable_threads) {
+        ReaderData reader;
+        Uint64 start, end;
+
+        SDL_zero(reader);
+        reader.num_lookups = lookups_per_reader;
+        SDL_SetAtomicInt(&go, 1);
+        start = SDL_GetTicksNS();
+        Reader(&reader);
+        end = SDL_GetTicksNS();
+        SDL_Log("No threads: %d lookups in %f sec", lookups_per_reader, (end - start) / 1000000000.0);
+        result = (reader.errors == 0);
+    } else if (num_readers > 0) {
+        result = RunContentionTest(num_readers, lookups_per_reader, false) && result;
+        result = RunContentionTest(num_readers, lookups_per_reader, true) && result;
+    } else {
+        static const int reader_counts[] = { 1, 2, 4, 8 };
+        for (i = 0; i < SDL_arraysize(reader_counts); ++i) {
+            result = RunContentionTest(reader_counts[i], lookups_per_reader, false) && result;
+            result = RunContentionTest(reader_counts[i], lookups_per_reader, true) && result;
+        }
+    }
+
+    SDL_DestroyProperties(props);
+    SDL_Quit();
+    SDLTest_CommonDestroyState(state);
+    return result ? 0 : 1;
+}
@@ -436,6 +436,227 @@ static int SDLCALL qsort_testRandomSorted(void *arg)
     return TEST_COMPLETED;
 }
 
+/* McIlroy's "A Killer Adversary for Quicksort": the values of the elements
+ * are decided while the sort runs, so that every pivot it picks is as bad as
+ * possible. A quicksort without a fallback takes O(n^2) comparisons.
+ */
+typedef struct {
+    int *values;
+    int gas;
+    int num_solid;
+    int candidate;
+    Uint64 num_compares;
+} Adversary;
+
+static int SDLCALL
+#ifdef TEST_STDLIB_QSORT
+adversary_compare_r(const void *_a, const void *_b, void *userdata)
+#else
+adversary_compare_r(void *userdata, const void *_a, const void *_b)
+#endif
+{
+    Adversary *adversary = (Adversary *)userdata;
+    const int a = *((const int *)_a);
+    const int b = *((const int *)_b);
+
+    adversary->num_compares += 1;
+    if (adversary->values[a] == adversary->gas && adversary->values[b] == adversary->gas) {
+        adversary->values[a == adversary->candidate ? a : b] = adversary->num_solid++;
+    }
+    if (adversary->values[a] == adversary->gas) {
+        adversary->candidate = a;
+    } else if (adversary->values[b] == adversary->gas) {
+        adversary->candidate = b;
+    }
+    return compare_int(&adversary->values[a], &adversary->values[b]);
+}
+
+static int SDLCALL qsort_testAdversarial(void *arg)
+{
+    unsigned int iteration;
+    (void)arg;
+
+    for (iteration = 0; iteration < count_arraylens; iteration++) {
+        const unsigned int arraylen = arraylens[iteration];
+        unsigned int i;
+        Uint64 log2_arraylen = 1;
+        Uint64 max_compares;
+        int *indices = SDL_malloc(sizeof(int) * arraylen);
+        Adversary adversary;
+
+        SDL_zero(adversary);
+        adversary.values = SDL_malloc(sizeof(int) * arraylen);
+        adversary.gas = (int)arraylen;
+        for (i = 0; i < arraylen; i++) {
+            indices[i] = i;
+            adversary.values[i] = adversary.gas;
+        }
+        while ((1u << log2_arraylen) < arraylen) {
+            log2_arraylen++;
+        }
+        max_compares = 8 * arraylen * log2_arraylen;
+
+        SDLTest_AssertPass("About to call SDL_qsort_r(%u) with an adversarial compare function", arraylen);
+        SDL_qsort_r(indices, arraylen, sizeof(int), adversary_compare_r, &adversary);
+        SDLTest_AssertCheck(adversary.num_compares <= max_compares,
+            "SDL_qsort_r made %" SDL_PRIu64 " comparisons, expected at most %" SDL_PRIu64, adversary.num_compares, max_compares);
+        for (i = 0; i < arraylen - 1; i++) {
+            if (adversary.values[indices[i]] > adversary.values[indices[i + 1]]) {
+                SDLTest_AssertCheck(false, "Element %u is sorted", i);
+                break;
+            }
+        }
+
+        SDL_free(indices);
+        SDL_free(adversary.values);
+    }
+    return TEST_COMPLETED;
+}
+
+#ifndef TEST_STDLIB_QSORT
+
+typedef struct {
+    Uint8 tag;
+    float depth;
+    Uint32 order;
+} Sprite;
+
+#define SPRITE_ISLE(A, B) ((A).depth < (B).depth || ((A).depth == (B).depth && (A).order < (B).order))
+
+#define CHECK_ELEMS_SORTED_ARRAY_SPRITES(TYPE, SORTED, INPUT, SIZE)                  \
+    do {                                                                             \
+        unsigned int check_index;                                                    \
+        for (check_index = 0; check_index < (SIZE); check_index++) {                 \
+            const Sprite *original = &(INPUT)[(SORTED)[check_index].order];          \
+            if (SDL_memcmp(&(SORTED)[check_index], original, sizeof(TYPE)) != 0) {   \
+                SDLTest_AssertCheck(false, STR(TYPE) "sorted[%u] is intact", check_index); \
+            }                                                                        \
+        }                                                                            \
+    } while (0)
+
+static int SDLCALL qsort_testSortByKey(void *arg)
+{
+    unsigned int iteration;
+    (void)arg;
+
+    for (iteration = 0; iteration < count_arraylens; iteration++) {
+        const unsigned int arraylen = arraylens[iteration];
+        unsigned int i;
+        int *ints = SDL_malloc(sizeof(int) * arraylen);
+        Sint64 *sint64s = SDL_malloc(sizeof(Sint64) * arraylen);
+        float *floats = SDL_malloc(sizeof(float) * arraylen);
+        double *doubles = SDL_malloc(sizeof(double) * arraylen);
+        Sprite *sprites = SDL_calloc(arraylen, sizeof(Sprite));
+
+        for (i = 0; i < arraylen; i++) {
+            ints[i] = SDLTest_RandomIntegerInRange(0, MAX_RANDOM_INT_VALUE - 1);
+            sint64s[i] = SDLTest_RandomSint64();
+            floats[i] = (SDLTest_RandomFloat() - 0.5f) * 1000.0f;
+            doubles[i] = (SDLTest_RandomDouble() - 0.5) * 1.0e10;
+            sprites[i].tag = (Uint8)i;
+            sprites[i].depth = (float)SDLTest_RandomIntegerInRange(-8, 8) * 0.5f;
+            sprites[i].order = i;
+        }
+
+        {
+            int *sorted = SDL_calloc(arraylen, sizeof(int));
+            TEST_QSORT_ARRAY_GENERIC(int, ints, arraylen,
+                SDL_SortByKey(sorted, arraylen, sizeof(int), 0, SDL_SORTKEY_SINT32),
+                CHECK_ELEMS_SORTED_ARRAY_RANDOM_INT, INT_ISLE, "SDL_SortByKey");
+            SDL_free(sorted);
+        }
+        {
+            Sint64 *sorted = SDL_calloc(arraylen, sizeof(Sint64));
+            TEST_QSORT_ARRAY_GENERIC(Sint64, sint64s, arraylen,
+                SDL_SortByKey(sorted, arraylen, sizeof(Sint64), 0, SDL_SORTKEY_SINT64),
+                CHECK_ELEMS_SORTED_ARRAY_RANDOM_NOP, INT_ISLE, "SDL_SortByKey");
+            SDL_free(sorted);
+        }
+        {
+            float *sorted = SDL_calloc(arraylen, sizeof(float));
+            TEST_QSORT_ARRAY_GENERIC(float, floats, arraylen,
+                SDL_SortByKey(sorted, arraylen, sizeof(float), 0, SDL_SORTKEY_FLOAT),
+                CHECK_ELEMS_SORTED_ARRAY_RANDOM_NOP, FLOAT_ISLE, "SDL_SortByKey");
+            SDL_free(sorted);
+        }
+        {
+            double *sorted = SDL_calloc(arraylen, sizeof(double));
+            TEST_QSORT_ARRAY_GENERIC(double, doubles, arraylen,
+                SDL_SortByKey(sorted, arraylen, sizeof(double), 0, SDL_SORTKEY_DOUBLE),
+                CHECK_ELEMS_SORTED_ARRAY_RANDOM_NOP, DOUBLE_ISLE, "SDL_SortByKey");
+            SDL_free(sorted);
+        }
+        {
+            double zeros[2] = { 0.0, -0.0 };
+            SDL_SortByKey(zeros, SDL_arraysize(zeros), sizeof(double), 0, SDL_SORTKEY_DOUBLE);
+            SDLTest_AssertCheck(SDL_copysign(1.0, zeros[0]) < 0.0 && SDL_copysign(1.0, zeros[1]) > 0.0, "-0.0 is sorted before 0.0");
+        }
+        {
+            /* Equal depths must keep their original order */
+            Sprite *sorted = SDL_calloc(arraylen, sizeof(Sprite));
+            const size_t depth_offset = (size_t)((Uint8 *)&sprites->depth - (Uint8 *)sprites);
+            TEST_QSORT_ARRAY_GENERIC(Sprite, sprites, arraylen,
+                SDL_SortByKey(sorted, arraylen, sizeof(Sprite), depth_offset, SDL_SORTKEY_FLOAT),
+                CHECK_ELEMS_SORTED_ARRAY_SPRITES, SPRITE_ISLE, "SDL_SortByKey");
+            SDL_free(sorted);
+        }
+
+        SDL_free(ints);
+        SDL_free(sint64s);
+        SDL_free(floats);
+        SDL_free(doubles);
+        SDL_free(sprites);
+    }
+    return TEST_COMPLETED;
+}
+
+static int SDLCALL qsort_testParallelSort(void *arg)
+{
+    unsigned int iteration;
+    (void)arg;
+
+    for (iteration = 0; iteration < count_arraylens; iteration++) {
+        const unsigned int arraylen = arraylens[iteration];
+        unsigned int i;
+        int *ints = SDL_malloc(sizeof(int) * arraylen);
+        VersionTuple *versions = SDL_calloc(arraylen, sizeof(VersionTuple));
+
+        for (i = 0; i < arraylen; i++) {
+            ints[i] = SDLTest_RandomIntegerInRange(0, MAX_RANDOM_INT_VALUE - 1);
+            versions[i].micro = SDLTest_RandomIntegerInRange(0, 255);
+            versions[i].minor = SDLTest_RandomIntegerInRange(0, 255);
+            versions[i].major = SDLTest_RandomIntegerInRange(0, 255);
+        }
+
+        {
+            int *sorted = SDL_calloc(arraylen, sizeof(int));
+            global_compare_cbfn = compare_int;
+            TEST_QSORT_ARRAY_GENERIC(int, ints, arraylen,
+                SDL_ParallelSort(sorted, arraylen, sizeof(int), generic_compare_r, &a_global_var, 0),
+                CHECK_ELEMS_SORTED_ARRAY_RANDOM_INT, INT_ISLE, "SDL_ParallelSort");
+            /* Ask for more threads than cores, so the runs are merged even on one core */
+            TEST_QSORT_ARRAY_GENERIC(int, ints, arraylen,
+                SDL_ParallelSort(sorted, arraylen, sizeof(int), generic_compare_r, &a_global_var, 5),
+                CHECK_ELEMS_SORTED_ARRAY_RANDOM_INT, INT_ISLE, "SDL_ParallelSort");
+            SDL_free(sorted);
+        }
+        {
+            VersionTuple *sorted = SDL_calloc(arraylen, sizeof(VersionTuple));
+            global_compare_cbfn = compare_version;
+            TEST_QSORT_ARRAY_GENERIC(VersionTuple, versions, arraylen,
+                SDL_ParallelSort(sorted, arraylen, sizeof(VersionTuple), generic_compare_r, &a_global_var, 5),
+                CHECK_ELEMS_SORTED_ARRAY_RANDOM_VERSION, VERSION_ISLE, "SDL_ParallelSort");
+            SDL_free(sorted);
+        }
+
+        SDL_free(ints);
+        SDL_free(versions);
+    }
+    return TEST_COMPLETED;
+}
+
+#endif /* !TEST_STDLIB_QSORT */
+
 static const SDLTest_TestCaseReference qsortTestAlreadySorted = {
     qsort_testAlreadySorted, "qsort_testAlreadySorted", "Test sorting already sorted array", TEST_ENABLED
 };
@@ -452,11 +673,30 @@ static const SDLTest_TestCaseReference qsortTestRandomSorted = {
     qsort_testRandomSorted, "qsort_testRandomSorted", "Test sorting a random array", TEST_ENABLED
 };
 
+static const SDLTest_TestCaseReference qsortTestAdversarial = {
+    qsort_testAdversarial, "qsort_testAdversarial", "Test sorting with a compare function that picks bad pivots on purpose", TEST_ENABLED
+};
+
+#ifndef TEST_STDLIB_QSORT
+static const SDLTest_TestCaseReference qsortTestSortByKey = {
+    qsort_testSortByKey, "qsort_testSortByKey", "Test sorting random arrays by integer and floating point keys", TEST_ENABLED
+};
+
+static const SDLTest_TestCaseReference qsortTestParallelSort = {
+    qsort_testParallelSort, "qsort_testParallelSort", "Test sorting random arrays on several threads", TEST_ENABLED
+};
+#endif
+
 static const SDLTest_TestCaseReference *qsortTests[] = {
     &qsortTestAlreadySorted,
     &qsortTestAlreadySortedExceptLast,
     &qsortTestReverseSorted,
     &qsortTestRandomSorted,
+    &qsortTestAdversarial,
+#ifndef TEST_STDLIB_QSORT
+    &qsortTestSortByKey,
+    &qsortTestParallelSort,
+#endif
     NULL
 };
 
@@ -234,6 +234,30 @@ int main(int argc, char *argv[])
     /* Wait for the results to be seen */
     SDL_Delay(1 * 1000);
 
+    /* Check accuracy of the frame pacer */
+    {
+        SDL_FramePacer *pacer = SDL_CreateFramePacer(SDL_NS_PER_SECOND / 60);
+        SDL_FramePacerStats stats;
+
+        if (pacer) {
+            SDL_Log("Pacing 100 frames at 60 FPS");
+            start = SDL_GetTicksNS();
+            for (i = 0; i < 100; ++i) {
+                SDL_WaitFramePacer(pacer);
+            }
+            now = SDL_GetTicksNS();
+            SDL_GetFramePacerStats(pacer, &stats);
+            SDL_Log("Took %.2f ms, expected %.2f ms, average jitter %.3f ms, max jitter %.3f ms, sleep overshoot %.3f ms",
+                    (double)(now - start) / SDL_NS_PER_MS, 100 * 1000.0 / 60,
+                    (double)stats.average_jitter_ns / SDL_NS_PER_MS, (double)stats.max_jitter_ns / SDL_NS_PER_MS,
+                    (double)stats.sleep_overshoot_ns / SDL_NS_PER_MS);
+            SDL_DestroyFramePacer(pacer);
+        }
+    }
+
+    /* Wait for the results to be seen */
+    SDL_Delay(1 * 1000);
+
     /* Test multiple timers */
     SDL_Log("Testing multiple timers...");
     t1 = SDL_AddTimer(100, callback, (void *)1);
@@ -261,6 +285,28 @@ int main(int argc, char *argv[])
     SDL_RemoveTimer(t2);
     SDL_RemoveTimer(t3);
 
+    /* Add and remove lots of timers, they're all far enough out that none of them fire */
+    {
+        static SDL_TimerID many[10000];
+
+        start_perf = SDL_GetPerformanceCounter();
+        for (i = 0; i < SDL_arraysize(many); ++i) {
+            many[i] = SDL_AddTimer(60 * 1000 + (i * 7919) % 10000, callback, NULL);
+        }
+        now_perf = SDL_GetPerformanceCounter();
+        SDL_Log("Adding %d timers took %f ms", (int)SDL_arraysize(many), (double)((now_perf - start_perf) * 1000) / SDL_GetPerformanceFrequency());
+
+        /* Let the timer thread sort them in */
+        SDL_Delay(100);
+
+        start_perf = SDL_GetPerformanceCounter();
+        for (i = 0; i < SDL_arraysize(many); ++i) {
+            SDL_RemoveTimer(many[i]);
+        }
+        now_perf = SDL_GetPerformanceCounter();
+        SDL_Log("Removing %d timers took %f ms", (int)SDL_arraysize(many), (double)((now_perf - start_perf) * 1000) / SDL_GetPerformanceFrequency());
+    }
+
     ticks = 0;
     start_perf = SDL_GetPerformanceCounter();
     for (i = 0; i < 1000000; ++i) {